@@ -5,7 +5,6 @@ bool relay2 = true; //17
 float count = 0;
 int numbers = 0;
 String text;
-unsigned long preTime = 0;
 
 void setup() {
     Serial.begin(115200);
@@ -14,7 +13,9 @@ void setup() {
     digitalWrite(16, relay1 ? HIGH : LOW);
     digitalWrite(17, relay2 ? HIGH : LOW);
     webConnect.begin();
-    webConnect.setIconUrl("https://cdnjs.cloudflare.com/ajax/libs/font-awesome/6.4.2/css/all.min.css");
+    // The icons below are in the built-in sprite, a stylesheet is only
+    // needed for others:
+    // webConnect.setIconUrl("https://cdnjs.cloudflare.com/ajax/libs/font-awesome/6.4.2/css/all.min.css");
     webConnect.setAutoUpdate(2500);
     webConnect.setDashInfo("Smart Home", "basic control", "https://danielamani.com/image/SmartHome.png", "");
     webConnect.setManifactureInfo("EDNA", "Smart Home", "Basic", "V0.1.7");
@@ -25,16 +26,18 @@ void setup() {
     webConnect.addButton("btn1", "Press Me","", "fa fa-hand-pointer", onButtonPress);
     webConnect.addInputText("input-text", "Enter text:", "","fa-solid fa-pencil", &text);
     webConnect.addInputNum("input-num", "Enter number:", "","fa-solid fa-pencil",  &count);
+    webConnect.every(50, updateRelays);
+    webConnect.every(5000, [] { updateCount(); });
 }
 
 void loop() {
+    webConnect.handle(); // runs the timers set in setup()
+    webConnect.commit();
+}
+
+void updateRelays() {
     digitalWrite(16, relay1 ? HIGH : LOW);
     digitalWrite(17, relay2 ? HIGH : LOW);
-    unsigned int taskDelay = 5000;
-        if((millis()-preTime)>taskDelay){
-           updateCount();
-      preTime=millis();
-    }
 }
 
 void onButtonPress() {
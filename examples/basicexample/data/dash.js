@@ -1,9 +1,90 @@
+// Polling interval, replaced by the one from /widgets.json
+let updateInterval = 5000;
+// Dashboard page shown, -1 when the firmware does not split widgets in pages
+let currentPage = -1;
+// Icons available in the local /icons.svg sprite
+const spriteIcons = new Set();
+
+// "fa-solid fa-fan" -> "solid-fan", the symbol id used by extras/icon_sprite.py
+function iconSymbol(icon) {
+    const classes = icon.split(/\s+/);
+    let style = "solid";
+    if (classes.includes("fa-regular") || classes.includes("far")) style = "regular";
+    if (classes.includes("fa-brands") || classes.includes("fab")) style = "brands";
+    const name = classes.find((c) => c.startsWith("fa-") && !["fa-solid", "fa-regular", "fa-brands"].includes(c));
+    return name ? `${style}-${name.substring(3)}` : "";
+}
+
+// Icon from the local sprite when it has it, otherwise from the icon stylesheet
+function iconHTML(icon, color = "") {
+    const style = color ? ` style="color: ${color};"` : "";
+    const symbol = iconSymbol(icon);
+    if (spriteIcons.has(symbol)) {
+        return `<svg class="icon" data-icon="${icon}"${style}><use href="/icons.svg#${symbol}"></use></svg>`;
+    }
+    return `<i class="${icon}" data-icon="${icon}"${style}></i>`;
+}
+
+function loadIcons() {
+    return fetch('/icons.svg')
+        .then(response => response.text())
+        .then(svg => {
+            for (const match of svg.matchAll(/<symbol id="([^"]+)"/g)) {
+                spriteIcons.add(match[1]);
+            }
+        })
+        .catch(() => {});
+}
+
+// Load the icon stylesheet without blocking the page, so an unreachable CDN
+// (AP mode) only means missing icons.
+function loadIconStylesheet(url) {
+    if (!url || document.querySelector(`link[href="${url}"]`)) return;
+    const link = document.createElement('link');
+    link.rel = 'stylesheet';
+    link.href = url;
+    document.head.appendChild(link);
+}
+var readingsViaSocket = false; // Set while the WebSocket pushes readings
+
+function applyReadings(data) {
+    Object.keys(data).forEach(id => {
+        const element = document.getElementById(id);
+        if (element) {
+            if (element.type === 'checkbox') {
+                element.checked = data[id];
+            } else if (element.tagName === 'SPAN' || element.tagName === 'DIV') {
+                element.innerText = data[id];
+            }
+        }
+    });
+}
+
+function updateReadings() {
+    if (readingsViaSocket) { // Polling is only the fallback
+        setTimeout(updateReadings, updateInterval);
+        return;
+    }
+    fetch(currentPage >= 0 ? `/allReadings?page=${currentPage}` : '/allReadings')
+        .then(response => {
+            if (!response.ok) {
+                throw new Error('Network response was not ok: ' + response.statusText);
+            }
+            return response.json();
+        })
+        .then(applyReadings)
+        .catch(error => console.error(error))
+        .finally(() => {
+            setTimeout(updateReadings, updateInterval);
+        });
+}
+
 document.addEventListener("DOMContentLoaded", () => {
     // Get references to the dashboard and dropdown
-    updateReadings();
     closeNotification();
     const dashboard = document.getElementById("dashboard");
-    const widgetSelection = document.querySelector(".dropdown-content");
+    const widgetSelection = document.getElementById("widgetSelection");
+    const pageSelection = document.getElementById("pageSelection");
 
     if (!dashboard || !widgetSelection) {
         console.error("Dashboard or widget selection not found.");
@@ -99,7 +180,7 @@ document.addEventListener("DOMContentLoaded", () => {
         if (type === "switch") {
             widget.innerHTML = `
             <div class="card-info">
-                <div class="widget-icon"><i class="${icon}" style="color: ${color};"></i></div>
+                <div class="widget-icon">${iconHTML(icon, color)}</div>
                 <div class="widget-name">${name}</div>
                 <div class="widget-desc">${desc}</div>
             </div>
@@ -111,7 +192,7 @@ document.addEventListener("DOMContentLoaded", () => {
         } else if (type === "sensor") {
             widget.innerHTML = `
             <div class="card-info">
-                <div class="widget-icon"><i class="${icon}" style="color: ${color};"></i></div>
+                <div class="widget-icon">${iconHTML(icon, color)}</div>
                 <div class="widget-name">${name}</div>
                 <div class="widget-desc">${desc}</div>
             </div>
@@ -124,7 +205,7 @@ document.addEventListener("DOMContentLoaded", () => {
         else if (type === "button") {
             widget.innerHTML = `
             <div class="card-info">
-                <div class="widget-icon"><i class="${icon}" style="color: ${color};"></i></div>
+                <div class="widget-icon">${iconHTML(icon, color)}</div>
                 <div class="widget-desc">${desc}</div>
             </div>
             <button id="${id}" type="submit" class="${isMobile ? 'button-mobile' : ''}" ontouchstart="handleButtonTouch(event)" onclick="pressButton('${id}')">${name}</button>
@@ -132,7 +213,7 @@ document.addEventListener("DOMContentLoaded", () => {
         } else if (type === "inputnumber") {
             widget.innerHTML = `
             <div class="card-info">
-                <div class="widget-icon"><i class="${icon}" style="color: ${color};"></i></div>
+                <div class="widget-icon">${iconHTML(icon, color)}</div>
                 <div class="widget-name">${name}</div>
                 <div class="widget-desc">${desc}</div>
             </div>
@@ -146,7 +227,7 @@ document.addEventListener("DOMContentLoaded", () => {
         } else if (type === "inputtext") {
             widget.innerHTML = `
             <div class="card-info">
-                <div class="widget-icon"><i class="${icon}" style="color: ${color};"></i></div>
+                <div class="widget-icon">${iconHTML(icon, color)}</div>
                 <div class="widget-name">${name}</div>
                 <div class="widget-desc">${desc}</div>
             </div>
@@ -173,7 +254,7 @@ document.addEventListener("DOMContentLoaded", () => {
         const resizer = document.createElement("div");
         resizer.className = `resizer ${isMobile ? 'resizer-mobile' : ''}`;
         if (isMobile) {
-            resizer.innerHTML = '<i class="fas fa-expand-arrows-alt"></i>';
+            resizer.innerHTML = iconHTML("fas fa-expand-arrows-alt");
         }
         widget.appendChild(resizer);
 
@@ -181,7 +262,7 @@ document.addEventListener("DOMContentLoaded", () => {
         if (isMobile) {
             const dragHandle = document.createElement("div");
             dragHandle.className = "drag-handle";
-            dragHandle.innerHTML = '<i class="fas fa-grip-vertical"></i>';
+            dragHandle.innerHTML = iconHTML("fas fa-grip-vertical");
             widget.appendChild(dragHandle);
         }
 
@@ -196,6 +277,8 @@ document.addEventListener("DOMContentLoaded", () => {
         if (isDashboardLocked) {
             setTimeout(() => updateLockState(), 0);
         }
+
+        subscribeWidgets();
     }
 
     // Remove a widget
@@ -204,6 +287,7 @@ document.addEventListener("DOMContentLoaded", () => {
         if (widget) {
             widget.remove();
             activeWidgets.delete(id);
+            subscribeWidgets();
         }
     }
 
@@ -459,6 +543,30 @@ document.addEventListener("DOMContentLoaded", () => {
         }
     });
 
+    // Switch page: only its widgets are listed, laid out and polled
+    if (pageSelection) {
+        pageSelection.addEventListener("click", (e) => {
+            const button = e.target.closest("button");
+            if (!button || button.dataset.page === undefined) return;
+
+            const page = Number(button.dataset.page);
+            if (page === currentPage) return;
+            localStorage.setItem("dashboardPage", page);
+            dashboard.innerHTML = "";
+            activeWidgets.clear();
+            loadWidgets(page)
+                .catch(error => console.error('Error loading widgets:', error))
+                .finally(() => {
+                    loadDashboard();
+                    subscribeWidgets();
+                });
+
+            if (isMobile) {
+                button.closest('.dropdown-content').style.display = 'none';
+            }
+        });
+    }
+
     // Improved dropdown behavior for mobile
     if (isMobile) {
         document.querySelectorAll('.dropdown').forEach(dropdown => {
@@ -487,8 +595,14 @@ document.addEventListener("DOMContentLoaded", () => {
         });
     }
 
+    // Each page keeps its own saved layout
+    let pageNames = [];
+    function settingsKey() {
+        return pageNames.length ? `dashboardSettings:${pageNames[currentPage]}` : "dashboardSettings";
+    }
+
     function loadDashboard() {
-        const savedState = JSON.parse(localStorage.getItem("dashboardSettings"));
+        const savedState = JSON.parse(localStorage.getItem(settingsKey()));
         if (!savedState) return;
     
         const validWidgets = Array.from(widgetSelection.querySelectorAll("button")).map(
@@ -544,8 +658,8 @@ document.addEventListener("DOMContentLoaded", () => {
                 id: widget.id,
                 name: name,
                 type: widget.dataset.type || "undefined",
-                icon: widget.querySelector('.widget-icon i')?.className || "fa fa-question",
-                color: widget.querySelector('.widget-icon i')?.style.color || "#d4aa4f",
+                icon: widget.querySelector('.widget-icon [data-icon]')?.dataset.icon || "fa fa-question",
+                color: widget.querySelector('.widget-icon [data-icon]')?.style.color || "#d4aa4f",
                 desc: widget.querySelector('.widget-desc')?.innerText || "",
                 unit: widget.querySelector('.widget-unit')?.innerText || "",
                 position: {
@@ -564,17 +678,70 @@ document.addEventListener("DOMContentLoaded", () => {
             locked: isDashboardLocked // Save lock state
         };
 
-        localStorage.setItem("dashboardSettings", JSON.stringify(dashboardState));
+        localStorage.setItem(settingsKey(), JSON.stringify(dashboardState));
         alert("Dashboard saved!");
     };
 
     window.clearDashboard = function() {
-        localStorage.removeItem("dashboardSettings");
+        localStorage.removeItem(settingsKey());
         dashboard.innerHTML = "";
         alert("Dashboard cleared!");
     };
 
-    loadDashboard();
+    // Widget list and page info come from /widgets.json (revalidated with its ETag).
+    // Firmware without pages ignores ?page= and lists every widget.
+    function loadWidgets(page = 0) {
+        const widgets = fetch(`/widgets.json?page=${page}`).then(response => {
+            if (response.status === 404 && page !== 0) {
+                return fetch('/widgets.json?page=0'); // the page is gone
+            }
+            return response;
+        }).then(response => response.json());
+        return Promise.all([widgets, loadIcons()])
+            .then(([meta]) => {
+                loadIconStylesheet(meta.iconUrl);
+                document.title = meta.title;
+                document.getElementById('dashTitle').innerText = meta.title;
+                document.getElementById('dashDescription').innerText = meta.description;
+                document.getElementById('dashImage').src = meta.image;
+                updateInterval = meta.interval || updateInterval;
+
+                pageNames = meta.pages || [];
+                currentPage = pageNames.length ? meta.page : -1;
+                if (pageSelection) {
+                    pageSelection.innerHTML = "";
+                    pageNames.forEach((name, i) => {
+                        const button = document.createElement("button");
+                        button.dataset.page = i;
+                        button.innerText = name;
+                        pageSelection.appendChild(button);
+                    });
+                    document.getElementById('pageDropdown').style.display = pageNames.length ? '' : 'none';
+                    document.getElementById('pageButton').innerText = pageNames.length ? pageNames[currentPage] : 'Page';
+                }
+
+                widgetSelection.innerHTML = "";
+                meta.widgets.forEach((w) => {
+                    const button = document.createElement("button");
+                    button.dataset.widget = w.id;
+                    button.dataset.name = w.name;
+                    button.dataset.type = w.type;
+                    if (w.icon) button.dataset.icon = w.icon;
+                    if (w.color) button.dataset.color = w.color;
+                    if (w.desc) button.dataset.desc = w.desc;
+                    if (w.unit) button.dataset.unit = w.unit;
+                    button.innerText = `${w.name} [${w.id}]`;
+                    widgetSelection.appendChild(button);
+                });
+            });
+    }
+
+    loadWidgets(Number(localStorage.getItem("dashboardPage")) || 0)
+        .catch(error => console.error('Error loading widgets:', error))
+        .finally(() => {
+            loadDashboard();
+            updateReadings();
+        });
 });
 
 // Enhanced mobile button handling
@@ -670,15 +837,46 @@ function submitInput(id) {
 // WebSocket with better error handling
 const webSocket = new WebSocket(`ws://${window.location.hostname}/ws`);
 
+// Tell the server which widgets are on the dashboard, it then pushes only their readings.
+// Coalesced, restoring a layout adds many widgets at once and messages are rate limited.
+let subscribeTimer = null;
+function subscribeWidgets(delay = 100) {
+    clearTimeout(subscribeTimer);
+    subscribeTimer = setTimeout(() => {
+        if (webSocket.readyState !== WebSocket.OPEN) return;
+        const ids = Array.from(document.querySelectorAll("#dashboard .widget")).map((w) => w.id);
+        webSocket.send(JSON.stringify({ sub: ids }));
+    }, delay);
+}
+
+webSocket.onopen = () => {
+    subscribeWidgets();
+};
+
 webSocket.onmessage = (event) => {
     try {
-        const { id, message, messageColor, icon, iconColor, timeout } = JSON.parse(event.data);
+        const msg = JSON.parse(event.data);
+        if (msg.readings) {
+            readingsViaSocket = true;
+            applyReadings(msg.readings);
+            return;
+        }
+        if (msg.sub) { // Refused, try again later when rate limited
+            if (msg.sub.error === 429) subscribeWidgets(1000);
+            return;
+        }
+        const { id, message, messageColor, icon, iconColor, timeout } = msg;
         showNotification(message, messageColor, icon, iconColor, timeout);
     } catch (error) {
         console.error('Error parsing WebSocket message:', error);
     }
 };
 
+webSocket.onclose = () => {
+    // Fall back to polling /allReadings
+    readingsViaSocket = false;
+};
+
 webSocket.onerror = (error) => {
     console.error('WebSocket error:', error);
 };
@@ -696,7 +894,7 @@ function showNotification(message, messageColor = '', icon = '', iconColor = '',
     }
 
     if (icon) {
-        iconElement.className = `notification-icon ${icon}`;
+        iconElement.innerHTML = iconHTML(icon); // from the sprite when it has it
     }
 
     if (iconColor) {
@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+"""Embed the web assets into the firmware.
+
+Gzips the dashboard and configuration page assets and writes them, with an
+ETag per file, to src/ESPWebCAssets.h. The output is deterministic (gzip
+mtime 0), so the header only changes when an asset changes.
+
+Run it after editing a file in examples/basicexample/data:
+
+    python3 extras/embed_assets.py
+"""
+
+import argparse
+import gzip
+import hashlib
+import os
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# (file, content type), the URL path is "/" + file
+ASSETS = [
+    ("dashboard.html", "text/html"),
+    ("dash.js", "text/javascript"),
+    ("style.css", "text/css"),
+    ("espwebc.html", "text/html"),
+]
+
+
+def c_array(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--data", default=os.path.join(ROOT, "examples", "basicexample", "data"))
+    parser.add_argument("--out", default=os.path.join(ROOT, "src", "ESPWebCAssets.h"))
+    args = parser.parse_args()
+
+    out = []
+    out.append("// Generated by extras/embed_assets.py, do not edit.")
+    out.append("#ifndef ESPWEBC_ASSETS_H")
+    out.append("#define ESPWEBC_ASSETS_H")
+    out.append("")
+    out.append("#include <Arduino.h>")
+    out.append("")
+    out.append("struct ESPWebCAsset")
+    out.append("{")
+    out.append("    const char *path;")
+    out.append("    const char *type;")
+    out.append("    const uint8_t *data; // gzip")
+    out.append("    size_t length;")
+    out.append("    const char *etag;")
+    out.append("};")
+    out.append("")
+
+    entries = []
+    for index, (name, content_type) in enumerate(ASSETS):
+        with open(os.path.join(args.data, name), "rb") as f:
+            raw = f.read()
+        packed = gzip.compress(raw, compresslevel=9, mtime=0)
+        etag = hashlib.sha1(raw).hexdigest()[:16]
+        symbol = "ESPWEBC_ASSET_%d" % index
+        out.append("// %s: %d bytes, %d gzipped" % (name, len(raw), len(packed)))
+        out.append("static const uint8_t %s[] PROGMEM = {" % symbol)
+        out.append(c_array(packed))
+        out.append("};")
+        out.append("")
+        entries.append('    {"/%s", "%s", %s, sizeof(%s), "\\"%s\\""},' % (name, content_type, symbol, symbol, etag))
+
+    out.append("static const ESPWebCAsset ESPWEBC_ASSETS[] = {")
+    out.extend(entries)
+    out.append("};")
+    out.append("")
+    out.append("#endif // ESPWEBC_ASSETS_H")
+    out.append("")
+
+    with open(args.out, "w", newline="\n") as f:
+        f.write("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,335 @@
+// Host build of the Arduino core, just what ESPWebConnect and ArduinoJson
+// use, for extras/host/soak_host.cpp. millis() runs on a simulated clock.
+#ifndef ESPWEBC_HOST_ARDUINO_H
+#define ESPWEBC_HOST_ARDUINO_H
+
+// ArduinoJson only enables its String/Print/Stream support when ARDUINO is
+// defined, which would also pull in PROGMEM handling
+#ifndef ARDUINOJSON_ENABLE_ARDUINO_STRING
+#define ARDUINOJSON_ENABLE_ARDUINO_STRING 1
+#endif
+#ifndef ARDUINOJSON_ENABLE_ARDUINO_STREAM
+#define ARDUINOJSON_ENABLE_ARDUINO_STREAM 1
+#endif
+#ifndef ARDUINOJSON_ENABLE_ARDUINO_PRINT
+#define ARDUINOJSON_ENABLE_ARDUINO_PRINT 1
+#endif
+#ifndef ARDUINOJSON_ENABLE_PROGMEM
+#define ARDUINOJSON_ENABLE_PROGMEM 0
+#endif
+
+#include <ctype.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <algorithm>
+#include <string>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+#define F(s) (s)
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define memcpy_P memcpy
+#define strlen_P strlen
+#define strncmp_P strncmp
+
+#define DEC 10
+#define HEX 16
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+#define IRAM_ATTR
+#define ARDUINO_RUNNING_CORE 1
+
+#define ESP_OK 0
+#define ESP_FAIL -1
+typedef int esp_err_t;
+
+class String;
+
+class Print
+{
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size)
+    {
+        size_t n = 0;
+        while (size-- > 0 && write(*buffer++))
+        {
+            n++;
+        }
+        return n;
+    }
+    size_t write(const char *s) { return s ? write((const uint8_t *)s, strlen(s)) : 0; }
+    size_t write(const char *s, size_t size) { return write((const uint8_t *)s, size); }
+
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+    size_t print(const char *s) { return write(s); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(const String &s);
+    size_t print(int n, int base = DEC) { return print((long)n, base); }
+    size_t print(unsigned int n, int base = DEC) { return print((unsigned long)n, base); }
+    size_t print(long n, int base = DEC);
+    size_t print(unsigned long n, int base = DEC);
+    size_t print(long long n, int base = DEC) { return print((long)n, base); }
+    size_t print(unsigned long long n, int base = DEC) { return print((unsigned long)n, base); }
+    size_t print(double n, int digits = 2);
+    size_t println() { return write("\r\n"); }
+    template <typename T>
+    size_t println(const T &value) { return print(value) + println(); }
+    template <typename T>
+    size_t println(const T &value, int format) { return print(value, format) + println(); }
+};
+
+// Arduino String semantics on top of std::string, so the heap counters of
+// the harness see every allocation the library makes through it
+class String
+{
+public:
+    String() {}
+    String(const char *s) : s(s ? s : "") {}
+    String(const char *s, unsigned int length) : s(s, length) {}
+    String(const std::string &s) : s(s) {}
+    String(const String &other) = default;
+    String(String &&other) = default;
+    explicit String(char c) : s(1, c) {}
+    explicit String(unsigned char n, unsigned char base = DEC) : String((unsigned long)n, base) {}
+    explicit String(int n, unsigned char base = DEC) : String((long)n, base) {}
+    explicit String(unsigned int n, unsigned char base = DEC) : String((unsigned long)n, base) {}
+    explicit String(long n, unsigned char base = DEC);
+    explicit String(unsigned long n, unsigned char base = DEC);
+    explicit String(long long n, unsigned char base = DEC) : String((long)n, base) {}
+    explicit String(unsigned long long n, unsigned char base = DEC) : String((unsigned long)n, base) {}
+    explicit String(float n, unsigned int digits = 2) : String((double)n, digits) {}
+    explicit String(double n, unsigned int digits = 2);
+
+    String &operator=(const String &other) = default;
+    String &operator=(String &&other) = default;
+    String &operator=(const char *other)
+    {
+        s = other ? other : "";
+        return *this;
+    }
+
+    const char *c_str() const { return s.c_str(); }
+    unsigned int length() const { return s.size(); }
+    bool isEmpty() const { return s.empty(); }
+    bool reserve(unsigned int size)
+    {
+        s.reserve(size);
+        return true;
+    }
+
+    bool concat(const String &other) { return append(other.s.data(), other.s.size()); }
+    bool concat(const char *other) { return other && append(other, strlen(other)); }
+    bool concat(const char *other, unsigned int length) { return other && append(other, length); }
+    bool concat(char c) { return append(&c, 1); }
+    bool concat(unsigned char n) { return concat(String(n)); }
+    bool concat(int n) { return concat(String(n)); }
+    bool concat(unsigned int n) { return concat(String(n)); }
+    bool concat(long n) { return concat(String(n)); }
+    bool concat(unsigned long n) { return concat(String(n)); }
+    bool concat(long long n) { return concat(String(n)); }
+    bool concat(unsigned long long n) { return concat(String(n)); }
+    bool concat(float n) { return concat(String(n)); }
+    bool concat(double n) { return concat(String(n)); }
+    template <typename T>
+    String &operator+=(const T &value)
+    {
+        concat(value);
+        return *this;
+    }
+
+    bool equals(const String &other) const { return s == other.s; }
+    bool equals(const char *other) const { return s == (other ? other : ""); }
+    bool equalsIgnoreCase(const String &other) const { return strcasecmp(c_str(), other.c_str()) == 0; }
+    bool operator==(const String &other) const { return equals(other); }
+    bool operator==(const char *other) const { return equals(other); }
+    bool operator!=(const String &other) const { return !equals(other); }
+    bool operator!=(const char *other) const { return !equals(other); }
+    bool operator<(const String &other) const { return s < other.s; }
+    int compareTo(const String &other) const { return s.compare(other.s); }
+    bool startsWith(const String &prefix) const { return s.compare(0, prefix.s.size(), prefix.s) == 0; }
+    bool endsWith(const String &suffix) const
+    {
+        return s.size() >= suffix.s.size() && s.compare(s.size() - suffix.s.size(), suffix.s.size(), suffix.s) == 0;
+    }
+
+    char charAt(unsigned int index) const { return index < s.size() ? s[index] : 0; }
+    char operator[](unsigned int index) const { return charAt(index); }
+    char &operator[](unsigned int index) { return s[index]; }
+    int indexOf(char c, unsigned int from = 0) const { return position(s.find(c, from)); }
+    int indexOf(const String &other, unsigned int from = 0) const { return position(s.find(other.s, from)); }
+    int lastIndexOf(char c) const { return position(s.rfind(c)); }
+    int lastIndexOf(const String &other) const { return position(s.rfind(other.s)); }
+    String substring(unsigned int from) const { return from < s.size() ? String(s.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const
+    {
+        if (from > to)
+        {
+            std::swap(from, to);
+        }
+        return from < s.size() ? String(s.substr(from, to - from)) : String();
+    }
+
+    void replace(const String &find, const String &with);
+    void remove(unsigned int index, unsigned int count = (unsigned int)-1)
+    {
+        if (index < s.size())
+        {
+            s.erase(index, count);
+        }
+    }
+    void toLowerCase() { std::transform(s.begin(), s.end(), s.begin(), ::tolower); }
+    void toUpperCase() { std::transform(s.begin(), s.end(), s.begin(), ::toupper); }
+    void trim();
+
+    long toInt() const { return atol(c_str()); }
+    float toFloat() const { return atof(c_str()); }
+    double toDouble() const { return atof(c_str()); }
+
+private:
+    std::string s;
+
+    bool append(const char *data, size_t length)
+    {
+        s.append(data, length);
+        return true;
+    }
+    static int position(size_t pos) { return pos == std::string::npos ? -1 : (int)pos; }
+};
+
+// ArduinoJson adapts it like String
+class StringSumHelper : public String
+{
+public:
+    StringSumHelper(const String &s) : String(s) {}
+    StringSumHelper(const char *s) : String(s) {}
+};
+
+inline StringSumHelper operator+(const String &lhs, const String &rhs)
+{
+    StringSumHelper sum(lhs);
+    sum.concat(rhs);
+    return sum;
+}
+inline StringSumHelper operator+(const String &lhs, const char *rhs)
+{
+    StringSumHelper sum(lhs);
+    sum.concat(rhs);
+    return sum;
+}
+inline StringSumHelper operator+(const char *lhs, const String &rhs)
+{
+    StringSumHelper sum(lhs);
+    sum.concat(rhs);
+    return sum;
+}
+template <typename T>
+inline StringSumHelper operator+(const String &lhs, T rhs)
+{
+    StringSumHelper sum(lhs);
+    sum.concat(rhs);
+    return sum;
+}
+
+inline size_t Print::print(const String &s) { return write((const uint8_t *)s.c_str(), s.length()); }
+
+class Stream : public Print
+{
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    void setTimeout(unsigned long) {}
+    size_t readBytes(char *buffer, size_t length)
+    {
+        size_t n = 0;
+        int c;
+        while (n < length && (c = read()) >= 0)
+        {
+            buffer[n++] = (char)c;
+        }
+        return n;
+    }
+    size_t readBytes(uint8_t *buffer, size_t length) { return readBytes((char *)buffer, length); }
+    String readString()
+    {
+        String text;
+        int c;
+        while ((c = read()) >= 0)
+        {
+            text.concat((char)c);
+        }
+        return text;
+    }
+    String readStringUntil(char terminator)
+    {
+        String text;
+        int c;
+        while ((c = read()) >= 0 && c != terminator)
+        {
+            text.concat((char)c);
+        }
+        return text;
+    }
+};
+
+// Debug output goes to stdout
+class HardwareSerial : public Stream
+{
+public:
+    void begin(unsigned long) {}
+    size_t write(uint8_t c) override { return fwrite(&c, 1, 1, stdout); }
+    size_t write(const uint8_t *buffer, size_t size) override { return fwrite(buffer, 1, size, stdout); }
+    using Print::write;
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+};
+extern HardwareSerial Serial;
+
+// Simulated clock, moved by delay() and by the harness
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+long random(long max);
+long random(long min, long max);
+
+// Free heap is a fixed budget minus the bytes the process has allocated, see
+// host.cpp
+class EspClass
+{
+public:
+    uint32_t getHeapSize();
+    uint32_t getFreeHeap();
+    uint32_t getMinFreeHeap();
+    uint32_t getMaxAllocHeap();
+    void restart();
+};
+extern EspClass ESP;
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_heap_caps.h"
+
+#endif // ESPWEBC_HOST_ARDUINO_H
@@ -0,0 +1,577 @@
+#include "ESPAsyncWebServer.h"
+#include "ESPWebCHost.h"
+
+#include <algorithm>
+
+#define TCP_SEGMENT 1436 // body parts handed to handlers, like the TCP stack
+
+namespace
+{
+    class BasicResponse : public AsyncWebServerResponse
+    {
+    public:
+        BasicResponse(int code, const String &contentType, const String &content) : AsyncWebServerResponse(code, contentType), content(content) {}
+        size_t read(uint8_t *buffer, size_t maxLen, size_t index) override
+        {
+            size_t len = index < content.length() ? std::min(maxLen, (size_t)content.length() - index) : 0;
+            memcpy(buffer, content.c_str() + index, len);
+            return len;
+        }
+
+    private:
+        String content;
+    };
+
+    class ProgmemResponse : public AsyncWebServerResponse
+    {
+    public:
+        ProgmemResponse(int code, const String &contentType, const uint8_t *content, size_t len) : AsyncWebServerResponse(code, contentType), content(content), len(len) {}
+        size_t read(uint8_t *buffer, size_t maxLen, size_t index) override
+        {
+            size_t n = index < len ? std::min(maxLen, len - index) : 0;
+            memcpy(buffer, content + index, n);
+            return n;
+        }
+
+    private:
+        const uint8_t *content;
+        size_t len;
+    };
+
+    class CallbackResponse : public AsyncWebServerResponse
+    {
+    public:
+        // len is (size_t)-1 for a chunked response, which ends on a 0 return
+        CallbackResponse(const String &contentType, size_t len, AwsResponseFiller fill) : AsyncWebServerResponse(200, contentType), len(len), fill(fill) {}
+        size_t read(uint8_t *buffer, size_t maxLen, size_t index) override
+        {
+            if (index >= len)
+            {
+                return 0;
+            }
+            return fill(buffer, std::min(maxLen, len - index), index);
+        }
+
+    private:
+        size_t len;
+        AwsResponseFiller fill;
+    };
+
+    class FileResponse : public AsyncWebServerResponse
+    {
+    public:
+        FileResponse(File file, const String &contentType) : AsyncWebServerResponse(200, contentType), file(file) {}
+        size_t read(uint8_t *buffer, size_t maxLen, size_t index) override { return file.read(buffer, maxLen); }
+
+    private:
+        File file;
+    };
+
+    std::vector<AsyncWebServer *> &servers()
+    {
+        static std::vector<AsyncWebServer *> list;
+        return list;
+    }
+
+    uint32_t doubleSendCount = 0;
+
+    const char BASE64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    String base64(const String &text)
+    {
+        String out;
+        const uint8_t *in = (const uint8_t *)text.c_str();
+        size_t len = text.length();
+        for (size_t i = 0; i < len; i += 3)
+        {
+            uint32_t group = in[i] << 16 | (i + 1 < len ? in[i + 1] << 8 : 0) | (i + 2 < len ? in[i + 2] : 0);
+            out.concat(BASE64[group >> 18 & 63]);
+            out.concat(BASE64[group >> 12 & 63]);
+            out.concat(i + 1 < len ? BASE64[group >> 6 & 63] : '=');
+            out.concat(i + 2 < len ? BASE64[group & 63] : '=');
+        }
+        return out;
+    }
+}
+
+size_t AsyncResponseStream::read(uint8_t *buffer, size_t maxLen, size_t index)
+{
+    size_t len = index < body.size() ? std::min(maxLen, body.size() - index) : 0;
+    memcpy(buffer, body.data() + index, len);
+    return len;
+}
+
+bool AsyncCallbackWebHandler::canHandle(AsyncWebServerRequest *request)
+{
+    if (!(method & request->method()))
+    {
+        return false;
+    }
+    const String &url = request->url();
+    if (uri.endsWith("*"))
+    {
+        return url.startsWith(uri.substring(0, uri.length() - 1));
+    }
+    return url == uri || url.startsWith(uri + "/");
+}
+
+void AsyncCallbackWebHandler::handleRequest(AsyncWebServerRequest *request)
+{
+    if (onRequest)
+    {
+        onRequest(request);
+    }
+    else
+    {
+        request->send(500);
+    }
+}
+
+void AsyncCallbackWebHandler::handleBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total)
+{
+    if (onBody)
+    {
+        onBody(request, data, len, index, total);
+    }
+}
+
+AsyncWebServerRequest::AsyncWebServerRequest(IPAddress ip, WebRequestMethodComposite method, const String &url)
+    : tcp(ip), requestMethod(method)
+{
+    int query = url.indexOf('?');
+    requestUrl = query < 0 ? url : url.substring(0, query);
+    while (query >= 0)
+    {
+        int next = url.indexOf('&', query + 1);
+        String pair = next < 0 ? url.substring(query + 1) : url.substring(query + 1, next);
+        int eq = pair.indexOf('=');
+        addParam(eq < 0 ? pair : pair.substring(0, eq), eq < 0 ? String() : pair.substring(eq + 1));
+        query = next;
+    }
+}
+
+// The connection closes after each response, the real server calls the
+// disconnect handlers then
+AsyncWebServerRequest::~AsyncWebServerRequest()
+{
+    for (ArDisconnectHandler &fn : disconnectHandlers)
+    {
+        fn();
+    }
+    delete sent;
+}
+
+uint32_t AsyncWebServerRequest::doubleSends()
+{
+    return doubleSendCount;
+}
+
+void AsyncWebServerRequest::send(AsyncWebServerResponse *response)
+{
+    if (sent != nullptr)
+    {
+        doubleSendCount++;
+        delete response;
+        return;
+    }
+    sent = response;
+}
+
+void AsyncWebServerRequest::send(int code, const String &contentType, const String &content)
+{
+    send(beginResponse(code, contentType, content));
+}
+
+void AsyncWebServerRequest::send(FS &fs, const String &path, const String &contentType, bool download, AwsTemplateProcessor callback)
+{
+    send(beginResponse(fs, path, contentType, download, callback));
+}
+
+AsyncWebServerResponse *AsyncWebServerRequest::beginResponse(int code, const String &contentType, const String &content)
+{
+    return new BasicResponse(code, contentType, content);
+}
+
+AsyncWebServerResponse *AsyncWebServerRequest::beginResponse(FS &fs, const String &path, const String &contentType, bool download, AwsTemplateProcessor callback)
+{
+    File file = fs.open(path, "r");
+    if (!file)
+    {
+        return new BasicResponse(404, String(), String());
+    }
+    return new FileResponse(file, contentType);
+}
+
+AsyncWebServerResponse *AsyncWebServerRequest::beginResponse(const String &contentType, size_t len, AwsResponseFiller callback, AwsTemplateProcessor templateCallback)
+{
+    return new CallbackResponse(contentType, len, callback);
+}
+
+AsyncWebServerResponse *AsyncWebServerRequest::beginChunkedResponse(const String &contentType, AwsResponseFiller callback, AwsTemplateProcessor templateCallback)
+{
+    return new CallbackResponse(contentType, (size_t)-1, callback);
+}
+
+AsyncWebServerResponse *AsyncWebServerRequest::beginResponse_P(int code, const String &contentType, const uint8_t *content, size_t len, AwsTemplateProcessor callback)
+{
+    return new ProgmemResponse(code, contentType, content, len);
+}
+
+AsyncResponseStream *AsyncWebServerRequest::beginResponseStream(const String &contentType, size_t bufferSize)
+{
+    return new AsyncResponseStream(contentType, bufferSize);
+}
+
+bool AsyncWebServerRequest::authenticate(const char *username, const char *password, const char *realm, bool passwordIsHash)
+{
+    AsyncWebHeader *header = getHeader("Authorization");
+    return header != nullptr && header->value() == "Basic " + base64(String(username) + ":" + password);
+}
+
+void AsyncWebServerRequest::requestAuthentication(const char *realm, bool isDigest)
+{
+    AsyncWebServerResponse *response = beginResponse(401);
+    response->addHeader("WWW-Authenticate", String("Basic realm=\"") + (realm ? realm : "Login Required") + "\"");
+    send(response);
+}
+
+AsyncWebParameter *AsyncWebServerRequest::getParam(size_t index) const
+{
+    return index < paramList.size() ? const_cast<AsyncWebParameter *>(&paramList[index]) : nullptr;
+}
+
+AsyncWebParameter *AsyncWebServerRequest::getParam(const String &name, bool post, bool file) const
+{
+    for (const AsyncWebParameter &param : paramList)
+    {
+        if (param.name() == name && param.isPost() == post && param.isFile() == file)
+        {
+            return const_cast<AsyncWebParameter *>(&param);
+        }
+    }
+    return nullptr;
+}
+
+bool AsyncWebServerRequest::hasArg(const char *name) const
+{
+    for (const AsyncWebParameter &param : paramList)
+    {
+        if (param.name() == name)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+const String &AsyncWebServerRequest::arg(const String &name) const
+{
+    static const String empty;
+    for (const AsyncWebParameter &param : paramList)
+    {
+        if (param.name() == name)
+        {
+            return param.value();
+        }
+    }
+    return empty;
+}
+
+AsyncWebHeader *AsyncWebServerRequest::getHeader(const String &name) const
+{
+    for (const AsyncWebHeader &header : headerList)
+    {
+        if (header.name().equalsIgnoreCase(name))
+        {
+            return const_cast<AsyncWebHeader *>(&header);
+        }
+    }
+    return nullptr;
+}
+
+AsyncWebServer::AsyncWebServer(uint16_t port) : port(port)
+{
+    ESPWebCHost::Untracked untracked;
+    servers().push_back(this);
+}
+
+AsyncWebServer::~AsyncWebServer()
+{
+    servers().erase(std::remove(servers().begin(), servers().end(), this), servers().end());
+    for (AsyncCallbackWebHandler *handler : owned)
+    {
+        delete handler;
+    }
+}
+
+void AsyncWebServer::begin()
+{
+    started = true;
+}
+
+void AsyncWebServer::end()
+{
+    started = false;
+}
+
+AsyncWebServer *AsyncWebServer::running(uint16_t port)
+{
+    for (AsyncWebServer *server : servers())
+    {
+        if (server->started && server->port == port)
+        {
+            return server;
+        }
+    }
+    return nullptr;
+}
+
+AsyncWebHandler &AsyncWebServer::addHandler(AsyncWebHandler *handler)
+{
+    handlers.push_back(handler);
+    return *handler;
+}
+
+bool AsyncWebServer::removeHandler(AsyncWebHandler *handler)
+{
+    auto it = std::find(handlers.begin(), handlers.end(), handler);
+    if (it == handlers.end())
+    {
+        return false;
+    }
+    handlers.erase(it);
+    return true;
+}
+
+AsyncCallbackWebHandler &AsyncWebServer::on(const char *uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest, ArUploadHandlerFunction onUpload, ArBodyHandlerFunction onBody)
+{
+    AsyncCallbackWebHandler *handler = new AsyncCallbackWebHandler(uri, method, onRequest, onUpload, onBody);
+    owned.push_back(handler);
+    addHandler(handler);
+    return *handler;
+}
+
+void AsyncWebServer::dispatch(AsyncWebServerRequest *request)
+{
+    AsyncWebHandler *handler = nullptr;
+    for (AsyncWebHandler *candidate : handlers)
+    {
+        if (candidate->canHandle(request))
+        {
+            handler = candidate;
+            break;
+        }
+    }
+    if (handler == nullptr)
+    {
+        if (notFound)
+        {
+            notFound(request);
+        }
+        else
+        {
+            request->send(404);
+        }
+        return;
+    }
+
+    const String &body = request->requestBody();
+    uint8_t segment[TCP_SEGMENT];
+    for (size_t index = 0; index < body.length(); index += TCP_SEGMENT)
+    {
+        size_t len = std::min((size_t)TCP_SEGMENT, body.length() - index);
+        memcpy(segment, body.c_str() + index, len);
+        handler->handleBody(request, segment, len, index, body.length());
+    }
+    handler->handleRequest(request);
+}
+
+void AsyncWebSocketClient::text(const char *message, size_t len)
+{
+    if (closing)
+    {
+        return;
+    }
+    ESPWebCHost::Untracked untracked;
+    messages++;
+    bytes += len;
+    last.assign(message, len);
+}
+
+AsyncWebSocket::~AsyncWebSocket()
+{
+    for (AsyncWebSocketClient *c : clients)
+    {
+        delete c;
+    }
+}
+
+size_t AsyncWebSocket::count() const
+{
+    size_t open = 0;
+    for (AsyncWebSocketClient *c : clients)
+    {
+        open += !c->closed();
+    }
+    return open;
+}
+
+AsyncWebSocketClient *AsyncWebSocket::client(uint32_t id)
+{
+    for (AsyncWebSocketClient *c : clients)
+    {
+        if (c->id() == id && !c->closed())
+        {
+            return c;
+        }
+    }
+    return nullptr;
+}
+
+void AsyncWebSocket::textAll(const char *message, size_t len)
+{
+    for (AsyncWebSocketClient *c : clients)
+    {
+        c->text(message, len);
+    }
+}
+
+AsyncWebSocketClient *AsyncWebSocket::connect(IPAddress ip)
+{
+    AsyncWebSocketClient *c;
+    {
+        ESPWebCHost::Untracked untracked;
+        c = new AsyncWebSocketClient(this, nextId++, ip);
+        clients.push_back(c);
+    }
+    if (eventHandler)
+    {
+        eventHandler(this, c, WS_EVT_CONNECT, nullptr, nullptr, 0);
+    }
+    return c;
+}
+
+void AsyncWebSocket::message(AsyncWebSocketClient *client, const char *text, size_t len)
+{
+    if (client->closed() || !eventHandler)
+    {
+        return;
+    }
+    AwsFrameInfo info = {};
+    info.message_opcode = WS_TEXT;
+    info.opcode = WS_TEXT;
+    info.final = 1;
+    info.masked = 1;
+    info.len = len;
+    std::vector<uint8_t> data;
+    {
+        ESPWebCHost::Untracked untracked;
+        data.assign(text, text + len);
+        data.push_back(0);
+    }
+    eventHandler(this, client, WS_EVT_DATA, &info, data.data(), len);
+    ESPWebCHost::Untracked untracked;
+    data = std::vector<uint8_t>();
+}
+
+void AsyncWebSocket::disconnect(AsyncWebSocketClient *client)
+{
+    client->close();
+    reap();
+}
+
+void AsyncWebSocket::reap()
+{
+    for (size_t i = 0; i < clients.size();)
+    {
+        AsyncWebSocketClient *c = clients[i];
+        if (!c->closed())
+        {
+            i++;
+            continue;
+        }
+        if (eventHandler)
+        {
+            eventHandler(this, c, WS_EVT_DISCONNECT, nullptr, nullptr, 0);
+        }
+        ESPWebCHost::Untracked untracked;
+        clients.erase(clients.begin() + i);
+        delete c;
+    }
+}
+
+void AsyncEventSourceClient::send(const char *message, const char *event, uint32_t id, uint32_t reconnect)
+{
+    if (closing)
+    {
+        return;
+    }
+    messages++;
+    bytes += strlen(message);
+    if (id != 0)
+    {
+        lastEventId = id;
+    }
+}
+
+AsyncEventSource::~AsyncEventSource()
+{
+    for (AsyncEventSourceClient *c : clients)
+    {
+        delete c;
+    }
+}
+
+size_t AsyncEventSource::count() const
+{
+    size_t open = 0;
+    for (AsyncEventSourceClient *c : clients)
+    {
+        open += c->connected();
+    }
+    return open;
+}
+
+void AsyncEventSource::send(const char *message, const char *event, uint32_t id, uint32_t reconnect)
+{
+    for (AsyncEventSourceClient *c : clients)
+    {
+        c->send(message, event, id, reconnect);
+    }
+}
+
+AsyncEventSourceClient *AsyncEventSource::connect(IPAddress ip)
+{
+    AsyncEventSourceClient *c;
+    {
+        ESPWebCHost::Untracked untracked;
+        c = new AsyncEventSourceClient(this, ip);
+        clients.push_back(c);
+    }
+    if (connectHandler)
+    {
+        connectHandler(c);
+    }
+    return c;
+}
+
+void AsyncEventSource::disconnect(AsyncEventSourceClient *client)
+{
+    client->close();
+    reap();
+}
+
+void AsyncEventSource::reap()
+{
+    ESPWebCHost::Untracked untracked;
+    for (size_t i = 0; i < clients.size();)
+    {
+        if (clients[i]->connected())
+        {
+            i++;
+            continue;
+        }
+        delete clients[i];
+        clients.erase(clients.begin() + i);
+    }
+}
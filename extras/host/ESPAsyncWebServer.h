@@ -0,0 +1,386 @@
+// Host build of the ESPAsyncWebServer API ESPWebConnect uses. There is no
+// network: extras/soak_host.cpp builds requests and connects WebSocket and
+// Server-Sent Events clients itself, the server runs them through the
+// registered handlers and the responses are read out like the TCP stack
+// would, see ESPAsyncWebServer.cpp.
+#ifndef ESPWEBC_HOST_ESPASYNCWEBSERVER_H
+#define ESPWEBC_HOST_ESPASYNCWEBSERVER_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include "IPAddress.h"
+#include <functional>
+#include <string>
+#include <vector>
+
+typedef enum
+{
+    HTTP_GET = 0b00000001,
+    HTTP_POST = 0b00000010,
+    HTTP_DELETE = 0b00000100,
+    HTTP_PUT = 0b00001000,
+    HTTP_PATCH = 0b00010000,
+    HTTP_HEAD = 0b00100000,
+    HTTP_OPTIONS = 0b01000000,
+    HTTP_ANY = 0b01111111,
+} WebRequestMethod;
+typedef uint8_t WebRequestMethodComposite;
+
+class AsyncWebServerRequest;
+class AsyncWebServerResponse;
+
+typedef std::function<void(AsyncWebServerRequest *request)> ArRequestHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest *request, const String &filename, size_t index, uint8_t *data, size_t len, bool final)> ArUploadHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total)> ArBodyHandlerFunction;
+typedef std::function<size_t(uint8_t *buffer, size_t maxLen, size_t index)> AwsResponseFiller;
+typedef std::function<String(const String &)> AwsTemplateProcessor;
+typedef std::function<void(void)> ArDisconnectHandler;
+
+class AsyncClient
+{
+public:
+    explicit AsyncClient(IPAddress ip) : ip(ip) {}
+    IPAddress remoteIP() const { return ip; }
+    uint16_t remotePort() const { return 49152; }
+
+private:
+    IPAddress ip;
+};
+
+class AsyncWebParameter
+{
+public:
+    AsyncWebParameter(const String &name, const String &value, bool form = false, bool file = false)
+        : paramName(name), paramValue(value), form(form), file(file) {}
+    const String &name() const { return paramName; }
+    const String &value() const { return paramValue; }
+    bool isPost() const { return form; }
+    bool isFile() const { return file; }
+
+private:
+    String paramName;
+    String paramValue;
+    bool form;
+    bool file;
+};
+
+class AsyncWebHeader
+{
+public:
+    AsyncWebHeader(const String &name, const String &value) : headerName(name), headerValue(value) {}
+    const String &name() const { return headerName; }
+    const String &value() const { return headerValue; }
+
+private:
+    String headerName;
+    String headerValue;
+};
+
+class AsyncWebServerResponse
+{
+public:
+    AsyncWebServerResponse(int code, const String &contentType) : statusCode(code), type(contentType) {}
+    virtual ~AsyncWebServerResponse() {}
+    void setCode(int code) { statusCode = code; }
+    void setContentType(const String &contentType) { type = contentType; }
+    void setContentLength(size_t length) {}
+    void addHeader(const String &name, const String &value) { headers.push_back(AsyncWebHeader(name, value)); }
+
+    int code() const { return statusCode; }
+    const String &contentType() const { return type; }
+    String header(const String &name) const
+    {
+        for (const AsyncWebHeader &h : headers)
+        {
+            if (h.name().equalsIgnoreCase(name))
+            {
+                return h.value();
+            }
+        }
+        return String();
+    }
+    // Next part of the body for the fake transport, 0 at the end
+    virtual size_t read(uint8_t *buffer, size_t maxLen, size_t index) = 0;
+
+private:
+    int statusCode;
+    String type;
+    std::vector<AsyncWebHeader> headers;
+};
+
+class AsyncResponseStream : public AsyncWebServerResponse, public Print
+{
+public:
+    AsyncResponseStream(const String &contentType, size_t bufferSize) : AsyncWebServerResponse(200, contentType) { body.reserve(bufferSize); }
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t *data, size_t len) override
+    {
+        body.append((const char *)data, len);
+        return len;
+    }
+    using Print::write;
+    size_t read(uint8_t *buffer, size_t maxLen, size_t index) override;
+
+private:
+    std::string body;
+};
+
+class AsyncWebHandler
+{
+public:
+    virtual ~AsyncWebHandler() {}
+    virtual bool canHandle(AsyncWebServerRequest *request) { return false; }
+    virtual void handleRequest(AsyncWebServerRequest *request) {}
+    virtual void handleUpload(AsyncWebServerRequest *request, const String &filename, size_t index, uint8_t *data, size_t len, bool final) {}
+    virtual void handleBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {}
+    virtual bool isRequestHandlerTrivial() { return true; }
+};
+
+class AsyncCallbackWebHandler : public AsyncWebHandler
+{
+public:
+    AsyncCallbackWebHandler(const String &uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest, ArUploadHandlerFunction onUpload, ArBodyHandlerFunction onBody)
+        : uri(uri), method(method), onRequest(onRequest), onUpload(onUpload), onBody(onBody) {}
+    bool canHandle(AsyncWebServerRequest *request) override;
+    void handleRequest(AsyncWebServerRequest *request) override;
+    void handleBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) override;
+    bool isRequestHandlerTrivial() override { return !onBody && !onUpload; }
+
+private:
+    String uri;
+    WebRequestMethodComposite method;
+    ArRequestHandlerFunction onRequest;
+    ArUploadHandlerFunction onUpload;
+    ArBodyHandlerFunction onBody;
+};
+
+class AsyncWebServerRequest
+{
+public:
+    // For the harness: the request as it arrives, form parameters go in
+    // params with form set
+    AsyncWebServerRequest(IPAddress ip, WebRequestMethodComposite method, const String &url);
+    ~AsyncWebServerRequest();
+    void addParam(const String &name, const String &value, bool form = false) { paramList.push_back(AsyncWebParameter(name, value, form)); }
+    void addHeader(const String &name, const String &value) { headerList.push_back(AsyncWebHeader(name, value)); }
+    void setBody(const String &data) { body = data; }
+    const String &requestBody() const { return body; }
+    AsyncWebServerResponse *response() const { return sent; }
+    static uint32_t doubleSends(); // send() on a request already answered
+
+    void *_tempObject = nullptr;
+
+    AsyncClient *client() { return &tcp; }
+    WebRequestMethodComposite method() const { return requestMethod; }
+    const String &url() const { return requestUrl; }
+    size_t contentLength() const { return body.length(); }
+
+    void send(AsyncWebServerResponse *response);
+    void send(int code, const String &contentType = String(), const String &content = String());
+    void send(FS &fs, const String &path, const String &contentType = String(), bool download = false, AwsTemplateProcessor callback = nullptr);
+    void send_P(int code, const String &contentType, const uint8_t *content, size_t len, AwsTemplateProcessor callback = nullptr) { send(beginResponse_P(code, contentType, content, len, callback)); }
+    void sendChunked(const String &contentType, AwsResponseFiller callback, AwsTemplateProcessor templateCallback = nullptr) { send(beginChunkedResponse(contentType, callback, templateCallback)); }
+
+    AsyncWebServerResponse *beginResponse(int code, const String &contentType = String(), const String &content = String());
+    AsyncWebServerResponse *beginResponse(FS &fs, const String &path, const String &contentType = String(), bool download = false, AwsTemplateProcessor callback = nullptr);
+    AsyncWebServerResponse *beginResponse(const String &contentType, size_t len, AwsResponseFiller callback, AwsTemplateProcessor templateCallback = nullptr);
+    AsyncWebServerResponse *beginChunkedResponse(const String &contentType, AwsResponseFiller callback, AwsTemplateProcessor templateCallback = nullptr);
+    AsyncWebServerResponse *beginResponse_P(int code, const String &contentType, const uint8_t *content, size_t len, AwsTemplateProcessor callback = nullptr);
+    AsyncResponseStream *beginResponseStream(const String &contentType, size_t bufferSize = 1460);
+
+    bool authenticate(const char *username, const char *password, const char *realm = nullptr, bool passwordIsHash = false);
+    void requestAuthentication(const char *realm = nullptr, bool isDigest = true);
+
+    size_t params() const { return paramList.size(); }
+    AsyncWebParameter *getParam(size_t index) const;
+    AsyncWebParameter *getParam(const String &name, bool post = false, bool file = false) const;
+    bool hasParam(const String &name, bool post = false, bool file = false) const { return getParam(name, post, file) != nullptr; }
+    bool hasArg(const char *name) const;
+    const String &arg(const String &name) const;
+    bool hasHeader(const String &name) const { return getHeader(name) != nullptr; }
+    AsyncWebHeader *getHeader(const String &name) const;
+
+    void onDisconnect(ArDisconnectHandler fn) { disconnectHandlers.push_back(fn); }
+
+private:
+    AsyncClient tcp;
+    WebRequestMethodComposite requestMethod;
+    String requestUrl;
+    String body;
+    std::vector<AsyncWebParameter> paramList;
+    std::vector<AsyncWebHeader> headerList;
+    std::vector<ArDisconnectHandler> disconnectHandlers;
+    AsyncWebServerResponse *sent = nullptr;
+};
+
+class AsyncWebServer
+{
+public:
+    explicit AsyncWebServer(uint16_t port);
+    ~AsyncWebServer();
+    void begin();
+    void end();
+    AsyncWebHandler &addHandler(AsyncWebHandler *handler);
+    bool removeHandler(AsyncWebHandler *handler);
+    AsyncCallbackWebHandler &on(const char *uri, ArRequestHandlerFunction onRequest) { return on(uri, HTTP_ANY, onRequest); }
+    AsyncCallbackWebHandler &on(const char *uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest, ArUploadHandlerFunction onUpload = nullptr, ArBodyHandlerFunction onBody = nullptr);
+    void onNotFound(ArRequestHandlerFunction fn) { notFound = fn; }
+
+    // For the harness: the server begin() started on port, nullptr if none
+    static AsyncWebServer *running(uint16_t port);
+    template <typename T>
+    T *findHandler() const
+    {
+        for (AsyncWebHandler *handler : handlers)
+        {
+            if (T *found = dynamic_cast<T *>(handler))
+            {
+                return found;
+            }
+        }
+        return nullptr;
+    }
+    // Runs the request like the network would: the first handler that takes
+    // it gets the body in TCP sized parts, then handleRequest()
+    void dispatch(AsyncWebServerRequest *request);
+
+private:
+    uint16_t port;
+    bool started = false;
+    std::vector<AsyncWebHandler *> handlers;
+    std::vector<AsyncCallbackWebHandler *> owned;
+    ArRequestHandlerFunction notFound;
+};
+
+typedef enum
+{
+    WS_EVT_CONNECT,
+    WS_EVT_DISCONNECT,
+    WS_EVT_PONG,
+    WS_EVT_ERROR,
+    WS_EVT_DATA
+} AwsEventType;
+
+#define WS_CONTINUATION 0x00
+#define WS_TEXT 0x01
+#define WS_BINARY 0x02
+#define WS_DISCONNECT 0x08
+
+typedef struct
+{
+    uint8_t message_opcode;
+    uint32_t num;
+    uint8_t final;
+    uint8_t masked;
+    uint8_t opcode;
+    uint64_t len;
+    uint8_t mask[4];
+    uint64_t index;
+} AwsFrameInfo;
+
+class AsyncWebSocket;
+
+class AsyncWebSocketClient
+{
+public:
+    AsyncWebSocketClient(AsyncWebSocket *server, uint32_t id, IPAddress ip) : owner(server), clientId(id), ip(ip) {}
+    uint32_t id() const { return clientId; }
+    IPAddress remoteIP() const { return ip; }
+    AsyncWebSocket *server() { return owner; }
+    size_t queueLen() const { return 0; }
+    bool canSend() const { return true; }
+    void text(const char *message, size_t len);
+    void text(const char *message) { text(message, strlen(message)); }
+    void text(const String &message) { text(message.c_str(), message.length()); }
+    void close(uint16_t code = 0, const char *message = nullptr) { closing = true; }
+
+    // For the harness
+    bool closed() const { return closing; }
+    uint32_t messages = 0;
+    uint64_t bytes = 0;
+    std::string last; // last message received
+
+private:
+    AsyncWebSocket *owner;
+    uint32_t clientId;
+    IPAddress ip;
+    bool closing = false;
+};
+
+typedef std::function<void(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len)> AwsEventHandler;
+
+class AsyncWebSocket : public AsyncWebHandler
+{
+public:
+    explicit AsyncWebSocket(const String &url) : path(url) {}
+    ~AsyncWebSocket();
+    const char *url() const { return path.c_str(); }
+    void onEvent(AwsEventHandler handler) { eventHandler = handler; }
+    size_t count() const;
+    AsyncWebSocketClient *client(uint32_t id);
+    void textAll(const char *message, size_t len);
+    void textAll(const String &message) { textAll(message.c_str(), message.length()); }
+    void cleanupClients(uint16_t maxClients = 8) { reap(); }
+
+    // For the harness: a browser opening the socket, sending a text message
+    // and going away. Clients the server closed go away in reap().
+    AsyncWebSocketClient *connect(IPAddress ip);
+    void message(AsyncWebSocketClient *client, const char *text, size_t len);
+    void disconnect(AsyncWebSocketClient *client);
+    void reap();
+    const std::vector<AsyncWebSocketClient *> &getClients() const { return clients; }
+
+private:
+    String path;
+    AwsEventHandler eventHandler;
+    std::vector<AsyncWebSocketClient *> clients;
+    uint32_t nextId = 1;
+};
+
+class AsyncEventSource;
+
+class AsyncEventSourceClient
+{
+public:
+    AsyncEventSourceClient(AsyncEventSource *server, IPAddress ip) : owner(server), ip(ip) {}
+    void send(const char *message, const char *event = nullptr, uint32_t id = 0, uint32_t reconnect = 0);
+    void close() { closing = true; }
+    bool connected() const { return !closing; }
+    uint32_t lastId() const { return lastEventId; }
+    size_t packetsWaiting() const { return 0; }
+
+    // For the harness
+    uint32_t messages = 0;
+    uint64_t bytes = 0;
+
+private:
+    AsyncEventSource *owner;
+    IPAddress ip;
+    uint32_t lastEventId = 0;
+    bool closing = false;
+};
+
+typedef std::function<void(AsyncEventSourceClient *client)> ArEventHandlerFunction;
+
+class AsyncEventSource : public AsyncWebHandler
+{
+public:
+    explicit AsyncEventSource(const String &url) : path(url) {}
+    ~AsyncEventSource();
+    const char *url() const { return path.c_str(); }
+    void onConnect(ArEventHandlerFunction handler) { connectHandler = handler; }
+    size_t count() const;
+    void send(const char *message, const char *event = nullptr, uint32_t id = 0, uint32_t reconnect = 0);
+
+    // For the harness, like AsyncWebSocket
+    AsyncEventSourceClient *connect(IPAddress ip);
+    void disconnect(AsyncEventSourceClient *client);
+    void reap();
+
+private:
+    String path;
+    ArEventHandlerFunction connectHandler;
+    std::vector<AsyncEventSourceClient *> clients;
+};
+
+#endif // ESPWEBC_HOST_ESPASYNCWEBSERVER_H
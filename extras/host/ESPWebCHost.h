@@ -0,0 +1,45 @@
+// Controls of the host build for extras/soak_host.cpp: the simulated clock
+// and the heap counters behind ESP.getFreeHeap().
+#ifndef ESPWEBC_HOST_H
+#define ESPWEBC_HOST_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef ESPWEBC_HOST_HEAP_SIZE
+#define ESPWEBC_HOST_HEAP_SIZE (300 * 1024) // heap the device would have free at boot
+#endif
+
+namespace ESPWebCHost
+{
+    // millis() and micros() follow the real time plus every skip(), so
+    // handlers are timed for real and idle time costs nothing
+    void skip(unsigned long ms);
+
+    // Every malloc() and operator new of the process is counted, except what
+    // the fake network and file system allocate for themselves (Untracked)
+    struct HeapStats
+    {
+        uint64_t allocations; // blocks allocated so far
+        uint64_t frees;
+        size_t blocks;        // blocks still allocated
+        size_t bytes;         // bytes still allocated
+        size_t peakBytes;     // most bytes allocated at once since resetPeak()
+    };
+    HeapStats heap();
+    void resetPeak();
+
+    // Allocations made while one is alive are not counted, nor their free().
+    // Used by the fake network and file system, which stand for buffers the
+    // device has outside of the library or in flash.
+    class Untracked
+    {
+    public:
+        Untracked();
+        ~Untracked();
+        Untracked(const Untracked &) = delete;
+        Untracked &operator=(const Untracked &) = delete;
+    };
+}
+
+#endif // ESPWEBC_HOST_H
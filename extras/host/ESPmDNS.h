@@ -0,0 +1,14 @@
+#ifndef ESPWEBC_HOST_ESPMDNS_H
+#define ESPWEBC_HOST_ESPMDNS_H
+
+#include <Arduino.h>
+
+class MDNSResponder
+{
+public:
+    bool begin(const char *hostName) { return true; }
+    void addService(const char *service, const char *proto, uint16_t port) {}
+};
+extern MDNSResponder MDNS;
+
+#endif // ESPWEBC_HOST_ESPMDNS_H
@@ -0,0 +1,63 @@
+// Host build of the Arduino FS API on an in-memory file system, see host.cpp.
+// File contents are not counted as heap, they would be in flash.
+#ifndef ESPWEBC_HOST_FS_H
+#define ESPWEBC_HOST_FS_H
+
+#include <Arduino.h>
+#include <memory>
+
+namespace fs
+{
+    struct FileImpl;
+
+    class File : public Stream
+    {
+    public:
+        File() {}
+        explicit File(std::shared_ptr<FileImpl> impl) : impl(impl) {}
+
+        size_t write(uint8_t c) override { return write(&c, 1); }
+        size_t write(const uint8_t *buffer, size_t size) override;
+        using Print::write;
+        int available() override;
+        int read() override;
+        int peek() override;
+        size_t read(uint8_t *buffer, size_t size);
+        bool seek(uint32_t pos);
+        size_t position() const;
+        size_t size() const;
+        void flush() {}
+        void close() { impl.reset(); }
+
+        explicit operator bool() const { return impl != nullptr; }
+        const char *name() const;
+        const char *path() const;
+        bool isDirectory() const;
+        File openNextFile(const char *mode = "r");
+
+    private:
+        std::shared_ptr<FileImpl> impl;
+    };
+
+    class FS
+    {
+    public:
+        File open(const char *path, const char *mode = "r", bool create = false);
+        File open(const String &path, const char *mode = "r", bool create = false) { return open(path.c_str(), mode, create); }
+        bool exists(const char *path);
+        bool exists(const String &path) { return exists(path.c_str()); }
+        bool remove(const char *path);
+        bool remove(const String &path) { return remove(path.c_str()); }
+        bool rename(const char *from, const char *to);
+        bool rename(const String &from, const String &to) { return rename(from.c_str(), to.c_str()); }
+        bool mkdir(const char *path);
+        bool mkdir(const String &path) { return mkdir(path.c_str()); }
+        bool rmdir(const char *path);
+        bool rmdir(const String &path) { return rmdir(path.c_str()); }
+    };
+}
+
+using fs::File;
+using fs::FS;
+
+#endif // ESPWEBC_HOST_FS_H
@@ -0,0 +1,43 @@
+#ifndef ESPWEBC_HOST_IPADDRESS_H
+#define ESPWEBC_HOST_IPADDRESS_H
+
+#include <Arduino.h>
+
+class IPAddress
+{
+public:
+    IPAddress() {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : bytes{a, b, c, d} {}
+    explicit IPAddress(uint32_t address) { memcpy(bytes, &address, 4); }
+    operator uint32_t() const
+    {
+        uint32_t address;
+        memcpy(&address, bytes, 4);
+        return address;
+    }
+    uint8_t operator[](int index) const { return bytes[index]; }
+    uint8_t &operator[](int index) { return bytes[index]; }
+    bool operator==(const IPAddress &other) const { return memcmp(bytes, other.bytes, 4) == 0; }
+    bool operator!=(const IPAddress &other) const { return !(*this == other); }
+    bool fromString(const char *text)
+    {
+        unsigned a, b, c, d;
+        if (sscanf(text, "%u.%u.%u.%u", &a, &b, &c, &d) != 4 || a > 255 || b > 255 || c > 255 || d > 255)
+        {
+            return false;
+        }
+        *this = IPAddress(a, b, c, d);
+        return true;
+    }
+    String toString() const
+    {
+        char text[16];
+        snprintf(text, sizeof(text), "%u.%u.%u.%u", bytes[0], bytes[1], bytes[2], bytes[3]);
+        return String(text);
+    }
+
+private:
+    uint8_t bytes[4] = {0, 0, 0, 0};
+};
+
+#endif // ESPWEBC_HOST_IPADDRESS_H
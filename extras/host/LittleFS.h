@@ -0,0 +1,15 @@
+#ifndef ESPWEBC_HOST_LITTLEFS_H
+#define ESPWEBC_HOST_LITTLEFS_H
+
+#include <FS.h>
+
+class LittleFSFS : public fs::FS
+{
+public:
+    bool begin(bool formatOnFail = false) { return true; }
+    bool format();
+    void end() {}
+};
+extern LittleFSFS LittleFS;
+
+#endif // ESPWEBC_HOST_LITTLEFS_H
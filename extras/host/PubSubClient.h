@@ -0,0 +1,24 @@
+// Host build of PubSubClient: there is no broker, connect() fails
+#ifndef ESPWEBC_HOST_PUBSUBCLIENT_H
+#define ESPWEBC_HOST_PUBSUBCLIENT_H
+
+#include <WiFi.h>
+#include <functional>
+
+class PubSubClient
+{
+public:
+    typedef std::function<void(char *, uint8_t *, unsigned int)> Callback;
+    PubSubClient &setClient(Client &client) { return *this; }
+    PubSubClient &setServer(const char *domain, uint16_t port) { return *this; }
+    PubSubClient &setCallback(Callback callback) { return *this; }
+    bool connect(const char *id, const char *user, const char *pass) { return false; }
+    bool connected() { return false; }
+    bool subscribe(const char *topic) { return false; }
+    bool publish(const char *topic, const char *payload) { return false; }
+    bool publish(const char *topic, const char *payload, bool retained) { return false; }
+    bool loop() { return false; }
+    int state() { return -2; } // MQTT_CONNECT_FAILED
+};
+
+#endif // ESPWEBC_HOST_PUBSUBCLIENT_H
@@ -0,0 +1,21 @@
+// Host build of Update: firmware is accepted and discarded
+#ifndef ESPWEBC_HOST_UPDATE_H
+#define ESPWEBC_HOST_UPDATE_H
+
+#include <Arduino.h>
+
+#define UPDATE_SIZE_UNKNOWN 0xFFFFFFFF
+
+class UpdateClass
+{
+public:
+    bool begin(size_t size = UPDATE_SIZE_UNKNOWN) { return true; }
+    size_t write(uint8_t *data, size_t length) { return length; }
+    bool end(bool evenIfRemaining = false) { return true; }
+    bool hasError() const { return false; }
+    bool isFinished() const { return true; }
+    void printError(Print &out) {}
+};
+extern UpdateClass Update;
+
+#endif // ESPWEBC_HOST_UPDATE_H
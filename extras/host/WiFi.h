@@ -0,0 +1,63 @@
+// Host build of the WiFi API: always connected, no radio
+#ifndef ESPWEBC_HOST_WIFI_H
+#define ESPWEBC_HOST_WIFI_H
+
+#include <Arduino.h>
+#include "IPAddress.h"
+
+#define WIFI_OFF 0
+#define WIFI_STA 1
+#define WIFI_AP 2
+#define WIFI_AP_STA 3
+#define WL_CONNECTED 3
+#define WL_DISCONNECTED 6
+
+class Client : public Stream
+{
+public:
+    virtual int connect(IPAddress ip, uint16_t port) { return 0; }
+    virtual int connect(const char *host, uint16_t port) { return 0; }
+    virtual uint8_t connected() { return 0; }
+    virtual void stop() {}
+    virtual int read(uint8_t *buffer, size_t size) { return -1; }
+    size_t write(uint8_t) override { return 0; }
+    using Print::write;
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+    virtual void flush() {}
+};
+
+class WiFiClient : public Client
+{
+};
+
+class WiFiClass
+{
+public:
+    bool mode(int m)
+    {
+        wifiMode = m;
+        return true;
+    }
+    int getMode() const { return wifiMode; }
+    bool setSleep(bool) { return true; }
+    int begin(const char *ssid, const char *password) { return WL_CONNECTED; }
+    int status() const { return WL_CONNECTED; }
+    bool isConnected() const { return true; }
+    bool disconnect(bool wifiOff = false) { return true; }
+    bool softAP(const char *ssid, const char *password = nullptr) { return true; }
+    String macAddress() const { return "02:00:00:00:00:01"; }
+    String softAPmacAddress() const { return "02:00:00:00:00:02"; }
+    IPAddress localIP() const { return IPAddress(127, 0, 0, 1); }
+    IPAddress softAPIP() const { return IPAddress(192, 168, 4, 1); }
+    int32_t channel() const { return 1; }
+    int8_t RSSI() const { return -60; }
+    int hostByName(const char *host, IPAddress &ip) { return ip.fromString(host) ? 1 : 0; }
+
+private:
+    int wifiMode = WIFI_STA;
+};
+extern WiFiClass WiFi;
+
+#endif // ESPWEBC_HOST_WIFI_H
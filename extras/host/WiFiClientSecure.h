@@ -0,0 +1,12 @@
+#ifndef ESPWEBC_HOST_WIFICLIENTSECURE_H
+#define ESPWEBC_HOST_WIFICLIENTSECURE_H
+
+#include <WiFi.h>
+
+class WiFiClientSecure : public WiFiClient
+{
+public:
+    void setInsecure() {}
+};
+
+#endif // ESPWEBC_HOST_WIFICLIENTSECURE_H
@@ -0,0 +1,71 @@
+// Host build of WiFiUDP: packets go nowhere, the ones given to deliver()
+// arrive on every socket in turn
+#ifndef ESPWEBC_HOST_WIFIUDP_H
+#define ESPWEBC_HOST_WIFIUDP_H
+
+#include <WiFi.h>
+#include <deque>
+#include <string>
+
+class WiFiUDP : public Stream
+{
+public:
+    uint8_t begin(uint16_t port) { return 1; }
+    uint8_t beginMulticast(IPAddress group, uint16_t port) { return 1; }
+    void stop() {}
+    int beginPacket(IPAddress ip, uint16_t port) { return 1; }
+    int beginPacket(const char *host, uint16_t port) { return 1; }
+    int beginMulticastPacket() { return 1; }
+    int endPacket() { return 1; }
+    size_t write(uint8_t) override { return 1; }
+    size_t write(const uint8_t *buffer, size_t size) override { return size; }
+    using Print::write;
+
+    // Queues a packet for the next parsePacket()
+    static void deliver(const uint8_t *data, size_t size, IPAddress from, uint16_t port)
+    {
+        inbox().push_back(Packet{std::string((const char *)data, size), from, port});
+    }
+
+    int parsePacket()
+    {
+        if (inbox().empty())
+        {
+            return 0;
+        }
+        current = inbox().front();
+        inbox().pop_front();
+        offset = 0;
+        return current.data.size();
+    }
+    int available() override { return current.data.size() - offset; }
+    int read() override { return available() > 0 ? (uint8_t)current.data[offset++] : -1; }
+    int read(uint8_t *buffer, size_t size)
+    {
+        size_t n = size < (size_t)available() ? size : available();
+        memcpy(buffer, current.data.data() + offset, n);
+        offset += n;
+        return n;
+    }
+    int read(char *buffer, size_t size) { return read((uint8_t *)buffer, size); }
+    int peek() override { return available() > 0 ? (uint8_t)current.data[offset] : -1; }
+    IPAddress remoteIP() const { return current.from; }
+    uint16_t remotePort() const { return current.port; }
+
+private:
+    struct Packet
+    {
+        std::string data;
+        IPAddress from;
+        uint16_t port;
+    };
+    static std::deque<Packet> &inbox()
+    {
+        static std::deque<Packet> packets;
+        return packets;
+    }
+    Packet current = Packet{std::string(), IPAddress(), 0};
+    size_t offset = 0;
+};
+
+#endif // ESPWEBC_HOST_WIFIUDP_H
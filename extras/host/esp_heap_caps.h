@@ -0,0 +1,27 @@
+#ifndef ESPWEBC_HOST_HEAP_CAPS_H
+#define ESPWEBC_HOST_HEAP_CAPS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_DEFAULT (1 << 12)
+
+typedef struct
+{
+    size_t total_free_bytes;
+    size_t total_allocated_bytes;
+    size_t largest_free_block;
+    size_t minimum_free_bytes;
+    size_t allocated_blocks;
+    size_t free_blocks;
+    size_t total_blocks;
+} multi_heap_info_t;
+
+// Filled from the heap counters of host.cpp, there is no fragmentation:
+// the largest free block is all of the free heap
+void heap_caps_get_info(multi_heap_info_t *info, uint32_t caps);
+size_t heap_caps_get_largest_free_block(uint32_t caps);
+
+#endif // ESPWEBC_HOST_HEAP_CAPS_H
@@ -0,0 +1,4 @@
+#ifndef ESPWEBC_HOST_ESP_TASK_WDT_H
+#define ESPWEBC_HOST_ESP_TASK_WDT_H
+
+#endif // ESPWEBC_HOST_ESP_TASK_WDT_H
@@ -0,0 +1,12 @@
+#ifndef ESPWEBC_HOST_SEMPHR_H
+#define ESPWEBC_HOST_SEMPHR_H
+
+#include "FreeRTOS.h"
+
+typedef void *SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateMutex();
+BaseType_t xSemaphoreTake(SemaphoreHandle_t mutex, TickType_t ticks);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t mutex);
+
+#endif // ESPWEBC_HOST_SEMPHR_H
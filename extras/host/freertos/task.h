@@ -0,0 +1,14 @@
+#ifndef ESPWEBC_HOST_TASK_H
+#define ESPWEBC_HOST_TASK_H
+
+#include "FreeRTOS.h"
+
+typedef void *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char *name, uint32_t stackDepth, void *arg, UBaseType_t priority, TaskHandle_t *handle, BaseType_t core);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks);
+void vTaskDelay(TickType_t ticks);
+
+#endif // ESPWEBC_HOST_TASK_H
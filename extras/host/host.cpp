@@ -0,0 +1,779 @@
+#include <Arduino.h>
+#include <ESPmDNS.h>
+#include <LittleFS.h>
+#include <Update.h>
+#include <WiFi.h>
+#include "ESPWebCHost.h"
+
+#include <malloc.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+HardwareSerial Serial;
+EspClass ESP;
+WiFiClass WiFi;
+MDNSResponder MDNS;
+UpdateClass Update;
+LittleFSFS LittleFS;
+
+// ---- Heap counters ----
+//
+// malloc() and friends are replaced for the whole process. Each block gets a
+// header with the start of the real allocation and the size, the top bit of
+// the size marks blocks allocated under ESPWebCHost::Untracked.
+
+extern "C"
+{
+    void *__libc_malloc(size_t size);
+    void *__libc_memalign(size_t alignment, size_t size);
+    void __libc_free(void *ptr);
+}
+
+namespace
+{
+    struct Header
+    {
+        void *base;
+        size_t size;
+    };
+    const size_t HEADER = 16; // keeps malloc()'s 16 byte alignment
+    const size_t UNTRACKED = (size_t)1 << (sizeof(size_t) * 8 - 1);
+
+    std::atomic<uint64_t> allocations(0);
+    std::atomic<uint64_t> frees(0);
+    std::atomic<size_t> liveBlocks(0);
+    std::atomic<size_t> liveBytes(0);
+    std::atomic<size_t> peakBytes(0);
+    std::atomic<size_t> lowestFree(ESPWEBC_HOST_HEAP_SIZE);
+    thread_local int untrackedDepth = 0;
+
+    Header *header(void *ptr)
+    {
+        return (Header *)((char *)ptr - HEADER);
+    }
+
+    void *track(void *base, size_t alignment, size_t size)
+    {
+        if (base == nullptr)
+        {
+            return nullptr;
+        }
+        char *ptr = (char *)base + (alignment > HEADER ? alignment : HEADER);
+        Header *h = header(ptr);
+        h->base = base;
+        h->size = size;
+        if (untrackedDepth > 0)
+        {
+            h->size |= UNTRACKED;
+            return ptr;
+        }
+        allocations++;
+        liveBlocks++;
+        size_t now = liveBytes += size;
+        size_t peak = peakBytes;
+        while (now > peak && !peakBytes.compare_exchange_weak(peak, now))
+        {
+        }
+        size_t free = now < ESPWEBC_HOST_HEAP_SIZE ? ESPWEBC_HOST_HEAP_SIZE - now : 0;
+        size_t lowest = lowestFree;
+        while (free < lowest && !lowestFree.compare_exchange_weak(lowest, free))
+        {
+        }
+        return ptr;
+    }
+
+    void *allocate(size_t alignment, size_t size)
+    {
+        if (alignment <= HEADER)
+        {
+            return track(__libc_malloc(size + HEADER), HEADER, size);
+        }
+        return track(__libc_memalign(alignment, size + alignment), alignment, size);
+    }
+
+    size_t sizeOf(void *ptr)
+    {
+        return header(ptr)->size & ~UNTRACKED;
+    }
+
+    void release(void *ptr)
+    {
+        if (ptr == nullptr)
+        {
+            return;
+        }
+        Header *h = header(ptr);
+        if (!(h->size & UNTRACKED))
+        {
+            frees++;
+            liveBlocks--;
+            liveBytes -= h->size;
+        }
+        __libc_free(h->base);
+    }
+}
+
+extern "C"
+{
+    void *malloc(size_t size)
+    {
+        return allocate(HEADER, size);
+    }
+
+    void free(void *ptr)
+    {
+        release(ptr);
+    }
+
+    void *calloc(size_t count, size_t size)
+    {
+        if (size != 0 && count > (size_t)-1 / size)
+        {
+            return nullptr;
+        }
+        void *ptr = allocate(HEADER, count * size);
+        if (ptr != nullptr)
+        {
+            memset(ptr, 0, count * size);
+        }
+        return ptr;
+    }
+
+    // Moves the block, so each growth counts like it does with the ESP32 heap
+    void *realloc(void *ptr, size_t size)
+    {
+        if (ptr == nullptr)
+        {
+            return malloc(size);
+        }
+        if (size == 0)
+        {
+            free(ptr);
+            return nullptr;
+        }
+        // A block keeps the accounting it was allocated with
+        int depth = untrackedDepth;
+        untrackedDepth = (header(ptr)->size & UNTRACKED) ? 1 : 0;
+        void *moved = allocate(HEADER, size);
+        untrackedDepth = depth;
+        if (moved != nullptr)
+        {
+            memcpy(moved, ptr, std::min(size, sizeOf(ptr)));
+            free(ptr);
+        }
+        return moved;
+    }
+
+    void *memalign(size_t alignment, size_t size)
+    {
+        return allocate(alignment, size);
+    }
+
+    void *aligned_alloc(size_t alignment, size_t size)
+    {
+        return allocate(alignment, size);
+    }
+
+    int posix_memalign(void **out, size_t alignment, size_t size)
+    {
+        void *ptr = allocate(alignment, size);
+        if (ptr == nullptr)
+        {
+            return ENOMEM;
+        }
+        *out = ptr;
+        return 0;
+    }
+
+    void *valloc(size_t size)
+    {
+        return allocate(4096, size);
+    }
+
+    void *pvalloc(size_t size)
+    {
+        return allocate(4096, (size + 4095) & ~(size_t)4095);
+    }
+
+    size_t malloc_usable_size(void *ptr)
+    {
+        return ptr ? sizeOf(ptr) : 0;
+    }
+}
+
+namespace ESPWebCHost
+{
+    HeapStats heap()
+    {
+        return {allocations, frees, liveBlocks, liveBytes, peakBytes};
+    }
+
+    void resetPeak()
+    {
+        peakBytes = liveBytes.load();
+    }
+
+    Untracked::Untracked()
+    {
+        untrackedDepth++;
+    }
+
+    Untracked::~Untracked()
+    {
+        untrackedDepth--;
+    }
+}
+
+uint32_t EspClass::getHeapSize()
+{
+    return ESPWEBC_HOST_HEAP_SIZE;
+}
+
+uint32_t EspClass::getFreeHeap()
+{
+    size_t used = liveBytes;
+    return used < ESPWEBC_HOST_HEAP_SIZE ? ESPWEBC_HOST_HEAP_SIZE - used : 0;
+}
+
+uint32_t EspClass::getMinFreeHeap()
+{
+    return lowestFree;
+}
+
+uint32_t EspClass::getMaxAllocHeap()
+{
+    return getFreeHeap();
+}
+
+void EspClass::restart()
+{
+    fprintf(stderr, "ESP.restart() called\n");
+    exit(2);
+}
+
+void heap_caps_get_info(multi_heap_info_t *info, uint32_t caps)
+{
+    memset(info, 0, sizeof(*info));
+    info->total_free_bytes = ESP.getFreeHeap();
+    info->total_allocated_bytes = liveBytes;
+    info->largest_free_block = info->total_free_bytes;
+    info->minimum_free_bytes = lowestFree;
+    info->allocated_blocks = liveBlocks;
+    info->free_blocks = 1;
+    info->total_blocks = info->allocated_blocks + 1;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps)
+{
+    return ESP.getFreeHeap();
+}
+
+// ---- Clock ----
+
+namespace
+{
+    const std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+    std::atomic<uint64_t> skippedUs(0);
+
+    uint64_t nowUs()
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started).count() + skippedUs;
+    }
+}
+
+void ESPWebCHost::skip(unsigned long ms)
+{
+    skippedUs += (uint64_t)ms * 1000;
+}
+
+unsigned long millis()
+{
+    return nowUs() / 1000;
+}
+
+unsigned long micros()
+{
+    return nowUs();
+}
+
+void delay(unsigned long ms)
+{
+    ESPWebCHost::skip(ms);
+    std::this_thread::yield();
+}
+
+void yield()
+{
+    std::this_thread::yield();
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {}
+void digitalWrite(uint8_t pin, uint8_t value) {}
+int digitalRead(uint8_t pin) { return LOW; }
+int analogRead(uint8_t pin) { return 0; }
+
+long random(long max)
+{
+    return max > 0 ? rand() % max : 0;
+}
+
+long random(long min, long max)
+{
+    return min < max ? min + random(max - min) : min;
+}
+
+// ---- FreeRTOS ----
+
+namespace
+{
+    struct Task
+    {
+        std::mutex lock;
+        std::condition_variable wake;
+        uint32_t notifications = 0;
+    };
+    thread_local Task *currentTask = nullptr;
+
+    uint32_t threadToken()
+    {
+        static std::atomic<uint32_t> next(1);
+        thread_local uint32_t token = next++;
+        return token;
+    }
+}
+
+void portENTER_CRITICAL(portMUX_TYPE *mux)
+{
+    uint32_t me = threadToken();
+    if (__atomic_load_n(&mux->owner, __ATOMIC_ACQUIRE) == me)
+    {
+        mux->count++;
+        return;
+    }
+    uint32_t expected = 0;
+    while (!__atomic_compare_exchange_n(&mux->owner, &expected, me, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+    {
+        expected = 0;
+        std::this_thread::yield();
+    }
+    mux->count = 1;
+}
+
+void portEXIT_CRITICAL(portMUX_TYPE *mux)
+{
+    if (--mux->count == 0)
+    {
+        __atomic_store_n(&mux->owner, 0, __ATOMIC_RELEASE);
+    }
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex()
+{
+    return new std::timed_mutex();
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t mutex, TickType_t ticks)
+{
+    std::timed_mutex *m = (std::timed_mutex *)mutex;
+    if (ticks == portMAX_DELAY)
+    {
+        m->lock();
+        return pdTRUE;
+    }
+    return m->try_lock_for(std::chrono::milliseconds(ticks)) ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t mutex)
+{
+    ((std::timed_mutex *)mutex)->unlock();
+    return pdTRUE;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char *name, uint32_t stackDepth, void *arg, UBaseType_t priority, TaskHandle_t *handle, BaseType_t core)
+{
+    Task *state = new Task();
+    if (handle != nullptr)
+    {
+        *handle = state;
+    }
+    std::thread([task, arg, state]()
+                {
+        currentTask = state;
+        task(arg); })
+        .detach();
+    return pdPASS;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t handle)
+{
+    Task *task = (Task *)handle;
+    std::lock_guard<std::mutex> guard(task->lock);
+    task->notifications++;
+    task->wake.notify_one();
+    return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks)
+{
+    Task *task = currentTask;
+    if (task == nullptr)
+    {
+        return 0;
+    }
+    std::unique_lock<std::mutex> guard(task->lock);
+    auto ready = [task]()
+    { return task->notifications > 0; };
+    if (ticks == portMAX_DELAY)
+    {
+        task->wake.wait(guard, ready);
+    }
+    else
+    {
+        task->wake.wait_for(guard, std::chrono::milliseconds(ticks), ready);
+    }
+    uint32_t count = task->notifications;
+    task->notifications = clearOnExit ? 0 : (count ? count - 1 : 0);
+    return count;
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    delay(ticks);
+}
+
+// ---- Print and String ----
+
+size_t Print::printf(const char *format, ...)
+{
+    char buffer[128];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (len < 0)
+    {
+        return 0;
+    }
+    if ((size_t)len < sizeof(buffer))
+    {
+        return write((const uint8_t *)buffer, len);
+    }
+    std::vector<char> big(len + 1);
+    va_start(args, format);
+    vsnprintf(big.data(), big.size(), format, args);
+    va_end(args);
+    return write((const uint8_t *)big.data(), len);
+}
+
+size_t Print::print(long n, int base)
+{
+    if (base == DEC)
+    {
+        return printf("%ld", n);
+    }
+    return print((unsigned long)n, base);
+}
+
+size_t Print::print(unsigned long n, int base)
+{
+    return printf(base == HEX ? "%lX" : "%lu", n);
+}
+
+size_t Print::print(double n, int digits)
+{
+    return printf("%.*f", digits, n);
+}
+
+String::String(long n, unsigned char base)
+{
+    char text[24];
+    snprintf(text, sizeof(text), base == HEX ? "%lx" : "%ld", n);
+    s = text;
+}
+
+String::String(unsigned long n, unsigned char base)
+{
+    char text[24];
+    snprintf(text, sizeof(text), base == HEX ? "%lx" : "%lu", n);
+    s = text;
+}
+
+String::String(double n, unsigned int digits)
+{
+    char text[48];
+    snprintf(text, sizeof(text), "%.*f", (int)digits, n);
+    s = text;
+}
+
+void String::replace(const String &find, const String &with)
+{
+    if (find.s.empty())
+    {
+        return;
+    }
+    for (size_t pos = s.find(find.s); pos != std::string::npos; pos = s.find(find.s, pos + with.s.size()))
+    {
+        s.replace(pos, find.s.size(), with.s);
+    }
+}
+
+void String::trim()
+{
+    size_t first = s.find_first_not_of(" \t\r\n");
+    if (first == std::string::npos)
+    {
+        s.clear();
+        return;
+    }
+    s = s.substr(first, s.find_last_not_of(" \t\r\n") - first + 1);
+}
+
+// ---- File system ----
+
+namespace fs
+{
+    struct FileImpl
+    {
+        std::string path;
+        std::shared_ptr<std::vector<uint8_t>> data; // nullptr for a directory
+        size_t pos = 0;
+        bool writable = false;
+        std::vector<std::string> children;
+        size_t nextChild = 0;
+    };
+}
+
+namespace
+{
+    struct Store
+    {
+        std::map<std::string, std::shared_ptr<std::vector<uint8_t>>> files;
+        std::map<std::string, bool> dirs;
+    };
+
+    Store &store()
+    {
+        static Store *instance = nullptr;
+        if (instance == nullptr)
+        {
+            ESPWebCHost::Untracked untracked;
+            instance = new Store();
+            instance->dirs["/"] = true;
+        }
+        return *instance;
+    }
+
+    std::string parentOf(const std::string &path)
+    {
+        size_t slash = path.rfind('/');
+        return slash == 0 || slash == std::string::npos ? "/" : path.substr(0, slash);
+    }
+}
+
+namespace fs
+{
+    size_t File::write(const uint8_t *buffer, size_t size)
+    {
+        if (!impl || !impl->writable)
+        {
+            return 0;
+        }
+        ESPWebCHost::Untracked untracked;
+        std::vector<uint8_t> &data = *impl->data;
+        if (impl->pos + size > data.size())
+        {
+            data.resize(impl->pos + size);
+        }
+        memcpy(data.data() + impl->pos, buffer, size);
+        impl->pos += size;
+        return size;
+    }
+
+    size_t File::read(uint8_t *buffer, size_t size)
+    {
+        if (!impl || !impl->data || impl->pos >= impl->data->size())
+        {
+            return 0;
+        }
+        size = std::min(size, impl->data->size() - impl->pos);
+        memcpy(buffer, impl->data->data() + impl->pos, size);
+        impl->pos += size;
+        return size;
+    }
+
+    int File::available()
+    {
+        return impl && impl->data ? impl->data->size() - std::min(impl->pos, impl->data->size()) : 0;
+    }
+
+    int File::read()
+    {
+        uint8_t c;
+        return read(&c, 1) == 1 ? c : -1;
+    }
+
+    int File::peek()
+    {
+        return available() > 0 ? (*impl->data)[impl->pos] : -1;
+    }
+
+    bool File::seek(uint32_t pos)
+    {
+        if (!impl || !impl->data || pos > impl->data->size())
+        {
+            return false;
+        }
+        impl->pos = pos;
+        return true;
+    }
+
+    size_t File::position() const
+    {
+        return impl ? impl->pos : 0;
+    }
+
+    size_t File::size() const
+    {
+        return impl && impl->data ? impl->data->size() : 0;
+    }
+
+    const char *File::name() const
+    {
+        if (!impl)
+        {
+            return "";
+        }
+        size_t slash = impl->path.rfind('/');
+        return impl->path.c_str() + (slash == std::string::npos ? 0 : slash + 1);
+    }
+
+    const char *File::path() const
+    {
+        return impl ? impl->path.c_str() : "";
+    }
+
+    bool File::isDirectory() const
+    {
+        return impl && !impl->data;
+    }
+
+    File File::openNextFile(const char *mode)
+    {
+        if (!impl || impl->data || impl->nextChild >= impl->children.size())
+        {
+            return File();
+        }
+        return LittleFS.open(impl->children[impl->nextChild++].c_str(), mode);
+    }
+
+    File FS::open(const char *path, const char *mode, bool create)
+    {
+        ESPWebCHost::Untracked untracked;
+        Store &fs = store();
+        std::shared_ptr<FileImpl> impl(new FileImpl());
+        impl->path = path;
+        if (fs.dirs.count(path))
+        {
+            for (auto &file : fs.files)
+            {
+                if (parentOf(file.first) == impl->path)
+                {
+                    impl->children.push_back(file.first);
+                }
+            }
+            for (auto &dir : fs.dirs)
+            {
+                if (dir.first != "/" && dir.first != impl->path && parentOf(dir.first) == impl->path)
+                {
+                    impl->children.push_back(dir.first);
+                }
+            }
+            return File(impl);
+        }
+
+        auto found = fs.files.find(path);
+        if (mode[0] == 'r')
+        {
+            if (found == fs.files.end())
+            {
+                return File();
+            }
+            impl->data = found->second;
+            impl->writable = mode[1] == '+';
+            return File(impl);
+        }
+        if (!fs.dirs.count(parentOf(path)))
+        {
+            return File();
+        }
+        if (found == fs.files.end())
+        {
+            found = fs.files.insert(std::make_pair(std::string(path), std::make_shared<std::vector<uint8_t>>())).first;
+        }
+        impl->data = found->second;
+        impl->writable = true;
+        if (mode[0] == 'w')
+        {
+            impl->data->clear();
+        }
+        else
+        {
+            impl->pos = impl->data->size();
+        }
+        return File(impl);
+    }
+
+    bool FS::exists(const char *path)
+    {
+        ESPWebCHost::Untracked untracked;
+        Store &fs = store();
+        return fs.files.count(path) || fs.dirs.count(path);
+    }
+
+    bool FS::remove(const char *path)
+    {
+        ESPWebCHost::Untracked untracked;
+        return store().files.erase(path) > 0;
+    }
+
+    bool FS::rename(const char *from, const char *to)
+    {
+        ESPWebCHost::Untracked untracked;
+        Store &fs = store();
+        auto found = fs.files.find(from);
+        if (found == fs.files.end())
+        {
+            return false;
+        }
+        fs.files[to] = found->second;
+        fs.files.erase(from);
+        return true;
+    }
+
+    bool FS::mkdir(const char *path)
+    {
+        ESPWebCHost::Untracked untracked;
+        store().dirs[path] = true;
+        return true;
+    }
+
+    bool FS::rmdir(const char *path)
+    {
+        ESPWebCHost::Untracked untracked;
+        return store().dirs.erase(path) > 0;
+    }
+}
+
+bool LittleFSFS::format()
+{
+    ESPWebCHost::Untracked untracked;
+    store().files.clear();
+    store().dirs.clear();
+    store().dirs["/"] = true;
+    return true;
+}
@@ -0,0 +1,363 @@
+// Behaviour checks of ESPWebConnect for Linux, built against the host
+// versions of the Arduino core, FreeRTOS and ESPAsyncWebServer in
+// extras/host like extras/soak_host.cpp. Each check drives a fresh instance
+// through its handlers and prints what failed, the exit status is 1 when
+// any did:
+//
+//   g++ -std=gnu++11 -O2 -I extras/host -I src -I ~/Arduino/libraries/ArduinoJson/src
+//       extras/host_test.cpp extras/host/*.cpp src/*.cpp -o host_test -lpthread
+//
+//   ./host_test
+//
+// Checks of optional features run when their flag is added, eg:
+// -DENABLE_METRICS.
+
+#include "ESPWebConnect.h"
+#include "ESPWebCHost.h"
+#ifdef ENABLE_PEERS
+#include <WiFiUdp.h>
+#endif
+
+#include <stdio.h>
+
+namespace
+{
+    int failures = 0;
+
+#define CHECK(condition)                                                        \
+    do                                                                          \
+    {                                                                           \
+        if (!(condition))                                                       \
+        {                                                                       \
+            printf("  %s:%d: %s\n", __FILE__, __LINE__, #condition);            \
+            failures++;                                                         \
+        }                                                                       \
+    } while (0)
+
+    // Runs a request on the server begin() started, returns the status
+    int send(WebRequestMethodComposite method, const String &url, const String &data, String *body)
+    {
+        AsyncWebServerRequest request(IPAddress(10, 0, 0, 2), method, url);
+        request.setBody(data);
+        AsyncWebServer::running(80)->dispatch(&request);
+        AsyncWebServerResponse *response = request.response();
+        if (response == nullptr)
+        {
+            return 0;
+        }
+        if (body)
+        {
+            char buffer[512];
+            size_t n;
+            *body = "";
+            while ((n = response->read((uint8_t *)buffer, sizeof(buffer), body->length())) > 0)
+            {
+                body->concat(buffer, n);
+            }
+        }
+        return response->code();
+    }
+
+    int get(const String &url, String *body = nullptr)
+    {
+        return send(HTTP_GET, url, String(), body);
+    }
+
+    // commit() on every loop() with the same values keeps the cached readings
+    void unchangedCommitKeepsCache()
+    {
+        ESPWebConnect web;
+        int count = 7;
+        float temperature = 21.5;
+        String status = "idle";
+        bool relay = false;
+        web.addSensor("count", "Count", "", "", &count, "");
+        web.addSensor("temp", "Temperature", "", "", &temperature, "C");
+        web.addSensor("status", "Status", "", "", &status, "");
+        web.addSwitch("relay", "Relay", "", "", &relay);
+        web.begin();
+        web.commit();
+
+        CHECK(get("/allReadings") == 200);
+        ESPWebConnect::ReadingsCacheStats before = web.getReadingsCacheStats();
+        for (int i = 0; i < 20; i++)
+        {
+            web.commit();
+            web.handle();
+            CHECK(get("/allReadings") == 200);
+            ESPWebCHost::skip(10);
+        }
+        ESPWebConnect::ReadingsCacheStats after = web.getReadingsCacheStats();
+        CHECK(after.hits >= before.hits + 20);
+        CHECK(after.misses == before.misses);
+
+        // A changed value is served by the next request
+        status = "running";
+        web.commit();
+        String body;
+        CHECK(get("/allReadings", &body) == 200);
+        CHECK(body.indexOf("\"running\"") >= 0);
+        CHECK(web.getReadingsCacheStats().misses == after.misses + 1);
+    }
+
+    // /events serializes at most once per setAutoUpdate() interval, and with
+    // commit() only when a value changed
+    void eventsFollowTheInterval()
+    {
+        ESPWebConnect web;
+        int count = 0;
+        web.addSensor("count", "Count", "", "", &count, "");
+        web.setAutoUpdate(1000);
+        web.begin();
+        web.commit();
+        AsyncEventSource *events = AsyncWebServer::running(80)->findHandler<AsyncEventSource>();
+        AsyncEventSourceClient *listener = events->connect(IPAddress(10, 0, 0, 3));
+
+        // 5 s of loop() with nothing changed: one event, one serialization
+        ESPWebConnect::ReadingsCacheStats before = web.getReadingsCacheStats();
+        for (int i = 0; i < 500; i++)
+        {
+            web.commit();
+            web.handle();
+            ESPWebCHost::skip(10);
+        }
+        CHECK(listener->messages == 1);
+        CHECK(web.getReadingsCacheStats().misses - before.misses <= 1);
+
+        // 5 s of a value changing on every loop(): one event per interval
+        uint32_t sent = listener->messages;
+        for (int i = 0; i < 500; i++)
+        {
+            count++;
+            web.commit();
+            web.handle();
+            ESPWebCHost::skip(10);
+        }
+        CHECK(listener->messages - sent >= 4 && listener->messages - sent <= 6);
+        events->disconnect(listener);
+    }
+
+    // A switch from the dashboard reaches the readings through commit()
+    void switchPublishedByCommit()
+    {
+        ESPWebConnect web;
+        bool relay = false;
+        web.addSwitch("relay", "Relay", "", "", &relay);
+        web.begin();
+        web.commit();
+
+        CHECK(get("/toggleSwitch?id=relay&state=true") == 200);
+        CHECK(relay);
+        String body;
+        CHECK(get("/allReadings", &body) == 200);
+        CHECK(body.indexOf("\"relay-val\":false") >= 0);
+
+        web.commit();
+        CHECK(get("/allReadings", &body) == 200);
+        CHECK(body.indexOf("\"relay-val\":true") >= 0);
+    }
+
+    // A compact /batch is sized by its entries, numbers may come as strings
+    void batchOfShortEntries()
+    {
+        ESPWebConnect web;
+        static bool relays[64];
+        static char ids[64][4];
+        int level = 0;
+        for (int i = 0; i < 64; i++)
+        {
+            snprintf(ids[i], sizeof(ids[i]), "s%d", i);
+            web.addSwitch(ids[i], "Relay", "", "", &relays[i]);
+        }
+        web.addInputNum("n", "Level", "", "", &level);
+        web.begin();
+
+        String batch = "[";
+        for (int i = 0; i < 64; i++)
+        {
+            batch += String(i ? "," : "") + "{\"id\":\"" + ids[i] + "\",\"value\":1}";
+        }
+        batch += "]";
+        String body;
+        CHECK(send(HTTP_POST, "/batch", batch, &body) == 200);
+        CHECK(body.indexOf("\"applied\":64") >= 0);
+        CHECK(relays[63]);
+
+        CHECK(send(HTTP_POST, "/batch", "[{\"id\":\"n\",\"value\":\"12\"}]", &body) == 200);
+        CHECK(level == 12);
+        CHECK(send(HTTP_POST, "/batch", "[{\"id\":\"n\",\"value\":\"12abc\"}]", &body) == 200);
+        CHECK(body.indexOf("\"status\":400") >= 0);
+        CHECK(level == 12);
+    }
+
+    int schedulerRuns = 0;
+
+    // A slow timer makes the next ones due in the same run(), ids that wrap
+    // around skip the timers still armed
+    void schedulerFollowsTheClock()
+    {
+        ESPWebCScheduler scheduler;
+        scheduler.after(10, []() { ESPWebCHost::skip(100); });
+        scheduler.after(50, []() { schedulerRuns++; });
+        ESPWebCHost::skip(10);
+        scheduler.run(millis());
+        CHECK(schedulerRuns == 1);
+        CHECK(scheduler.size() == 0);
+
+        uint16_t armed = scheduler.every(1000, []() {});
+        bool reused = false;
+        for (uint32_t i = 0; i < 65535; i++)
+        {
+            uint16_t id = scheduler.after(1000, []() {});
+            reused = reused || id == armed || id == 0;
+            scheduler.cancel(id);
+        }
+        CHECK(!reused);
+        CHECK(scheduler.cancel(armed));
+    }
+
+    // ?page= takes a page number and nothing else, setPage() stops at
+    // ESPWEBC_MAX_PAGES instead of wrapping the page of a widget
+    void pageIndexChecked()
+    {
+        ESPWebConnect web;
+        static char names[ESPWEBC_MAX_PAGES + 1][8];
+        static int values[ESPWEBC_MAX_PAGES + 1];
+        bool refused = false;
+        for (int i = 0; i <= ESPWEBC_MAX_PAGES; i++)
+        {
+            snprintf(names[i], sizeof(names[i]), "p%d", i);
+            refused = !web.setPage(names[i]);
+            CHECK(refused == (i == ESPWEBC_MAX_PAGES));
+            web.addSensor(names[i], "Value", "", "", &values[i], "");
+        }
+        web.begin();
+        values[ESPWEBC_MAX_PAGES - 1] = 255;
+        values[ESPWEBC_MAX_PAGES] = 256;
+
+        String body;
+        CHECK(get("/allReadings?page=255", &body) == 200);
+        CHECK(body.indexOf("\"p255-val\":255") >= 0);
+        CHECK(body.indexOf("\"p256-val\":256") >= 0);
+        CHECK(get("/allReadings?page=256") == 404);
+        CHECK(get("/allReadings?page=4294967296") == 404);
+        CHECK(get("/allReadings?page=abc") == 404);
+        CHECK(get("/allReadings?page=") == 404);
+        CHECK(get("/widgets.json?page=-1") == 404);
+        CHECK(get("/widgets.json?page=1") == 200);
+    }
+
+#ifdef ENABLE_PEERS
+    // Peer readings are on the first page like the peer widgets
+    void peerReadingsOnFirstPage()
+    {
+        ESPWebConnect web;
+        int a = 1, b = 2;
+        web.setPeers(true, "hub");
+        web.setPage("One");
+        web.addSensor("a", "A", "", "", &a, "");
+        web.setPage("Two");
+        web.addSensor("b", "B", "", "", &b, "");
+        web.begin();
+
+        uint8_t packet[64];
+        ESPWebCPeer::Writer out(packet, sizeof(packet));
+        out.header(ESPWebCPeer::READINGS, "n1");
+        out.u8(1);
+        out.str("t");
+        out.u8(ESPWebCPeer::INT);
+        out.i32(5);
+        WiFiUDP::deliver(packet, out.length(), IPAddress(10, 0, 0, 9), ESPWebCPeer::PORT);
+        web.handle();
+
+        String body;
+        CHECK(get("/allReadings", &body) == 200);
+        CHECK(body.indexOf("\"n1_t-val\":5") >= 0);
+        CHECK(get("/allReadings?page=0", &body) == 200);
+        CHECK(body.indexOf("\"n1_t-val\":5") >= 0);
+        CHECK(get("/allReadings?page=1", &body) == 200);
+        CHECK(body.indexOf("n1_t") < 0);
+        CHECK(body.indexOf("\"b-val\":2") >= 0);
+    }
+#endif
+
+#ifdef ENABLE_HISTORY
+    // Samples keep their interval while loop() runs far more often
+    void historyOnSchedule()
+    {
+        ESPWebConnect web;
+        int level = 0;
+        web.addSensor("level", "Level", "", "", &level, "");
+        web.addHistory("level", 2000);
+        web.begin();
+        for (int i = 0; i < 1000; i++)
+        {
+            level = i;
+            web.handle();
+            ESPWebCHost::skip(10);
+        }
+
+        String body;
+        CHECK(get("/history?id=level", &body) == 200);
+        int points = 0;
+        for (int at = body.indexOf("[", 1); at >= 0; at = body.indexOf("[", at + 1))
+        {
+            points++;
+        }
+        CHECK(points - 1 >= 5 && points - 1 <= 6); // the array, then one per sample
+    }
+#endif
+
+#ifdef ENABLE_METRICS
+    // Free text ids are escaped in labels, /metrics counts itself
+    void metricsLabelsEscaped()
+    {
+        ESPWebConnect web;
+        web.addButton("q\"x\\y", "Odd", "", "", []() { ESPWebCHost::skip(5); }); // the slowest action
+        web.begin();
+        CHECK(send(HTTP_POST, "/batch", "[{\"id\":\"q\\\"x\\\\y\"}]", nullptr) == 200);
+
+        String body;
+        CHECK(get("/metrics", &body) == 200);
+        CHECK(get("/metrics", &body) == 200);
+        CHECK(body.indexOf("espwebc_action_slowest_info{id=\"q\\\"x\\\\y\"} 1") >= 0);
+        CHECK(body.indexOf("espwebc_http_requests_total{route=\"/metrics\"} 1") >= 0);
+    }
+#endif
+
+    struct Check
+    {
+        const char *name;
+        void (*run)();
+    };
+
+    const Check CHECKS[] = {
+        {"unchanged commit() keeps the readings cache", unchangedCommitKeepsCache},
+        {"/events follows the update interval", eventsFollowTheInterval},
+        {"a dashboard switch is published by commit()", switchPublishedByCommit},
+        {"/batch takes many short entries and numbers as strings", batchOfShortEntries},
+        {"timers follow the clock and keep unique ids", schedulerFollowsTheClock},
+        {"page numbers are checked", pageIndexChecked},
+#ifdef ENABLE_PEERS
+        {"peer readings are on the first page", peerReadingsOnFirstPage},
+#endif
+#ifdef ENABLE_HISTORY
+        {"history samples keep their interval", historyOnSchedule},
+#endif
+#ifdef ENABLE_METRICS
+        {"/metrics escapes labels and counts itself", metricsLabelsEscaped},
+#endif
+    };
+}
+
+int main()
+{
+    for (const Check &check : CHECKS)
+    {
+        int before = failures;
+        check.run();
+        printf("%s %s\n", failures == before ? "ok  " : "FAIL", check.name);
+    }
+    printf(failures ? "FAILED\n" : "PASSED\n");
+    return failures ? 1 : 0;
+}
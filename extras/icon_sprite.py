@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+"""Build the self-hosted icon sprite.
+
+Collects the Font Awesome icons used by a sketch (class strings such as
+"fa-solid fa-fan" found in the scanned files) plus the ones the library
+itself needs, takes their SVGs from the svgs directories and writes a
+gzipped SVG sprite to src/ESPWebCIcons.h. The dashboard draws every icon
+found in the sprite locally, others fall back to the stylesheet set with
+setIconUrl().
+
+extras/icons holds SVGs for the dashboard's own icons and the example's,
+in the layout of a Font Awesome Free download (<style>/<name>.svg), taken
+from Font Awesome 4.7 (see extras/icons/README.md). With no arguments the
+library's sprite is rebuilt from it:
+
+    python3 extras/icon_sprite.py
+
+For the icons of your sketch add a Font Awesome Free download
+(fontawesome-free-<version>-web/svgs), searched before extras/icons:
+
+    python3 extras/icon_sprite.py --svgs ~/fontawesome-free-6.4.2-web/svgs --scan path/to/sketch
+
+PlatformIO runs it before every build (extras/pio_icons.py, see
+library.json), scanning the project's src directory.
+"""
+
+import argparse
+import gzip
+import hashlib
+import os
+import re
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+ICONS = os.path.join(ROOT, "extras", "icons")
+
+# Icons used by dash.js itself and by the alarm notifications
+BUILTIN = ["fa-solid fa-expand-arrows-alt", "fa-solid fa-grip-vertical", "fa-solid fa-question",
+           "fa-solid fa-triangle-exclamation", "fa-solid fa-circle-check"]
+
+STYLES = {
+    "fa": "solid", "fas": "solid", "fa-solid": "solid",
+    "far": "regular", "fa-regular": "regular",
+    "fab": "brands", "fa-brands": "brands",
+}
+
+CLASS_RE = re.compile(r"\b(fa|fas|far|fab|fa-solid|fa-regular|fa-brands)\s+fa-([a-z0-9-]+)")
+
+
+def symbol_id(style, name):
+    # Same naming as iconSymbol() in dash.js
+    return "%s-%s" % (style, name)
+
+
+def scan(paths):
+    icons = set()
+    for path in paths:
+        files = [path]
+        if os.path.isdir(path):
+            files = [os.path.join(d, f) for d, _, names in os.walk(path) for f in names
+                     if f.endswith((".ino", ".cpp", ".h", ".txt"))]
+        for name in files:
+            with open(name, encoding="utf-8", errors="ignore") as f:
+                for prefix, icon in CLASS_RE.findall(f.read()):
+                    icons.add((STYLES[prefix], icon))
+    return icons
+
+
+def symbol(dirs, style, name):
+    path = next((p for p in (os.path.join(d, style, name + ".svg") for d in dirs) if os.path.exists(p)), None)
+    if path is None:
+        raise OSError(name)
+    with open(path, encoding="utf-8") as f:
+        svg = f.read()
+    view_box = re.search(r'viewBox="([^"]+)"', svg).group(1)
+    paths = "".join(re.findall(r"<path[^>]*/>", svg))
+    return '<symbol id="%s" viewBox="%s">%s</symbol>' % (symbol_id(style, name), view_box, paths)
+
+
+def c_array(data):
+    return "\n".join("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ","
+                     for i in range(0, len(data), 16))
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--svgs", action="append", default=[], help="Font Awesome Free svgs directory, searched before extras/icons")
+    parser.add_argument("--scan", action="append", default=[], help="sketch file or directory to scan for icons (default: the example)")
+    parser.add_argument("--icon", action="append", default=[], help='extra icon, e.g. "fa-solid fa-fan"')
+    parser.add_argument("--out", default=os.path.join(ROOT, "src", "ESPWebCIcons.h"))
+    args = parser.parse_args(argv)
+
+    dirs = args.svgs + [ICONS]
+    icons = scan(args.scan or [os.path.join(ROOT, "examples", "basicexample")])
+    for text in BUILTIN + args.icon:
+        for prefix, icon in CLASS_RE.findall(text):
+            icons.add((STYLES[prefix], icon))
+    symbols = []
+    for style, name in sorted(icons):
+        try:
+            symbols.append(symbol(dirs, style, name))
+        except OSError:
+            print("warning: no %s/%s.svg, left to the icon stylesheet" % (style, name))
+
+    sprite = ('<svg xmlns="http://www.w3.org/2000/svg">%s</svg>' % "".join(symbols)).encode()
+    packed = gzip.compress(sprite, compresslevel=9, mtime=0)
+    etag = hashlib.sha1(sprite).hexdigest()[:16]
+
+    out = [
+        "// Generated by extras/icon_sprite.py, do not edit.",
+        "#ifndef ESPWEBC_ICONS_H",
+        "#define ESPWEBC_ICONS_H",
+        "",
+        '#include "ESPWebCAssets.h"',
+        "",
+        "// %d icons, %d bytes, %d gzipped" % (len(symbols), len(sprite), len(packed)),
+        "static const uint8_t ESPWEBC_ICON_DATA[] PROGMEM = {",
+        c_array(packed),
+        "};",
+        "",
+        'static const ESPWebCAsset ESPWEBC_ICON_SPRITE = {"/icons.svg", "image/svg+xml", ESPWEBC_ICON_DATA, sizeof(ESPWEBC_ICON_DATA), "\\"%s\\""};' % etag,
+        "",
+        "#endif // ESPWEBC_ICONS_H",
+        "",
+    ]
+    text = "\n".join(out)
+    # Leave the header alone when nothing changed, so builds stay incremental
+    if os.path.exists(args.out):
+        with open(args.out, encoding="utf-8") as f:
+            if f.read() == text:
+                return
+    with open(args.out, "w", newline="\n") as f:
+        f.write(text)
+
+
+if __name__ == "__main__":
+    main()
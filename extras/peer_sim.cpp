@@ -0,0 +1,402 @@
+// Simulated ESPWebConnect peers for Linux, speaking the protocol of
+// src/ESPWebCPeerProtocol.h.
+//
+//   g++ -std=c++11 -O2 -I src extras/peer_sim.cpp -o peer_sim
+//
+//   ./peer_sim node greenhouse 3   # nodes greenhouse1..3 with fake sensors
+//   ./peer_sim aggregate           # collects and prints every node's readings
+//
+// Both default to the loopback interface, so a whole site can be simulated
+// on one machine; pass --iface <local address> to talk to real devices, and
+// --key <secret> ("user:password" for nodes with the Web lock on) when the
+// site signs its packets.
+
+#include "ESPWebCPeerProtocol.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace ESPWebCPeer;
+
+static Key key;
+
+static uint32_t millis()
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static sockaddr_in address(const uint8_t ip[4], uint16_t port)
+{
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    memcpy(&addr.sin_addr, ip, 4);
+    return addr;
+}
+
+struct Endpoint
+{
+    int group;   // receives the multicast announces
+    int unicast; // sends everything, receives the replies
+};
+
+static Endpoint openEndpoint(in_addr iface)
+{
+    Endpoint ep;
+    ep.group = socket(AF_INET, SOCK_DGRAM, 0);
+    int yes = 1;
+    setsockopt(ep.group, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+    sockaddr_in any = {};
+    any.sin_family = AF_INET;
+    any.sin_port = htons(PORT);
+    if (bind(ep.group, (sockaddr *)&any, sizeof(any)) < 0)
+    {
+        perror("bind");
+        exit(1);
+    }
+    ip_mreq mreq;
+    memcpy(&mreq.imr_multiaddr, GROUP, 4);
+    mreq.imr_interface = iface;
+    if (setsockopt(ep.group, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) < 0)
+    {
+        perror("IP_ADD_MEMBERSHIP");
+        exit(1);
+    }
+
+    ep.unicast = socket(AF_INET, SOCK_DGRAM, 0);
+    sockaddr_in local = {};
+    local.sin_family = AF_INET;
+    local.sin_addr = iface;
+    bind(ep.unicast, (sockaddr *)&local, sizeof(local));
+    setsockopt(ep.unicast, IPPROTO_IP, IP_MULTICAST_IF, &iface, sizeof(iface));
+    unsigned char loop = 1;
+    setsockopt(ep.unicast, IPPROTO_IP, IP_MULTICAST_LOOP, &loop, sizeof(loop));
+    return ep;
+}
+
+static void sendTo(int fd, const Writer &out, const sockaddr_in &to)
+{
+    uint8_t packet[MAX_PACKET];
+    memcpy(packet, out.data(), out.length());
+    sendto(fd, packet, key.sign(packet, out.length()), 0, (const sockaddr *)&to, sizeof(to));
+}
+
+// Drops packets that do not match the key, see Key::open()
+static bool receiveFrom(int fd, uint8_t *buffer, size_t &length, sockaddr_in &from)
+{
+    socklen_t fromLen = sizeof(from);
+    ssize_t len = recvfrom(fd, buffer, MAX_PACKET, 0, (sockaddr *)&from, &fromLen);
+    length = len > 0 ? len : 0;
+    return key.open(buffer, length);
+}
+
+static void announce(const Endpoint &ep, const char *name, uint8_t flags, uint32_t version)
+{
+    uint8_t buffer[MAX_PACKET];
+    Writer out(buffer, sizeof(buffer) - TAG_SIZE);
+    out.header(ANNOUNCE, name);
+    out.u8(flags);
+    out.u32(version);
+    sendTo(ep.unicast, out, address(GROUP, PORT));
+}
+
+static void widget(Writer &out, const char *id, const char *name, const char *unit, const char *icon, ValueType type)
+{
+    out.str(id);
+    out.str(name);
+    out.str(unit);
+    out.str(icon);
+    out.u8(type);
+}
+
+// A node with a few drifting sensors
+struct Node
+{
+    std::string name;
+    Endpoint ep;
+    float temperature = 22.0f + rand() % 50 / 10.0f;
+    float humidity = 55.0f;
+    int32_t restarts = rand() % 5;
+    bool relay = false;
+    bool haveAggregator = false;
+    sockaddr_in aggregator = {};
+    uint32_t aggregatorSeen = 0;
+
+    static const uint32_t version = 0x5EED0001;
+
+    void tick()
+    {
+        temperature += (rand() % 21 - 10) / 50.0f;
+        humidity += (rand() % 21 - 10) / 20.0f;
+        if (rand() % 20 == 0)
+        {
+            relay = !relay;
+        }
+    }
+
+    void widgets(Writer &out)
+    {
+        out.u32(version);
+        out.u8(4);
+        widget(out, "temp", "Temperature", "C", "fa fa-thermometer-half", FLOAT);
+        widget(out, "hum", "Humidity", "%", "fa fa-tint", FLOAT);
+        widget(out, "restarts", "Restarts", "", "fa fa-redo", INT);
+        widget(out, "relay", "Relay", "", "fa fa-toggle-on", BOOL);
+    }
+
+    void readings(Writer &out)
+    {
+        out.u8(4);
+        out.str("temp");
+        out.u8(FLOAT);
+        out.f32(temperature);
+        out.str("hum");
+        out.u8(FLOAT);
+        out.f32(humidity);
+        out.str("restarts");
+        out.u8(INT);
+        out.i32(restarts);
+        out.str("relay");
+        out.u8(BOOL);
+        out.u8(relay);
+    }
+};
+
+static void printReadings(const std::string &node, Reader &in)
+{
+    uint8_t count = in.u8();
+    printf("%-16s", node.c_str());
+    for (uint8_t i = 0; i < count && in.ok(); i++)
+    {
+        const char *id;
+        uint8_t len;
+        in.str(id, len);
+        printf("  %.*s=", len, id);
+        switch (in.u8())
+        {
+        case INT:
+            printf("%d", in.i32());
+            break;
+        case FLOAT:
+            printf("%.2f", in.f32());
+            break;
+        case BOOL:
+            printf("%s", in.u8() ? "true" : "false");
+            break;
+        default:
+        {
+            const char *text;
+            uint8_t textLen;
+            in.str(text, textLen);
+            printf("\"%.*s\"", textLen, text);
+        }
+        }
+    }
+    printf("%s\n", in.ok() ? "" : "  (truncated)");
+}
+
+static int runNodes(const char *base, int count, in_addr iface, uint32_t interval)
+{
+    std::vector<Node> nodes(count);
+    std::vector<pollfd> fds;
+    for (int i = 0; i < count; i++)
+    {
+        nodes[i].name = count > 1 ? base + std::to_string(i + 1) : base;
+        nodes[i].ep = openEndpoint(iface);
+        fds.push_back({nodes[i].ep.group, POLLIN, 0});
+        fds.push_back({nodes[i].ep.unicast, POLLIN, 0});
+    }
+
+    uint32_t lastAnnounce = 0, lastReadings = 0;
+    bool first = true;
+    uint8_t buffer[MAX_PACKET], reply[MAX_PACKET];
+    for (;;)
+    {
+        uint32_t now = millis();
+        if (first || now - lastAnnounce >= 5000)
+        {
+            for (Node &node : nodes)
+            {
+                announce(node.ep, node.name.c_str(), 0, Node::version);
+            }
+            lastAnnounce = now;
+            first = false;
+        }
+        if (now - lastReadings >= interval)
+        {
+            for (Node &node : nodes)
+            {
+                node.tick();
+                if (node.haveAggregator && now - node.aggregatorSeen <= 15000)
+                {
+                    Writer out(reply, sizeof(reply) - TAG_SIZE);
+                    out.header(READINGS, node.name.c_str());
+                    node.readings(out);
+                    sendTo(node.ep.unicast, out, node.aggregator);
+                }
+            }
+            lastReadings = now;
+        }
+
+        if (poll(fds.data(), fds.size(), 100) <= 0)
+        {
+            continue;
+        }
+        for (size_t f = 0; f < fds.size(); f++)
+        {
+            if (!(fds[f].revents & POLLIN))
+            {
+                continue;
+            }
+            Node &node = nodes[f / 2];
+            sockaddr_in from;
+            size_t len;
+            if (!receiveFrom(fds[f].fd, buffer, len, from))
+            {
+                continue;
+            }
+            Reader in(buffer, len);
+            const char *peer;
+            uint8_t peerLen;
+            uint8_t type = in.header(peer, peerLen);
+            if (type == ANNOUNCE && (in.u8() & AGGREGATOR))
+            {
+                if (!node.haveAggregator)
+                {
+                    printf("%s: aggregator %.*s at %s:%d\n", node.name.c_str(), peerLen, peer, inet_ntoa(from.sin_addr), ntohs(from.sin_port));
+                }
+                node.haveAggregator = true;
+                node.aggregator = from;
+                node.aggregatorSeen = millis();
+            }
+            else if (type == WIDGETS_REQUEST)
+            {
+                Writer out(reply, sizeof(reply) - TAG_SIZE);
+                out.header(WIDGETS, node.name.c_str());
+                node.widgets(out);
+                sendTo(node.ep.unicast, out, from);
+            }
+        }
+    }
+}
+
+static int runAggregator(in_addr iface)
+{
+    const char *name = "sim-aggregator";
+    Endpoint ep = openEndpoint(iface);
+    std::map<std::string, uint32_t> widgetsVersion;
+    pollfd fds[2] = {{ep.group, POLLIN, 0}, {ep.unicast, POLLIN, 0}};
+    uint32_t lastAnnounce = 0;
+    bool first = true;
+    uint8_t buffer[MAX_PACKET], reply[MAX_PACKET];
+
+    for (;;)
+    {
+        if (first || millis() - lastAnnounce >= 5000)
+        {
+            announce(ep, name, AGGREGATOR, 0);
+            lastAnnounce = millis();
+            first = false;
+        }
+        if (poll(fds, 2, 100) <= 0)
+        {
+            continue;
+        }
+        for (int f = 0; f < 2; f++)
+        {
+            if (!(fds[f].revents & POLLIN))
+            {
+                continue;
+            }
+            sockaddr_in from;
+            size_t len;
+            if (!receiveFrom(fds[f].fd, buffer, len, from))
+            {
+                continue;
+            }
+            Reader in(buffer, len);
+            const char *peer;
+            uint8_t peerLen;
+            uint8_t type = in.header(peer, peerLen);
+            std::string node(peer, peerLen);
+            if (type == 0 || node == name)
+            {
+                continue;
+            }
+
+            if (type == ANNOUNCE)
+            {
+                in.u8();
+                uint32_t version = in.u32();
+                if (!widgetsVersion.count(node) || widgetsVersion[node] != version)
+                {
+                    Writer out(reply, sizeof(reply) - TAG_SIZE);
+                    out.header(WIDGETS_REQUEST, name);
+                    sendTo(ep.unicast, out, from);
+                }
+            }
+            else if (type == WIDGETS)
+            {
+                widgetsVersion[node] = in.u32();
+                uint8_t count = in.u8();
+                printf("%s: %d widgets (%zu bytes)\n", node.c_str(), count, len);
+            }
+            else if (type == READINGS)
+            {
+                printReadings(node, in);
+            }
+        }
+        fflush(stdout);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    in_addr iface;
+    inet_aton("127.0.0.1", &iface);
+    uint32_t interval = 1000;
+    std::vector<const char *> args;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--iface") && i + 1 < argc)
+        {
+            inet_aton(argv[++i], &iface);
+        }
+        else if (!strcmp(argv[i], "--interval") && i + 1 < argc)
+        {
+            interval = atoi(argv[++i]);
+        }
+        else if (!strcmp(argv[i], "--key") && i + 1 < argc)
+        {
+            key.assign(argv[++i]);
+        }
+        else
+        {
+            args.push_back(argv[i]);
+        }
+    }
+
+    srand(time(nullptr));
+    if (args.size() >= 2 && !strcmp(args[0], "node"))
+    {
+        return runNodes(args[1], args.size() > 2 ? atoi(args[2]) : 1, iface, interval);
+    }
+    if (args.size() == 1 && !strcmp(args[0], "aggregate"))
+    {
+        return runAggregator(iface);
+    }
+    fprintf(stderr, "usage: %s [--iface addr] [--interval ms] [--key secret] node <name> [count] | aggregate\n", argv[0]);
+    return 2;
+}
@@ -0,0 +1,25 @@
+"""PlatformIO pre-build hook, run through "extraScript" in library.json.
+
+Rebuilds src/ESPWebCIcons.h from the icons used in the project's src
+directory before the library is compiled. A Font Awesome Free svgs
+directory for icons beyond the built-in ones can be set in platformio.ini:
+
+    custom_icon_svgs = ~/fontawesome-free-6.4.2-web/svgs
+"""
+
+import os
+import sys
+
+Import("env")  # noqa: F821, provided by SCons
+
+# PlatformIO runs library scripts from the library's root directory
+LIBRARY = os.getcwd()
+sys.path.insert(0, os.path.join(LIBRARY, "extras"))
+
+import icon_sprite  # noqa: E402
+
+args = ["--scan", env.subst("$PROJECT_SRC_DIR"), "--out", os.path.join(LIBRARY, "src", "ESPWebCIcons.h")]
+svgs = env.GetProjectOption("custom_icon_svgs", "")
+if svgs:
+    args += ["--svgs", os.path.expanduser(svgs)]
+icon_sprite.main(args)
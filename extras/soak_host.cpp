@@ -0,0 +1,798 @@
+// In-process soak test of ESPWebConnect for Linux. The library is built
+// against the host versions of the Arduino core, FreeRTOS, LittleFS and
+// ESPAsyncWebServer in extras/host, and its handlers are driven without a
+// network: browsers polling /allReadings and reloading the page, WebSocket
+// and Server-Sent Events listeners, switch toggles, input posts, /batch
+// updates and notification bursts, each at its own rate. The time between
+// events is skipped, so hours of traffic run in seconds.
+//
+// It reports the heap allocations of each route and of handle(), the peak
+// heap, the heap that kept growing once warmed up and what is still
+// allocated after every client left, and exits with status 1 when a
+// threshold is crossed. Needs ArduinoJson 6, the copy in the Arduino
+// libraries folder works:
+//
+//   g++ -std=gnu++11 -O2 -I extras/host -I src -I ~/Arduino/libraries/ArduinoJson/src
+//       extras/soak_host.cpp extras/host/*.cpp src/*.cpp -o soak_host -lpthread
+//
+//   ./soak_host --duration 259200 --widgets 64 --pages 4
+//
+// Add -DENABLE_METRICS and the other feature flags to the command to soak
+// those too. The counters replace malloc(), so do not combine it with
+// -fsanitize=address.
+
+#include "ESPWebConnect.h"
+#include "ESPWebCHost.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct Options
+    {
+        double duration = 3600;      // simulated seconds of load
+        double warmup = 300;         // seconds before the growth baseline is taken
+        double settle = 30;          // idle seconds after the clients left
+        double widgets = 24;         // widgets besides one button
+        double pages = 1;            // dashboard pages, pollers spread over them
+        double update = 2500;        // setAutoUpdate() ms
+        double tick = 10;            // loop() period ms
+        double pollers = 8;          // clients polling /allReadings
+        double pollInterval = 1000;  // ms
+        double reload = 600;         // seconds between page loads of a poller, 0 disables
+        double sockets = 4;          // WebSocket listeners subscribed to every widget
+        double reconnect = 900;      // seconds between WebSocket reconnects, 0 disables
+        double sse = 1;              // Server-Sent Events listeners
+        double toggleInterval = 2000;
+        double inputInterval = 5000;
+        double batchInterval = 5000; // alternates /batch and WebSocket batches
+        double notifyInterval = 30000;
+        double notifyBurst = 5;
+        double report = 600;         // seconds between progress lines, 0 disables
+        double maxGrowthBytes = 512; // heap growth from the end of warmup to the end of the load
+        double maxGrowthBlocks = 4;
+        double maxRetainedKb = 16;   // heap still allocated after settle, compared to before the load
+        double maxPeakKb = 0;        // 0 disables
+    };
+
+    struct OptionName
+    {
+        const char *name;
+        double Options::*field;
+    };
+
+    const OptionName OPTIONS[] = {
+        {"--duration", &Options::duration},
+        {"--warmup", &Options::warmup},
+        {"--settle", &Options::settle},
+        {"--widgets", &Options::widgets},
+        {"--pages", &Options::pages},
+        {"--update", &Options::update},
+        {"--tick", &Options::tick},
+        {"--pollers", &Options::pollers},
+        {"--poll-interval", &Options::pollInterval},
+        {"--reload", &Options::reload},
+        {"--sockets", &Options::sockets},
+        {"--reconnect", &Options::reconnect},
+        {"--sse", &Options::sse},
+        {"--toggle-interval", &Options::toggleInterval},
+        {"--input-interval", &Options::inputInterval},
+        {"--batch-interval", &Options::batchInterval},
+        {"--notify-interval", &Options::notifyInterval},
+        {"--notify-burst", &Options::notifyBurst},
+        {"--report", &Options::report},
+        {"--max-growth-bytes", &Options::maxGrowthBytes},
+        {"--max-growth-blocks", &Options::maxGrowthBlocks},
+        {"--max-retained-kb", &Options::maxRetainedKb},
+        {"--max-peak-kb", &Options::maxPeakKb},
+    };
+
+    // Per route: responses by status class and the heap blocks allocated
+    // while the request was handled and answered
+    struct RouteStats
+    {
+        uint64_t requests = 0;
+        uint64_t ok = 0;
+        uint64_t refused = 0;    // 429 and 503
+        uint64_t failed = 0;     // other statuses
+        uint64_t unanswered = 0; // no response at all, the client would hang
+        uint64_t allocations = 0;
+        uint64_t maxAllocations = 0;
+        uint64_t bytes = 0;
+        double seconds = 0;
+        double maxSeconds = 0;
+    };
+
+    struct Stats
+    {
+        std::map<std::string, RouteStats> routes;
+        RouteStats handle; // loop(): handle() and commit()
+        uint64_t wsSent = 0;
+        uint64_t wsErrors = 0; // {"sub":{"error":...}} and {"batch":{"error":...}} replies
+    };
+
+    Options options;
+    Stats stats;
+    ESPWebConnect *webConnect;
+    AsyncWebServer *server;
+    AsyncWebSocket *ws;
+    AsyncEventSource *events;
+
+    // Widget values, allocated before the baseline like globals of a sketch
+    std::vector<String> sensorIds;
+    std::vector<String> switchIds;
+    std::vector<String> inputIds;
+    std::vector<float> floats;
+    std::vector<int> ints;
+    std::vector<String> texts;
+    std::unique_ptr<bool[]> switches;
+    std::unique_ptr<ESPWebCObservable<float>[]> observedFloats;
+    std::unique_ptr<ESPWebCObservable<int>[]> observedInts;
+    std::vector<float> inputFloats;
+    std::vector<String> inputTexts;
+    uint32_t buttonPresses = 0;
+    std::map<std::string, String> etags;
+
+    IPAddress clientIp(uint8_t group, size_t index)
+    {
+        return IPAddress(10, group, index / 250, index % 250 + 1);
+    }
+
+    double now()
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void count(RouteStats &route, uint64_t allocations, double seconds)
+    {
+        route.allocations += allocations;
+        route.maxAllocations = std::max(route.maxAllocations, allocations);
+        route.seconds += seconds;
+        route.maxSeconds = std::max(route.maxSeconds, seconds);
+    }
+
+    // One request through the server, the response read out in TCP sized
+    // parts like the network stack would, then the connection closed
+    int request(const char *route, IPAddress ip, WebRequestMethodComposite method, const String &url,
+                const char *formName = nullptr, const String &formValue = String(), const String &body = String(),
+                const char *etag = nullptr, String *etagOut = nullptr)
+    {
+        AsyncWebServerRequest *req;
+        {
+            ESPWebCHost::Untracked untracked;
+            req = new AsyncWebServerRequest(ip, method, url);
+            if (formName != nullptr)
+            {
+                req->addParam(formName, formValue, true);
+            }
+            if (etag != nullptr)
+            {
+                req->addHeader("If-None-Match", etag);
+            }
+            req->setBody(body);
+        }
+
+        uint64_t before = ESPWebCHost::heap().allocations;
+        double started = now();
+        server->dispatch(req);
+        int code = 0;
+        size_t bytes = 0;
+        AsyncWebServerResponse *response = req->response();
+        if (response != nullptr)
+        {
+            code = response->code();
+            if (etagOut != nullptr && code == 200)
+            {
+                ESPWebCHost::Untracked untracked;
+                *etagOut = response->header("ETag");
+            }
+            uint8_t segment[1436];
+            size_t n;
+            while ((n = response->read(segment, sizeof(segment), bytes)) > 0)
+            {
+                bytes += n;
+            }
+        }
+        {
+            // The request goes, the response with it
+            delete req;
+        }
+        double seconds = now() - started;
+
+        RouteStats &stats = ::stats.routes[route];
+        stats.requests++;
+        stats.bytes += bytes;
+        count(stats, ESPWebCHost::heap().allocations - before, seconds);
+        if (code == 0)
+        {
+            stats.unanswered++;
+        }
+        else if (code < 400)
+        {
+            stats.ok++;
+        }
+        else if (code == 429 || code == 503)
+        {
+            stats.refused++;
+        }
+        else
+        {
+            stats.failed++;
+        }
+        return code;
+    }
+
+    void wsMessage(AsyncWebSocketClient *client, const String &text)
+    {
+        uint32_t messages = client->messages;
+        uint64_t before = ESPWebCHost::heap().allocations;
+        double started = now();
+        ws->message(client, text.c_str(), text.length());
+        RouteStats &stats = ::stats.routes["ws message"];
+        stats.requests++;
+        count(stats, ESPWebCHost::heap().allocations - before, now() - started);
+        if (client->messages != messages && client->last.find("\"error\"") != std::string::npos)
+        {
+            ::stats.wsErrors++;
+        }
+        else
+        {
+            stats.ok++;
+        }
+    }
+
+    String subscription()
+    {
+        ESPWebCHost::Untracked untracked;
+        String text = "{\"sub\":[";
+        for (size_t i = 0; i < sensorIds.size(); i++)
+        {
+            text += i ? ",\"" : "\"";
+            text += sensorIds[i];
+            text += "\"";
+        }
+        for (size_t i = 0; i < switchIds.size(); i++)
+        {
+            text += ",\"" + switchIds[i] + "\"";
+        }
+        text += "]}";
+        return text;
+    }
+
+    String batch(uint32_t round)
+    {
+        ESPWebCHost::Untracked untracked;
+        String text = "[";
+        for (size_t i = 0; i < switchIds.size() && i < 4; i++)
+        {
+            text += text.length() > 1 ? ",{\"id\":\"" : "{\"id\":\"";
+            text += switchIds[i] + "\",\"value\":" + ((round + i) % 2 ? "true" : "false") + "}";
+        }
+        for (size_t i = 0; i < inputIds.size() && i < 2; i++)
+        {
+            text += text.length() > 1 ? ",{\"id\":\"" : "{\"id\":\"";
+            text += inputIds[i] + "\",\"value\":" + String(round % 100) + "}";
+        }
+        text += "]";
+        return text;
+    }
+
+    // A client of the soak: what it does when due and how often
+    struct SoakClient
+    {
+        enum Kind
+        {
+            POLLER,
+            SOCKET,
+            SSE,
+            TOGGLER,
+            INPUTS,
+            BATCHER,
+            NOTIFIER
+        };
+        Kind kind;
+        size_t index;
+        double interval; // ms
+        double due;      // simulated ms
+        double nextReload = 0;
+        uint32_t round = 0;
+        AsyncWebSocketClient *socket = nullptr;
+        AsyncEventSourceClient *listener = nullptr;
+    };
+
+    void pageLoad(IPAddress ip)
+    {
+        request("/dashboard", ip, HTTP_GET, "/dashboard");
+        const char *assets[] = {"/style.css", "/dash.js", "/icons.svg"};
+        for (const char *asset : assets)
+        {
+            // Revalidated with the ETag of the last load, like a browser cache
+            String *etag;
+            {
+                ESPWebCHost::Untracked untracked;
+                etag = &etags[asset];
+            }
+            request(asset, ip, HTTP_GET, asset, nullptr, String(), String(), etag->length() ? etag->c_str() : nullptr, etag);
+        }
+        request("/widgets.json", ip, HTTP_GET, "/widgets.json");
+    }
+
+    void connectSocket(SoakClient &client)
+    {
+        client.socket = ws->connect(clientIp(2, client.index));
+        String sub = subscription();
+        wsMessage(client.socket, sub);
+        ESPWebCHost::Untracked untracked;
+        sub = String();
+    }
+
+    void run(SoakClient &client, double nowMs)
+    {
+        IPAddress ip = clientIp(1 + client.kind, client.index);
+        String url;
+        switch (client.kind)
+        {
+        case SoakClient::POLLER:
+            if (options.reload > 0 && nowMs >= client.nextReload)
+            {
+                pageLoad(ip);
+                client.nextReload = nowMs + options.reload * 1000;
+            }
+            {
+                ESPWebCHost::Untracked untracked;
+                url = options.pages > 1 ? "/allReadings?page=" + String(client.index % (size_t)options.pages) : String("/allReadings");
+            }
+            request("/allReadings", ip, HTTP_GET, url);
+            break;
+
+        case SoakClient::SOCKET:
+            // Reconnects like a browser tab that was reloaded
+            if (client.socket != nullptr)
+            {
+                ws->disconnect(client.socket);
+            }
+            connectSocket(client);
+            break;
+
+        case SoakClient::SSE:
+            if (client.listener != nullptr)
+            {
+                events->disconnect(client.listener);
+            }
+            client.listener = events->connect(ip);
+            break;
+
+        case SoakClient::TOGGLER:
+            if (switchIds.empty())
+            {
+                break;
+            }
+            {
+                ESPWebCHost::Untracked untracked;
+                url = "/toggleSwitch?id=" + switchIds[client.round % switchIds.size()] + "&state=" + (client.round / switchIds.size() % 2 ? "false" : "true");
+            }
+            request("/toggleSwitch", ip, HTTP_GET, url);
+            if (client.round % 10 == 0)
+            {
+                request("/pressButton", ip, HTTP_GET, "/pressButton?id=button");
+            }
+            break;
+
+        case SoakClient::INPUTS:
+            if (inputIds.empty())
+            {
+                break;
+            }
+            {
+                ESPWebCHost::Untracked untracked;
+                url = "/" + inputIds[client.round % inputIds.size()];
+            }
+            request("/<input>", ip, HTTP_POST, url, "value", String(client.round % 1000));
+            break;
+
+        case SoakClient::BATCHER:
+        {
+            String body = batch(client.round);
+            if (client.round % 2 == 0 || ws->getClients().empty())
+            {
+                request("/batch", ip, HTTP_POST, "/batch", nullptr, String(), body);
+            }
+            else
+            {
+                String message;
+                {
+                    ESPWebCHost::Untracked untracked;
+                    message = "{\"batch\":" + body + "}";
+                }
+                wsMessage(ws->getClients().front(), message);
+                ESPWebCHost::Untracked untracked;
+                message = String();
+            }
+            ESPWebCHost::Untracked untracked;
+            body = String();
+            break;
+        }
+
+        case SoakClient::NOTIFIER:
+            for (int i = 0; i < (int)options.notifyBurst; i++)
+            {
+                {
+                    ESPWebCHost::Untracked untracked;
+                    url = "/notify?id=soak" + String(client.round * 100 + i) + "&message=Soak%20test&messageColor=%23333&icon=fa%20fa-bell&iconColor=%23f80&timeout=1000";
+                }
+                request("/notify", ip, HTTP_GET, url);
+            }
+            break;
+        }
+        client.round++;
+        ESPWebCHost::Untracked untracked;
+        url = String();
+    }
+
+    void loopOnce()
+    {
+        uint64_t before = ESPWebCHost::heap().allocations;
+        double started = now();
+        webConnect->handle();
+        webConnect->commit();
+        stats.handle.requests++;
+        count(stats.handle, ESPWebCHost::heap().allocations - before, now() - started);
+
+        // Sockets the server closed go away, like after the close handshake
+        ws->reap();
+        events->reap();
+        for (AsyncWebSocketClient *c : ws->getClients())
+        {
+            stats.wsSent += c->messages;
+            c->messages = 0;
+        }
+    }
+
+    void addWidgets()
+    {
+        size_t n = (size_t)options.widgets;
+        size_t perPage = (n + (size_t)options.pages - 1) / (size_t)options.pages;
+        static std::vector<String> pageNames;
+        floats.assign(n, 20.0f);
+        ints.assign(n, 100);
+        texts.assign(n, "idle");
+        switches.reset(new bool[n]());
+        observedFloats.reset(new ESPWebCObservable<float>[n]);
+        observedInts.reset(new ESPWebCObservable<int>[n]);
+        inputFloats.assign(n, 0);
+        inputTexts.assign(n, String());
+        // The library keeps the id pointers, so the strings must not move
+        sensorIds.reserve(n);
+        switchIds.reserve(n);
+        inputIds.reserve(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            if (options.pages > 1 && i % perPage == 0)
+            {
+                pageNames.push_back("Page " + String(i / perPage + 1));
+            }
+        }
+        for (size_t i = 0; i < n; i++)
+        {
+            if (options.pages > 1 && i % perPage == 0)
+            {
+                webConnect->setPage(pageNames[i / perPage].c_str());
+            }
+            String id = "w" + String(i);
+            switch (i % 8)
+            {
+            case 0:
+            case 6:
+                sensorIds.push_back(id);
+                webConnect->addSensor(sensorIds.back().c_str(), "Temperature", "", "fa fa-thermometer", &floats[i], "C", 1);
+                break;
+            case 1:
+                sensorIds.push_back(id);
+                webConnect->addSensor(sensorIds.back().c_str(), "Level", "", "fa fa-water", &ints[i], "mm", 2);
+                break;
+            case 2:
+                sensorIds.push_back(id);
+                webConnect->addSensor(sensorIds.back().c_str(), "Humidity", "", "fa fa-droplet", &observedFloats[i], "%", 1);
+                break;
+            case 3:
+                sensorIds.push_back(id);
+                webConnect->addSensor(sensorIds.back().c_str(), "State", "", "fa fa-circle-info", &texts[i], "");
+                break;
+            case 4:
+                switchIds.push_back(id);
+                webConnect->addSwitch(switchIds.back().c_str(), "Relay", "", "fa fa-lightbulb", &switches[i]);
+                break;
+            case 5:
+                sensorIds.push_back(id);
+                webConnect->addSensor(sensorIds.back().c_str(), "Power", "", "fa fa-bolt", &observedInts[i], "W", 5, ESPWebCWidget::DEADBAND_PERCENT);
+                break;
+            case 7:
+                inputIds.push_back(id);
+                if (i % 16 == 7)
+                {
+                    webConnect->addInputNum(inputIds.back().c_str(), "Setpoint", "", "fa fa-pencil", &inputFloats[i]);
+                }
+                else
+                {
+                    webConnect->addInputText(inputIds.back().c_str(), "Label", "", "fa fa-pencil", &inputTexts[i]);
+                }
+                break;
+            }
+        }
+        webConnect->addButton("button", "Press", "", "fa fa-hand-pointer", []
+                              { buttonPresses++; });
+    }
+
+    // The sketch side: readings move every second
+    void updateReadings()
+    {
+        static uint32_t step = 0;
+        step++;
+        for (size_t i = 0; i < floats.size(); i++)
+        {
+            floats[i] = 20.0f + 5.0f * sinf((step + i) * 0.05f);
+            ints[i] = 100 + (int)((step * 7 + i * 13) % 11);
+            observedFloats[i] = roundf(500.0f + 100.0f * cosf((step + i) * 0.02f)) / 10.0f;
+            observedInts[i] = 1000 + (int)((step + i) % 50) * 3;
+            if (i % 8 == 3 && step % 30 == 0)
+            {
+                texts[i] = step % 60 ? "running" : "idle";
+            }
+        }
+    }
+
+    void printHeap(const char *label, const ESPWebCHost::HeapStats &heap)
+    {
+        printf("  %-22s %8zu bytes in %6zu blocks\n", label, heap.bytes, heap.blocks);
+    }
+
+    void printRoute(const char *name, const RouteStats &route, double elapsed)
+    {
+        if (route.requests == 0)
+        {
+            return;
+        }
+        printf("  %-14s %8llu %7.2f/s  ok %llu refused %llu failed %llu unanswered %llu  allocs %.1f/req (max %llu)  %.0f B/req  %.3f ms/req (max %.3f)\n",
+               name, (unsigned long long)route.requests, route.requests / elapsed,
+               (unsigned long long)route.ok, (unsigned long long)route.refused, (unsigned long long)route.failed, (unsigned long long)route.unanswered,
+               (double)route.allocations / route.requests, (unsigned long long)route.maxAllocations,
+               (double)route.bytes / route.requests,
+               route.seconds * 1000 / route.requests, route.maxSeconds * 1000);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        bool known = false;
+        for (const OptionName &option : OPTIONS)
+        {
+            if (!strcmp(argv[i], option.name) && i + 1 < argc)
+            {
+                options.*option.field = atof(argv[++i]);
+                known = true;
+                break;
+            }
+        }
+        if (!known)
+        {
+            fprintf(stderr, "usage: %s", argv[0]);
+            for (const OptionName &option : OPTIONS)
+            {
+                fprintf(stderr, " [%s %g]", option.name, options.*option.field);
+            }
+            fprintf(stderr, "\n");
+            return 2;
+        }
+    }
+    options.pages = std::max(1.0, options.pages);
+    options.tick = std::max(1.0, options.tick);
+
+    // setup()
+    webConnect = new ESPWebConnect();
+    webConnect->begin();
+    webConnect->setAutoUpdate((unsigned long)options.update);
+    addWidgets();
+    webConnect->every(1000, updateReadings);
+    server = AsyncWebServer::running(80);
+    ws = server ? server->findHandler<AsyncWebSocket>() : nullptr;
+    events = server ? server->findHandler<AsyncEventSource>() : nullptr;
+    if (ws == nullptr || events == nullptr)
+    {
+        fprintf(stderr, "the web server did not start\n");
+        return 2;
+    }
+    loopOnce();
+    ESPWebCHost::HeapStats beforeLoad = ESPWebCHost::heap();
+    ESPWebCHost::resetPeak();
+
+    std::vector<SoakClient> clients;
+    {
+        ESPWebCHost::Untracked untracked;
+        auto add = [&clients](SoakClient::Kind kind, double count, double interval)
+        {
+            for (size_t i = 0; i < (size_t)count; i++)
+            {
+                SoakClient client;
+                client.kind = kind;
+                client.index = i;
+                client.interval = interval;
+                // Spread over the interval like independent browser tabs
+                client.due = millis() + (interval > 0 ? fmod(i * 7919.0, interval) : 0);
+                clients.push_back(client);
+            }
+        };
+        add(SoakClient::POLLER, options.pollers, options.pollInterval);
+        add(SoakClient::SOCKET, options.sockets, options.reconnect > 0 ? options.reconnect * 1000 : 1e300);
+        add(SoakClient::SSE, options.sse, options.reconnect > 0 ? options.reconnect * 1000 : 1e300);
+        add(SoakClient::TOGGLER, options.toggleInterval > 0, options.toggleInterval);
+        add(SoakClient::INPUTS, options.inputInterval > 0, options.inputInterval);
+        add(SoakClient::BATCHER, options.batchInterval > 0, options.batchInterval);
+        add(SoakClient::NOTIFIER, options.notifyInterval > 0, options.notifyInterval);
+        for (SoakClient &client : clients)
+        {
+            if (client.kind == SoakClient::SOCKET || client.kind == SoakClient::SSE)
+            {
+                client.due = millis(); // connect right away
+            }
+        }
+    }
+
+    printf("%zu widgets on %d page(s), %d pollers, %d sockets, %d SSE listeners, %.0f s of load\n",
+           webConnect->elementCount(), (int)options.pages, (int)options.pollers, (int)options.sockets, (int)options.sse, options.duration);
+
+    double startMs = millis();
+    double endMs = startMs + options.duration * 1000;
+    double warmupMs = startMs + std::min(options.warmup, options.duration) * 1000;
+    double nextTick = startMs;
+    double nextReport = options.report > 0 ? startMs + options.report * 1000 : 1e300;
+    bool warm = false;
+    ESPWebCHost::HeapStats afterWarmup = {};
+    double realStart = now();
+
+    while (millis() < endMs)
+    {
+        double t = millis();
+        for (SoakClient &client : clients)
+        {
+            if (client.due <= t)
+            {
+                run(client, t);
+                client.due += client.interval;
+                if (client.due <= t)
+                {
+                    client.due = t + client.interval; // fell behind, skip
+                }
+            }
+        }
+        if (t >= nextTick)
+        {
+            loopOnce();
+            nextTick = t + options.tick;
+        }
+        if (!warm && t >= warmupMs)
+        {
+            warm = true;
+            afterWarmup = ESPWebCHost::heap();
+        }
+        if (t >= nextReport)
+        {
+            ESPWebCHost::HeapStats heap = ESPWebCHost::heap();
+            printf("%8.0fs  heap %zu bytes in %zu blocks, peak %zu, free %u\n", (t - startMs) / 1000, heap.bytes, heap.blocks, heap.peakBytes, ESP.getFreeHeap());
+            fflush(stdout);
+            nextReport += options.report * 1000;
+        }
+
+        double next = std::min(nextTick, endMs);
+        for (const SoakClient &client : clients)
+        {
+            next = std::min(next, client.due);
+        }
+        double current = millis();
+        if (next > current)
+        {
+            ESPWebCHost::skip((unsigned long)(next - current));
+        }
+    }
+    ESPWebCHost::HeapStats endOfLoad = ESPWebCHost::heap();
+    if (!warm)
+    {
+        afterWarmup = endOfLoad;
+    }
+
+    // Every client leaves, the loop keeps running
+    for (SoakClient &client : clients)
+    {
+        if (client.socket != nullptr)
+        {
+            ws->disconnect(client.socket);
+        }
+        if (client.listener != nullptr)
+        {
+            events->disconnect(client.listener);
+        }
+    }
+    double settleEnd = millis() + options.settle * 1000;
+    while (millis() < settleEnd)
+    {
+        loopOnce();
+        ESPWebCHost::skip((unsigned long)options.tick);
+    }
+    ESPWebCHost::HeapStats settled = ESPWebCHost::heap();
+    double elapsed = (millis() - startMs) / 1000;
+
+    printf("\nRoutes (%.0f s simulated in %.1f s)\n", elapsed, now() - realStart);
+    for (auto &route : stats.routes)
+    {
+        printRoute(route.first.c_str(), route.second, elapsed);
+    }
+    printRoute("loop()", stats.handle, elapsed);
+    printf("  WebSocket      %8llu frames sent  %llu error replies\n", (unsigned long long)stats.wsSent, (unsigned long long)stats.wsErrors);
+    printf("  button presses %8u\n", buttonPresses);
+
+    printf("\nHeap\n");
+    printHeap("before the load", beforeLoad);
+    printHeap("after warmup", afterWarmup);
+    printHeap("end of the load", endOfLoad);
+    printHeap("after settle", settled);
+    printf("  %-22s %8zu bytes\n", "peak", settled.peakBytes);
+    printf("  %-22s %8llu\n", "allocations", (unsigned long long)settled.allocations);
+
+    std::vector<std::string> failures;
+    char text[160];
+    long growth = (long)endOfLoad.bytes - (long)afterWarmup.bytes;
+    long growthBlocks = (long)endOfLoad.blocks - (long)afterWarmup.blocks;
+    if (growth > options.maxGrowthBytes || growthBlocks > options.maxGrowthBlocks)
+    {
+        snprintf(text, sizeof(text), "heap grew by %ld bytes in %ld blocks after warmup", growth, growthBlocks);
+        failures.push_back(text);
+    }
+    long retained = (long)settled.bytes - (long)beforeLoad.bytes;
+    if (retained > options.maxRetainedKb * 1024)
+    {
+        snprintf(text, sizeof(text), "%ld bytes retained after the clients left", retained);
+        failures.push_back(text);
+    }
+    if (options.maxPeakKb > 0 && settled.peakBytes > options.maxPeakKb * 1024)
+    {
+        snprintf(text, sizeof(text), "peak heap %zu bytes", settled.peakBytes);
+        failures.push_back(text);
+    }
+    uint64_t unanswered = 0;
+    for (auto &route : stats.routes)
+    {
+        unanswered += route.second.unanswered;
+    }
+    if (unanswered > 0)
+    {
+        snprintf(text, sizeof(text), "%llu requests never answered", (unsigned long long)unanswered);
+        failures.push_back(text);
+    }
+    if (AsyncWebServerRequest::doubleSends() > 0)
+    {
+        snprintf(text, sizeof(text), "%u requests answered twice", AsyncWebServerRequest::doubleSends());
+        failures.push_back(text);
+    }
+
+    if (!failures.empty())
+    {
+        printf("\nFAILED:");
+        for (size_t i = 0; i < failures.size(); i++)
+        {
+            printf("%s %s", i ? ";" : "", failures[i].c_str());
+        }
+        printf("\n");
+        return 1;
+    }
+    printf("\nPASSED\n");
+    return 0;
+}
@@ -0,0 +1,395 @@
+#!/usr/bin/env python3
+"""Load and soak test a device running ESPWebConnect.
+
+Simulates browsers polling /allReadings, WebSocket listeners subscribed to
+every widget, switch toggles and notification bursts, each at its own rate.
+Reports request latency and throughput seen by the clients, the handler
+time histogram and heap gauges from /metrics (build with ENABLE_METRICS),
+and exits with status 1 when a threshold is crossed.
+
+    python3 extras/soak_test.py 192.168.1.50 --pollers 8 --sockets 4 \\
+        --toggle led --notify-interval 60 --duration 259200
+
+Retained heap is the free heap after the load stops and the device had
+--settle seconds to close connections, compared to the free heap before.
+"""
+
+import argparse
+import base64
+import http.client
+import json
+import math
+import os
+import random
+import re
+import socket
+import struct
+import sys
+import threading
+import time
+import urllib.parse
+
+
+class Histogram:
+    """Request latencies in log-spaced buckets, 5% wide from 0.1 ms to ~100 s.
+
+    Memory stays constant however long the run is; percentiles are reported
+    as the upper bound of the bucket they fall in.
+    """
+
+    FIRST = 0.0001
+    GROWTH = 1.05
+    BUCKETS = 300
+
+    def __init__(self):
+        self.counts = [0] * (self.BUCKETS + 1)  # last one is overflow
+        self.count = 0
+
+    def add(self, seconds):
+        index = 0
+        if seconds > self.FIRST:
+            index = min(self.BUCKETS, int(math.ceil(math.log(seconds / self.FIRST, self.GROWTH))))
+        self.counts[index] += 1
+        self.count += 1
+
+    def percentile(self, p):
+        if not self.count:
+            return 0.0
+        rank = max(1, int(math.ceil(self.count * p / 100.0)))
+        seen = 0
+        for index, n in enumerate(self.counts):
+            seen += n
+            if seen >= rank:
+                return float("inf") if index == self.BUCKETS else self.FIRST * self.GROWTH ** index
+        return float("inf")
+
+
+class Stats:
+    """Latency histograms and status counts, shared by the client threads."""
+
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.latency = {}  # route -> Histogram
+        self.status = {}  # route -> {status: count}
+        self.ws_frames = 0
+        self.ws_drops = 0
+
+    def record(self, route, status, seconds):
+        with self.lock:
+            if route not in self.latency:
+                self.latency[route] = Histogram()
+            self.latency[route].add(seconds)
+            counts = self.status.setdefault(route, {})
+            counts[status] = counts.get(status, 0) + 1
+
+    def frames(self, count=1):
+        with self.lock:
+            self.ws_frames += count
+
+    def drop(self):
+        with self.lock:
+            self.ws_drops += 1
+
+
+class Device:
+    def __init__(self, host, port, user, password, timeout):
+        self.host = host
+        self.port = port
+        self.timeout = timeout
+        self.headers = {}
+        if user:
+            token = base64.b64encode(("%s:%s" % (user, password)).encode()).decode()
+            self.headers["Authorization"] = "Basic " + token
+
+    def get(self, path):
+        """Returns (status, body), status 0 on a connection error."""
+        conn = http.client.HTTPConnection(self.host, self.port, timeout=self.timeout)
+        try:
+            conn.request("GET", path, headers=self.headers)
+            response = conn.getresponse()
+            return response.status, response.read()
+        except (OSError, http.client.HTTPException):
+            return 0, b""
+        finally:
+            conn.close()
+
+    def metrics(self):
+        status, body = self.get("/metrics")
+        if status != 200:
+            return None
+        values = {}
+        for line in body.decode(errors="replace").splitlines():
+            if line.startswith("#") or not line.strip():
+                continue
+            name, _, value = line.rpartition(" ")
+            try:
+                values[name] = float(value)
+            except ValueError:
+                pass
+        return values
+
+
+class WebSocket:
+    """Just enough of RFC 6455 for the dashboard socket: text frames only."""
+
+    def __init__(self, device, path="/ws"):
+        self.sock = socket.create_connection((device.host, device.port), timeout=device.timeout)
+        key = base64.b64encode(os.urandom(16)).decode()
+        request = "GET %s HTTP/1.1\r\nHost: %s\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n" \
+                  "Sec-WebSocket-Key: %s\r\nSec-WebSocket-Version: 13\r\n" % (path, device.host, key)
+        for name, value in device.headers.items():
+            request += "%s: %s\r\n" % (name, value)
+        self.sock.sendall((request + "\r\n").encode())
+        head = b""
+        while b"\r\n\r\n" not in head:
+            chunk = self.sock.recv(1024)
+            if not chunk:
+                raise OSError("handshake closed")
+            head += chunk
+        if b" 101 " not in head.split(b"\r\n", 1)[0]:
+            raise OSError("handshake refused")
+        self.buffer = head.split(b"\r\n\r\n", 1)[1]
+        self.sock.settimeout(1.0)  # lets the listener notice stop
+
+    def send(self, text):
+        data = text.encode()
+        mask = os.urandom(4)
+        if len(data) < 126:
+            header = struct.pack("!BB", 0x81, 0x80 | len(data))
+        else:
+            header = struct.pack("!BBH", 0x81, 0x80 | 126, len(data))
+        masked = bytes(b ^ mask[i % 4] for i, b in enumerate(data))
+        self.sock.sendall(header + mask + masked)
+
+    def _read(self, n):
+        while len(self.buffer) < n:
+            chunk = self.sock.recv(4096)
+            if not chunk:
+                raise OSError("closed")
+            self.buffer += chunk
+        data, self.buffer = self.buffer[:n], self.buffer[n:]
+        return data
+
+    def receive(self):
+        """Returns the opcode and payload of the next frame."""
+        first, second = self._read(2)
+        length = second & 0x7F
+        if length == 126:
+            length = struct.unpack("!H", self._read(2))[0]
+        elif length == 127:
+            length = struct.unpack("!Q", self._read(8))[0]
+        return first & 0x0F, self._read(length)
+
+    def close(self):
+        try:
+            self.sock.close()
+        except OSError:
+            pass
+
+
+def poller(device, stats, interval, stop):
+    # Spread the clients over the interval like independent browser tabs
+    stop.wait(random.uniform(0, interval))
+    while not stop.is_set():
+        start = time.monotonic()
+        status, _ = device.get("/allReadings")
+        stats.record("/allReadings", status, time.monotonic() - start)
+        stop.wait(max(0.0, interval - (time.monotonic() - start)))
+
+
+def listener(device, stats, widgets, stop):
+    while not stop.is_set():
+        try:
+            ws = WebSocket(device)
+        except OSError:
+            stats.drop()
+            stop.wait(1.0)
+            continue
+        try:
+            ws.send(json.dumps({"sub": widgets}))
+            while not stop.is_set():
+                try:
+                    opcode, _ = ws.receive()
+                except socket.timeout:
+                    continue
+                if opcode == 0x8:
+                    raise OSError("closed by device")
+                if opcode == 0x1:
+                    stats.frames()
+        except OSError:
+            stats.drop()
+            stop.wait(1.0)
+        finally:
+            ws.close()
+
+
+def toggler(device, stats, switch, interval, stop):
+    state = False
+    while not stop.wait(interval):
+        state = not state
+        path = "/toggleSwitch?" + urllib.parse.urlencode({"id": switch, "state": "true" if state else "false"})
+        start = time.monotonic()
+        status, _ = device.get(path)
+        stats.record("/toggleSwitch", status, time.monotonic() - start)
+
+
+def notifier(device, stats, interval, burst, stop):
+    count = 0
+    while not stop.wait(interval):
+        for _ in range(burst):
+            count += 1
+            path = "/notify?" + urllib.parse.urlencode({
+                "id": "soak%d" % count, "message": "Soak test notification %d" % count,
+                "messageColor": "#333", "icon": "fa fa-bell", "iconColor": "#f80", "timeout": 1000})
+            start = time.monotonic()
+            status, _ = device.get(path)
+            stats.record("/notify", status, time.monotonic() - start)
+
+
+def handler_percentiles(before, after, route):
+    """p50/p99 handler time from the /metrics histogram delta of one route."""
+    pattern = re.compile(r'espwebc_http_handler_seconds_bucket\{route="%s",le="([^"]+)"\}' % re.escape(route))
+    buckets = []
+    for name, value in after.items():
+        match = pattern.fullmatch(name)
+        if match:
+            bound = float("inf") if match.group(1) == "+Inf" else float(match.group(1))
+            buckets.append((bound, value - before.get(name, 0)))
+    buckets.sort()
+    if not buckets or buckets[-1][1] <= 0:
+        return None
+    total = buckets[-1][1]
+    result = []
+    for p in (50, 99):
+        result.append(next(bound for bound, count in buckets if count >= total * p / 100.0))
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("host")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--user", help="Web Lock user, when enabled")
+    parser.add_argument("--password", default="")
+    parser.add_argument("--duration", type=float, default=300, help="seconds of load (72 h = 259200)")
+    parser.add_argument("--pollers", type=int, default=8, help="clients polling /allReadings")
+    parser.add_argument("--poll-interval", type=float, default=1.0)
+    parser.add_argument("--sockets", type=int, default=4, help="WebSocket listeners")
+    parser.add_argument("--toggle", help="switch id toggled during the test")
+    parser.add_argument("--toggle-interval", type=float, default=2.0)
+    parser.add_argument("--notify-interval", type=float, default=30.0, help="0 disables notifications")
+    parser.add_argument("--notify-burst", type=int, default=5)
+    parser.add_argument("--report-interval", type=float, default=60.0)
+    parser.add_argument("--settle", type=float, default=10.0, help="idle seconds before the final heap reading")
+    parser.add_argument("--timeout", type=float, default=5.0)
+    parser.add_argument("--max-p99-ms", type=float, default=1000.0, help="client p99 latency limit")
+    parser.add_argument("--max-error-rate", type=float, default=0.01, help="failed or refused request ratio")
+    parser.add_argument("--max-retained-kb", type=float, default=4.0, help="free heap lost over the run")
+    parser.add_argument("--max-retained-allocs", type=int, default=32, help="heap blocks still allocated after the run")
+    parser.add_argument("--min-largest-block-kb", type=float, default=8.0)
+    args = parser.parse_args()
+
+    device = Device(args.host, args.port, args.user, args.password, args.timeout)
+    status, body = device.get("/widgets.json")
+    if status != 200:
+        sys.exit("Cannot read /widgets.json from %s (status %d)" % (args.host, status))
+    widgets = [w["id"] for w in json.loads(body.decode())["widgets"]]
+
+    before = device.metrics()
+    if before is None:
+        print("/metrics not available, heap checks are skipped (build with ENABLE_METRICS)")
+
+    stats = Stats()
+    stop = threading.Event()
+    threads = [threading.Thread(target=poller, args=(device, stats, args.poll_interval, stop)) for _ in range(args.pollers)]
+    threads += [threading.Thread(target=listener, args=(device, stats, widgets, stop)) for _ in range(args.sockets)]
+    if args.toggle:
+        threads.append(threading.Thread(target=toggler, args=(device, stats, args.toggle, args.toggle_interval, stop)))
+    if args.notify_interval > 0:
+        threads.append(threading.Thread(target=notifier, args=(device, stats, args.notify_interval, args.notify_burst, stop)))
+    for thread in threads:
+        thread.daemon = True
+        thread.start()
+
+    started = time.monotonic()
+    lowest_block = None
+    try:
+        while time.monotonic() - started < args.duration:
+            time.sleep(min(args.report_interval, max(0.0, args.duration - (time.monotonic() - started))))
+            now = device.metrics() if before is not None else None
+            line = "%6.0fs" % (time.monotonic() - started)
+            with stats.lock:
+                for route, counts in sorted(stats.status.items()):
+                    line += "  %s %d" % (route, sum(counts.values()))
+                line += "  ws frames %d" % stats.ws_frames
+            if now:
+                block = now.get("espwebc_heap_largest_free_block_bytes", 0)
+                lowest_block = block if lowest_block is None else min(lowest_block, block)
+                line += "  heap %.0f  block %.0f" % (now.get("espwebc_heap_free_bytes", 0), block)
+            print(line, flush=True)
+    except KeyboardInterrupt:
+        print("interrupted")
+    stop.set()
+    for thread in threads:
+        thread.join(args.timeout + 1)
+    elapsed = time.monotonic() - started
+
+    time.sleep(args.settle)
+    after = device.metrics() if before is not None else None
+
+    failures = []
+    print("\nClient side")
+    total = errors = 0
+    for route in sorted(stats.latency):
+        latency = stats.latency[route]
+        counts = stats.status[route]
+        failed = sum(n for code, n in counts.items() if code != 200)
+        total += latency.count
+        errors += failed
+        p50, p99 = latency.percentile(50) * 1000, latency.percentile(99) * 1000
+        print("  %-14s %7d requests %6.1f/s  p50 %6.1f ms  p99 %6.1f ms  status %s" % (
+            route, latency.count, latency.count / elapsed, p50, p99,
+            ", ".join("%d:%d" % item for item in sorted(counts.items()))))
+        if p99 > args.max_p99_ms:
+            failures.append("%s p99 %.1f ms > %.1f ms" % (route, p99, args.max_p99_ms))
+    print("  WebSocket      %7d frames   %6.1f/s  reconnects %d" % (stats.ws_frames, stats.ws_frames / elapsed, stats.ws_drops))
+    if total and errors / total > args.max_error_rate:
+        failures.append("error rate %.2f%% > %.2f%%" % (100.0 * errors / total, 100.0 * args.max_error_rate))
+
+    if before and after:
+        print("\nDevice side")
+        for route in ("/allReadings", "/widget", "/notify"):
+            handler = handler_percentiles(before, after, route)
+            if handler:
+                print("  %-14s handler p50 <= %.3f ms  p99 <= %.3f ms" % (route, handler[0] * 1000, handler[1] * 1000))
+        free_before = before.get("espwebc_heap_free_bytes", 0)
+        free_after = after.get("espwebc_heap_free_bytes", 0)
+        block_before = before.get("espwebc_heap_largest_free_block_bytes", 0)
+        block_after = after.get("espwebc_heap_largest_free_block_bytes", 0)
+        if lowest_block is None:
+            lowest_block = block_after
+        print("  free heap       %8.0f -> %8.0f  (lowest %.0f)" % (free_before, free_after, after.get("espwebc_heap_min_free_bytes", 0)))
+        print("  largest block   %8.0f -> %8.0f  (lowest %.0f)" % (block_before, block_after, min(lowest_block, block_after)))
+        print("  allocations     %8.0f -> %8.0f" % (before.get("espwebc_heap_allocated_blocks", 0), after.get("espwebc_heap_allocated_blocks", 0)))
+        for name in ("espwebc_arena_overflows_total", "espwebc_action_dropped_total", "espwebc_rejected_busy_total",
+                     "espwebc_rejected_low_heap_total", "espwebc_rejected_rate_total", "espwebc_rejected_clients_total"):
+            if name in after:
+                print("  %-31s %+.0f" % (name, after[name] - before.get(name, 0)))
+
+        retained = (free_before - free_after) / 1024.0
+        if retained > args.max_retained_kb:
+            failures.append("retained heap %.1f KB > %.1f KB" % (retained, args.max_retained_kb))
+        allocs = after.get("espwebc_heap_allocated_blocks", 0) - before.get("espwebc_heap_allocated_blocks", 0)
+        if allocs > args.max_retained_allocs:
+            failures.append("%d heap blocks retained > %d" % (allocs, args.max_retained_allocs))
+        if min(lowest_block, block_after) / 1024.0 < args.min_largest_block_kb:
+            failures.append("largest free block fell to %.1f KB" % (min(lowest_block, block_after) / 1024.0))
+
+    if failures:
+        print("\nFAILED: " + "; ".join(failures))
+        sys.exit(1)
+    print("\nPASSED")
+
+
+if __name__ == "__main__":
+    main()
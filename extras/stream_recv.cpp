@@ -0,0 +1,164 @@
+// Receiver for the sample stream of ESPWebConnect::beginStream(), see
+// src/ESPWebCStreamProtocol.h.
+//
+//   g++ -std=c++11 -O2 -I src extras/stream_recv.cpp -o stream_recv
+//
+//   ./stream_recv              # listens on port 4211
+//   ./stream_recv 5000 > log   # other port, prints one line per second
+//   ./stream_recv --raw        # one "channel micros value" line per sample
+//
+// Every second it prints datagrams and samples received, the rate of each
+// channel with its last value, datagrams lost on the way (sequence gaps)
+// and samples the device dropped because its ring was full (overruns).
+
+#include "ESPWebCStreamProtocol.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <map>
+
+using namespace ESPWebCStreamProtocol;
+
+static uint32_t millis()
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+struct Channel
+{
+    uint32_t samples = 0; // this second
+    uint64_t total = 0;
+    float last = 0;
+};
+
+struct Device
+{
+    bool seen = false;
+    uint32_t nextSequence = 0;
+    uint32_t overruns = 0;
+    uint64_t lost = 0;
+};
+
+int main(int argc, char **argv)
+{
+    uint16_t port = 4211;
+    bool raw = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--raw") == 0)
+        {
+            raw = true;
+        }
+        else
+        {
+            port = atoi(argv[i]);
+        }
+    }
+
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    int size = 1 << 20; // room for bursts while printing
+    setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(fd, (sockaddr *)&addr, sizeof(addr)) < 0)
+    {
+        perror("bind");
+        return 1;
+    }
+    fprintf(stderr, "listening on UDP %u\n", port);
+
+    std::map<uint32_t, Device> devices; // by source address
+    std::map<uint8_t, Channel> channels;
+    uint32_t packets = 0, samples = 0, invalid = 0;
+    uint32_t lastReport = millis();
+    uint8_t buffer[2048];
+
+    for (;;)
+    {
+        pollfd pfd = {fd, POLLIN, 0};
+        if (poll(&pfd, 1, 100) > 0)
+        {
+            sockaddr_in from = {};
+            socklen_t fromLen = sizeof(from);
+            ssize_t len = recvfrom(fd, buffer, sizeof(buffer), 0, (sockaddr *)&from, &fromLen);
+            Header header;
+            if (len < 0 || !decodeHeader(buffer, len, header))
+            {
+                invalid++;
+                continue;
+            }
+
+            Device &device = devices[from.sin_addr.s_addr];
+            if (device.seen && header.sequence != device.nextSequence)
+            {
+                // Older sequence numbers are reordered datagrams or a restart
+                int32_t gap = (int32_t)(header.sequence - device.nextSequence);
+                if (gap > 0)
+                {
+                    device.lost += gap;
+                }
+            }
+            device.seen = true;
+            device.nextSequence = header.sequence + 1;
+            device.overruns = header.overruns;
+            packets++;
+            samples += header.count;
+
+            for (uint16_t i = 0; i < header.count; i++)
+            {
+                Sample sample = decodeSample(buffer + HEADER_SIZE + i * SAMPLE_SIZE);
+                Channel &channel = channels[sample.channel];
+                channel.samples++;
+                channel.total++;
+                channel.last = sample.value;
+                if (raw)
+                {
+                    printf("%u %u %g\n", sample.channel, sample.micros, sample.value);
+                }
+            }
+        }
+
+        uint32_t now = millis();
+        if (now - lastReport < 1000)
+        {
+            continue;
+        }
+        double seconds = (now - lastReport) / 1000.0;
+        lastReport = now;
+        if (raw)
+        {
+            fflush(stdout);
+            continue;
+        }
+
+        uint64_t lost = 0;
+        uint32_t overruns = 0;
+        for (const auto &device : devices)
+        {
+            lost += device.second.lost;
+            overruns += device.second.overruns;
+        }
+        printf("%u pkt/s %u samples/s | lost %llu pkt | overruns %u | invalid %u\n",
+               (unsigned)(packets / seconds), (unsigned)(samples / seconds), (unsigned long long)lost, overruns, invalid);
+        for (auto &channel : channels)
+        {
+            printf("  ch %3u  %7.1f/s  last %g\n", channel.first, channel.second.samples / seconds, channel.second.last);
+            channel.second.samples = 0;
+        }
+        fflush(stdout);
+        packets = 0;
+        samples = 0;
+    }
+}
@@ -0,0 +1,205 @@
+#include "ESPWebCAlarms.h"
+
+int ESPWebCAlarms::add(const char *id, uint16_t element, Kind kind, float threshold, float hysteresis, uint32_t holdMs, const char *message, bool tracked)
+{
+    if (find(id) >= 0 || rules.size() >= INT16_MAX)
+    {
+        return -1;
+    }
+
+    if (element >= watchOf.size())
+    {
+        watchOf.resize(element + 1, -1);
+    }
+    if (watchOf[element] < 0)
+    {
+        Watch watch = {};
+        watch.element = element;
+        watch.firstRule = -1;
+        watchOf[element] = watches.size();
+        if (!tracked)
+        {
+            polled.push_back(watches.size());
+        }
+        watches.push_back(watch);
+    }
+    size_t w = watchOf[element];
+    if (kind == RATE && !watches[w].hasRate)
+    {
+        rated.push_back(w);
+    }
+
+    Rule rule = {};
+    rule.id = id;
+    rule.message = message;
+    rule.element = element;
+    rule.kind = kind;
+    rule.threshold = kind == RATE ? fabsf(threshold) : threshold;
+    rule.hysteresis = fabsf(hysteresis);
+    rule.holdMs = holdMs;
+    rule.next = watches[w].firstRule;
+    rules.push_back(rule);
+
+    watches[w].firstRule = rules.size() - 1;
+    watches[w].hasRate |= kind == RATE;
+    watches[w].primed = false; // evaluate the new rule on the next run()
+    if (!watches[w].waiting)
+    {
+        watches[w].waiting = true;
+        waiting.push_back(w);
+    }
+    return rules.size() - 1;
+}
+
+int ESPWebCAlarms::find(const char *id) const
+{
+    for (size_t i = 0; i < rules.size(); i++)
+    {
+        if (strcmp(rules[i].id, id) == 0)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void ESPWebCAlarms::run(std::vector<uint32_t> &changed, uint32_t now)
+{
+    runs++;
+    for (size_t i = 0; i < changed.size(); i++)
+    {
+        uint32_t word = changed[i];
+        changed[i] = 0;
+        while (word)
+        {
+            size_t element = i * 32 + __builtin_ctz(word);
+            word &= word - 1;
+            if (element < watchOf.size() && watchOf[element] >= 0)
+            {
+                update(watchOf[element], now);
+            }
+        }
+    }
+
+    if (!polled.empty() && now - lastPoll >= ESPWEBC_ALARM_POLL_MS)
+    {
+        lastPoll = now;
+        for (uint16_t w : polled)
+        {
+            update(w, now);
+        }
+    }
+
+    // A rate decays to 0 when the value stops changing, so it is computed
+    // even without changes
+    if (!rated.empty() && now - lastRate >= ESPWEBC_ALARM_RATE_MS)
+    {
+        lastRate = now;
+        for (uint16_t w : rated)
+        {
+            update(w, now);
+        }
+    }
+
+    // Hold times run out without a change too
+    for (size_t i = 0; i < waiting.size();)
+    {
+        Watch &watch = watches[waiting[i]];
+        update(waiting[i], now);
+        if (watch.primed && watch.pending == 0)
+        {
+            watch.waiting = false;
+            waiting[i] = waiting.back();
+            waiting.pop_back();
+        }
+        else
+        {
+            i++;
+        }
+    }
+}
+
+void ESPWebCAlarms::update(size_t w, uint32_t now)
+{
+    Watch &watch = watches[w];
+    float value;
+    if (watch.seen == runs || !read || !read(watch.element, value))
+    {
+        return;
+    }
+    watch.seen = runs;
+
+    bool changed = !watch.primed || value != watch.last;
+
+    if (watch.hasRate)
+    {
+        if (!watch.primed)
+        {
+            watch.rate = 0;
+            watch.rateBase = value;
+            watch.rateBaseMs = now;
+        }
+        else if (now - watch.rateBaseMs >= ESPWEBC_ALARM_RATE_MS)
+        {
+            float rate = (value - watch.rateBase) * 1000.0f / (now - watch.rateBaseMs);
+            changed |= rate != watch.rate;
+            watch.rate = rate;
+            watch.rateBase = value;
+            watch.rateBaseMs = now;
+        }
+    }
+
+    watch.primed = true;
+    watch.last = value;
+    if (!changed && watch.pending == 0)
+    {
+        return;
+    }
+
+    for (int16_t r = watch.firstRule; r >= 0; r = rules[r].next)
+    {
+        evaluate(watch, rules[r], now);
+    }
+    if (watch.pending > 0 && !watch.waiting)
+    {
+        watch.waiting = true;
+        waiting.push_back(w);
+    }
+}
+
+void ESPWebCAlarms::evaluate(Watch &watch, Rule &rule, uint32_t now)
+{
+    float value = rule.kind == RATE ? fabsf(watch.rate) : watch.last;
+    bool beyond = rule.kind == BELOW ? value < rule.threshold : value > rule.threshold;
+    bool back = rule.kind == BELOW ? value > rule.threshold + rule.hysteresis : value < rule.threshold - rule.hysteresis;
+    bool flip = rule.active ? back : beyond;
+
+    if (!flip)
+    {
+        if (rule.pending)
+        {
+            rule.pending = false;
+            watch.pending--;
+        }
+        return;
+    }
+
+    if (!rule.pending)
+    {
+        rule.pending = true;
+        rule.since = now;
+        watch.pending++;
+    }
+    if (now - rule.since < rule.holdMs)
+    {
+        return;
+    }
+
+    rule.pending = false;
+    watch.pending--;
+    rule.active = !rule.active;
+    if (transition)
+    {
+        transition(rule, rule.kind == RATE ? watch.rate : watch.last);
+    }
+}
@@ -0,0 +1,101 @@
+#ifndef ESPWEBC_ALARMS_H
+#define ESPWEBC_ALARMS_H
+
+#include <Arduino.h>
+#include <functional>
+#include <vector>
+
+// Threshold rules on numeric widgets.
+//
+// Rules are grouped per watched element in a linked list, so a value update
+// only evaluates the rules of that element. run() reads only the watched
+// elements set in the changed bitset, those without change tracking every
+// ESPWEBC_ALARM_POLL_MS, those with a rate rule once per rate window and
+// those with a rule waiting for its hold time. A rule fires only on a
+// transition: it turns active after its condition held for holdMs, and
+// clears once the value is back past the threshold by the hysteresis, again
+// for holdMs.
+
+#ifndef ESPWEBC_ALARM_RATE_MS
+#define ESPWEBC_ALARM_RATE_MS 1000 // window of the rate of change
+#endif
+
+#ifndef ESPWEBC_ALARM_POLL_MS
+#define ESPWEBC_ALARM_POLL_MS 100 // how often elements without an Observable are read
+#endif
+
+class ESPWebCAlarms
+{
+public:
+    enum Kind
+    {
+        ABOVE, // value > threshold
+        BELOW, // value < threshold
+        RATE   // |change per second| > threshold
+    };
+
+    struct Rule
+    {
+        const char *id;
+        const char *message; // nullptr for a generated one
+        uint16_t element;
+        Kind kind;
+        float threshold;
+        float hysteresis;
+        uint32_t holdMs;
+
+        int16_t next; // next rule of the same element, -1 ends the list
+        bool active;
+        bool pending;  // the condition for the next transition holds
+        uint32_t since; // millis() when it started to hold
+    };
+
+    typedef std::function<void(const Rule &rule, float value)> TransitionHandler;
+    typedef std::function<bool(uint16_t element, float &value)> ValueReader;
+
+    void onTransition(TransitionHandler handler) { transition = handler; }
+    void onRead(ValueReader reader) { read = reader; }
+
+    // tracked: every change of the element is reported to run(), otherwise
+    // it is polled
+    int add(const char *id, uint16_t element, Kind kind, float threshold, float hysteresis, uint32_t holdMs, const char *message, bool tracked);
+    int find(const char *id) const;
+    const Rule &rule(size_t index) const { return rules[index]; }
+    size_t size() const { return rules.size(); }
+
+    // changed: bitset of the elements changed since the last call, cleared
+    void run(std::vector<uint32_t> &changed, uint32_t now);
+
+private:
+    struct Watch
+    {
+        uint16_t element;
+        int16_t firstRule;
+        uint8_t pending; // rules waiting for their hold time
+        bool hasRate;
+        bool primed;
+        bool waiting; // in the waiting list
+        float last;
+        float rate;
+        float rateBase;
+        uint32_t rateBaseMs;
+        uint32_t seen; // run() that last updated it
+    };
+
+    void update(size_t watch, uint32_t now);
+    void evaluate(Watch &watch, Rule &rule, uint32_t now);
+
+    std::vector<Rule> rules;
+    std::vector<Watch> watches;
+    std::vector<int16_t> watchOf;  // element -> watch, -1 if none
+    std::vector<uint16_t> polled;  // watches of untracked elements
+    std::vector<uint16_t> rated;   // watches with a rate rule
+    std::vector<uint16_t> waiting; // watches not primed or with pending rules
+    uint32_t runs = 0;
+    uint32_t lastPoll = 0;
+    uint32_t lastRate = 0;
+    TransitionHandler transition;
+    ValueReader read;
+};
+
+#endif // ESPWEBC_ALARMS_H
@@ -0,0 +1,70 @@
+#include "ESPWebCArena.h"
+
+ESPWebCArena::ESPWebCArena(size_t capacity)
+    : buffer((char *)malloc(capacity)), size(buffer ? capacity : 0), lock(xSemaphoreCreateMutex())
+{
+}
+
+ESPWebCArena::Scope::Scope(ESPWebCArena &arena) : arena(arena)
+{
+    xSemaphoreTake(arena.lock, portMAX_DELAY);
+    arena.reset();
+}
+
+ESPWebCArena::Scope::~Scope()
+{
+    if (arena.spilled)
+    {
+        arena.spill = String(); // give the spill back to the heap
+    }
+    xSemaphoreGive(arena.lock);
+}
+
+void ESPWebCArena::reset()
+{
+    used = 0;
+    spilled = false;
+}
+
+size_t ESPWebCArena::write(uint8_t c)
+{
+    return write(&c, 1);
+}
+
+size_t ESPWebCArena::write(const uint8_t *data, size_t len)
+{
+    if (!spilled && used + len > size)
+    {
+        spilled = true;
+        spills++;
+        spill = String();
+        spill.reserve(used + len + size / 2);
+        spill.concat(buffer, used);
+    }
+
+    if (spilled)
+    {
+        spill.concat((const char *)data, len);
+        return len;
+    }
+
+    memcpy(buffer + used, data, len);
+    used += len;
+    if (used > peak)
+    {
+        peak = used;
+    }
+    return len;
+}
+
+String ESPWebCArena::toString() const
+{
+    if (spilled)
+    {
+        return spill;
+    }
+    String out;
+    out.reserve(used);
+    out.concat(buffer, used);
+    return out;
+}
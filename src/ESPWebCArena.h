@@ -0,0 +1,56 @@
+#ifndef ESPWEBC_ARENA_H
+#define ESPWEBC_ARENA_H
+
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+// Scratch buffer for building responses. It is allocated once and reused, so
+// producers write into it instead of growing temporary Strings with +=, and
+// the heap only sees the one exact-size copy handed to the web server.
+// One producer at a time: take it with ESPWebCArena::Scope, which resets it.
+// Output that does not fit spills into a heap String and is counted.
+
+#ifndef ESPWEBC_ARENA_SIZE
+#define ESPWEBC_ARENA_SIZE 4096
+#endif
+
+class ESPWebCArena : public Print
+{
+public:
+    explicit ESPWebCArena(size_t capacity = ESPWEBC_ARENA_SIZE);
+
+    class Scope
+    {
+    public:
+        explicit Scope(ESPWebCArena &arena);
+        ~Scope();
+        ESPWebCArena &arena;
+    };
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *data, size_t len) override;
+    using Print::write;
+
+    size_t length() const { return spilled ? spill.length() : used; }
+    const char *data() const { return spilled ? spill.c_str() : buffer; } // not NUL-terminated
+    String toString() const; // exact-size copy of what was written
+
+    size_t capacity() const { return size; }
+    size_t highWater() const { return peak; }
+    uint32_t overflows() const { return spills; }
+
+private:
+    void reset();
+
+    char *buffer;
+    size_t size;
+    size_t used = 0;
+    size_t peak = 0;
+    bool spilled = false;
+    String spill;
+    uint32_t spills = 0;
+    SemaphoreHandle_t lock;
+};
+
+#endif // ESPWEBC_ARENA_H
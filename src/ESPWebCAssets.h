@@ -0,0 +1,1065 @@
+// Generated by extras/embed_assets.py, do not edit.
+#ifndef ESPWEBC_ASSETS_H
+#define ESPWEBC_ASSETS_H
+
+#include <Arduino.h>
+
+struct ESPWebCAsset
+{
+    const char *path;
+    const char *type;
+    const uint8_t *data; // gzip
+    size_t length;
+    const char *etag;
+};
+
+// dashboard.html: 2295 bytes, 795 gzipped
+static const uint8_t ESPWEBC_ASSET_0[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9d, 0x56, 0x4d, 0x73, 0xd3, 0x30,
+    0x10, 0xbd, 0xf3, 0x2b, 0x44, 0x2f, 0x86, 0x19, 0x9c, 0x34, 0x1d, 0x3a, 0x53, 0xf2, 0x75, 0xa0,
+    0x01, 0x86, 0xa1, 0x40, 0x67, 0x5a, 0x06, 0x38, 0xca, 0xd2, 0xc6, 0x16, 0x91, 0x25, 0x23, 0x29,
+    0x49, 0xf3, 0xef, 0x59, 0x7d, 0xc4, 0x8d, 0x49, 0xda, 0x12, 0x2e, 0x4e, 0xb4, 0x7a, 0xfb, 0x76,
+    0xf7, 0xed, 0x4a, 0xf6, 0xf8, 0xf9, 0xec, 0xeb, 0xe5, 0xed, 0xcf, 0xeb, 0x77, 0xa4, 0x72, 0xb5,
+    0x9c, 0x8e, 0xd3, 0x13, 0x28, 0x9f, 0x8e, 0x9d, 0x70, 0x12, 0xa6, 0x33, 0x6a, 0xab, 0x42, 0x53,
+    0xc3, 0xc7, 0xfd, 0x68, 0x78, 0x36, 0xae, 0xc1, 0x51, 0xc2, 0x2a, 0x6a, 0x2c, 0xb8, 0x49, 0xf6,
+    0xed, 0xf6, 0x7d, 0x7e, 0x91, 0x4d, 0xa3, 0x55, 0xd1, 0x1a, 0x26, 0xd9, 0x4a, 0xc0, 0xba, 0xd1,
+    0xc6, 0x65, 0x84, 0x69, 0xe5, 0x40, 0x21, 0x6a, 0x2d, 0xb8, 0xab, 0x26, 0x1c, 0x56, 0x82, 0x41,
+    0x1e, 0x16, 0xaf, 0x88, 0x50, 0xc2, 0x09, 0x2a, 0x73, 0xcb, 0xa8, 0x84, 0xc9, 0x20, 0x43, 0x6a,
+    0x29, 0xd4, 0x82, 0x18, 0x90, 0x93, 0xcc, 0xba, 0x8d, 0x04, 0x5b, 0x01, 0x20, 0x4b, 0x65, 0x60,
+    0x3e, 0xc9, 0xfa, 0xc1, 0xd4, 0x63, 0xd6, 0x7a, 0xa4, 0x65, 0x46, 0x34, 0x8e, 0x58, 0xc3, 0x70,
+    0x87, 0x63, 0x92, 0xbd, 0x5f, 0x68, 0x1f, 0xf7, 0xa3, 0x1d, 0x01, 0xfd, 0x58, 0x45, 0xa1, 0xf9,
+    0x06, 0x57, 0x5c, 0xac, 0x88, 0xe0, 0x93, 0x4c, 0x69, 0x27, 0xe6, 0x82, 0x51, 0x27, 0xb4, 0x7a,
+    0x4b, 0x95, 0x02, 0x83, 0x49, 0x4a, 0x6a, 0x6d, 0x77, 0x2b, 0x2f, 0xe2, 0x1e, 0x7a, 0x8a, 0x3d,
+    0xbf, 0x8f, 0x58, 0xd5, 0x61, 0x2f, 0xe1, 0x77, 0x30, 0x09, 0xe1, 0x13, 0x6c, 0xa8, 0xda, 0x73,
+    0xfd, 0x0c, 0xd6, 0xd2, 0x12, 0x0e, 0x7b, 0xd7, 0x69, 0xd3, 0x57, 0x81, 0xce, 0x29, 0xeb, 0x84,
+    0x64, 0x52, 0x5b, 0xc8, 0x8b, 0xa5, 0x73, 0x88, 0xf4, 0xb2, 0x52, 0x91, 0x12, 0x8c, 0xb6, 0x10,
+    0x2a, 0x80, 0xde, 0x86, 0x75, 0x76, 0xc8, 0x31, 0x23, 0x5a, 0x31, 0x29, 0xd8, 0x22, 0x99, 0xbf,
+    0xec, 0x84, 0x7f, 0xf1, 0x32, 0x9b, 0xfe, 0x18, 0xf7, 0x23, 0xd0, 0xeb, 0x87, 0xc1, 0xef, 0x7f,
+    0x5a, 0xfd, 0xe8, 0xaa, 0xa0, 0x3e, 0x2c, 0x21, 0xc1, 0x16, 0x7a, 0x32, 0xc9, 0xb8, 0xb0, 0x8d,
+    0xa4, 0x9b, 0x21, 0x99, 0x4b, 0xb8, 0x1b, 0x85, 0x67, 0xce, 0x85, 0x01, 0xe6, 0x99, 0x87, 0x38,
+    0x06, 0x72, 0x59, 0xab, 0x11, 0xa1, 0x52, 0x94, 0xa8, 0x92, 0x83, 0xda, 0x46, 0x68, 0x6e, 0x1d,
+    0x35, 0x6e, 0x14, 0xf8, 0x1e, 0x65, 0xec, 0x78, 0x32, 0x1c, 0x29, 0x30, 0xad, 0x97, 0xa8, 0xcb,
+    0x90, 0x9b, 0x9f, 0x82, 0x8f, 0x75, 0x90, 0x97, 0x4a, 0x9c, 0xb9, 0xd8, 0xa7, 0xc4, 0x17, 0x66,
+    0x6e, 0x48, 0x5e, 0x5f, 0x34, 0xc8, 0x56, 0x81, 0x28, 0x2b, 0xb7, 0x5d, 0xd5, 0xd4, 0x94, 0x42,
+    0xe5, 0x26, 0xda, 0x06, 0xa7, 0x68, 0x4b, 0xd4, 0x48, 0x5e, 0x0d, 0x5a, 0xee, 0x5b, 0x3f, 0xff,
+    0xbe, 0x3b, 0xd5, 0x20, 0x45, 0x8e, 0xe2, 0x44, 0xdc, 0x59, 0x8b, 0x9b, 0x41, 0x1c, 0x42, 0xb1,
+    0x13, 0x3e, 0xc6, 0x18, 0x92, 0xf3, 0xe6, 0x8e, 0x9c, 0x8e, 0x48, 0x43, 0x39, 0x17, 0xaa, 0xcc,
+    0x25, 0xcc, 0x7d, 0x1a, 0x67, 0x21, 0x24, 0x12, 0x9f, 0x05, 0x61, 0xb7, 0xb4, 0x47, 0xea, 0xb1,
+    0x2d, 0xc4, 0xe9, 0xa6, 0x5b, 0xc6, 0xee, 0x1c, 0x71, 0xa3, 0x1b, 0xae, 0xd7, 0x7f, 0x67, 0xb6,
+    0xad, 0xfe, 0xac, 0x5b, 0x7d, 0x9a, 0x86, 0x1b, 0x90, 0xd8, 0x4a, 0xf2, 0x5d, 0xf0, 0x12, 0xdc,
+    0xfd, 0x8c, 0x24, 0xd0, 0x01, 0xf6, 0x3c, 0x1d, 0xfc, 0x2c, 0x88, 0xb2, 0x0e, 0x7e, 0x91, 0x44,
+    0xc4, 0x13, 0x72, 0x2f, 0xdc, 0xce, 0xdf, 0x83, 0x69, 0x7a, 0x82, 0x06, 0x9b, 0x3a, 0xfb, 0x87,
+    0xc4, 0x49, 0xab, 0x92, 0xd2, 0x0a, 0xf6, 0xea, 0x68, 0xb9, 0xd2, 0x11, 0x99, 0x5e, 0xe3, 0xff,
+    0xe3, 0xcb, 0xf1, 0x0c, 0xff, 0x59, 0xcc, 0x11, 0x9a, 0xdf, 0x56, 0x50, 0x1f, 0x97, 0xdc, 0x16,
+    0x74, 0x5f, 0xef, 0x8a, 0xca, 0xa5, 0x9f, 0x1d, 0x98, 0xd3, 0xa5, 0x74, 0xbb, 0xa7, 0xbf, 0xa2,
+    0xaa, 0x84, 0x10, 0xe2, 0x05, 0xac, 0xd0, 0x19, 0x0f, 0xff, 0x27, 0xf8, 0x8d, 0x23, 0xf9, 0x77,
+    0xc4, 0x3d, 0x32, 0xe9, 0x93, 0x7e, 0x82, 0xea, 0xca, 0x63, 0x9e, 0x64, 0xe2, 0xd4, 0x2c, 0x9e,
+    0x20, 0x9a, 0x21, 0x64, 0x4f, 0x83, 0x87, 0xf5, 0x4e, 0xf2, 0x86, 0x9b, 0xa5, 0x34, 0x7a, 0x3d,
+    0x24, 0xa7, 0xbd, 0x37, 0xa3, 0x6e, 0x8b, 0x24, 0x2d, 0x40, 0xfe, 0xc7, 0xa9, 0xda, 0x5e, 0x0f,
+    0xe7, 0x9d, 0x66, 0x09, 0xd5, 0x2c, 0x1d, 0x71, 0x9b, 0x06, 0x7c, 0x01, 0xc0, 0x16, 0x85, 0xbe,
+    0x8b, 0x53, 0x22, 0x35, 0x5b, 0xb4, 0x2f, 0xcf, 0x07, 0x3a, 0xdf, 0xe5, 0x0a, 0x97, 0xfe, 0x15,
+    0xba, 0x6d, 0xef, 0xff, 0x58, 0x62, 0x48, 0x38, 0x2d, 0x92, 0x80, 0xad, 0x66, 0x96, 0xae, 0xa0,
+    0x0d, 0x82, 0x37, 0xf8, 0xe1, 0x30, 0xe9, 0x2e, 0xb8, 0x41, 0x70, 0x57, 0xcc, 0x3d, 0x3e, 0x26,
+    0x81, 0x9a, 0x7f, 0x26, 0xbc, 0xf4, 0xe8, 0xc7, 0x19, 0x4f, 0xd6, 0x42, 0xe1, 0x90, 0xf6, 0x50,
+    0x8d, 0xf0, 0x96, 0xe9, 0xa5, 0x77, 0x39, 0xd8, 0x66, 0x0d, 0x05, 0xcb, 0x4e, 0x1e, 0x0d, 0xf0,
+    0x41, 0x13, 0xa7, 0xc9, 0xbb, 0x9b, 0x6b, 0xf2, 0x1d, 0x0a, 0x72, 0xa9, 0xd5, 0x5c, 0x74, 0x06,
+    0xf4, 0x81, 0x97, 0x14, 0x6f, 0x65, 0x9f, 0xb6, 0x88, 0xf0, 0x1d, 0x80, 0x37, 0xac, 0xff, 0xc0,
+    0x79, 0xf6, 0x07, 0xf8, 0x96, 0x4f, 0x5e, 0xf7, 0x08, 0x00, 0x00,
+};
+
+// dash.js: 35741 bytes, 7983 gzipped
+static const uint8_t ESPWEBC_ASSET_1[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x3d, 0xdb, 0x72, 0xdb, 0xb8,
+    0x92, 0xef, 0x53, 0x35, 0xff, 0x80, 0x70, 0x52, 0x23, 0x6a, 0x47, 0xa6, 0x9d, 0x99, 0xcc, 0xd6,
+    0x1e, 0x3b, 0x4e, 0x2a, 0x89, 0x7d, 0x26, 0xde, 0x93, 0xc4, 0xa9, 0xd8, 0x73, 0x49, 0x79, 0xbd,
+    0x63, 0x4a, 0x84, 0x24, 0x1e, 0x53, 0xa2, 0x0e, 0x49, 0xd9, 0xd1, 0x3a, 0xfa, 0x8a, 0x7d, 0x38,
+    0x2f, 0xfb, 0x37, 0xfb, 0x27, 0xfb, 0x25, 0xdb, 0xdd, 0x00, 0x48, 0x00, 0x04, 0x29, 0x2a, 0xc9,
+    0x9c, 0x4b, 0xd5, 0xf8, 0xc1, 0x92, 0x48, 0xa0, 0x01, 0x34, 0xfa, 0x86, 0x46, 0xa3, 0xb1, 0xbb,
+    0xcb, 0xde, 0xa4, 0x49, 0x12, 0xcf, 0x27, 0x2c, 0x9e, 0x17, 0x3c, 0xbb, 0x09, 0x93, 0x01, 0xcb,
+    0xf8, 0x22, 0x09, 0x47, 0x3c, 0x62, 0xc3, 0x15, 0x2b, 0xa6, 0x9c, 0xa5, 0x73, 0xce, 0xc6, 0x59,
+    0x3a, 0x63, 0xbb, 0xb7, 0x71, 0x34, 0xe1, 0x45, 0x1e, 0xfc, 0x39, 0x4f, 0xe7, 0x5f, 0x7e, 0x91,
+    0xf0, 0x82, 0x2d, 0x17, 0x51, 0x58, 0xf0, 0x13, 0x59, 0x97, 0x1d, 0xb2, 0xef, 0xf7, 0xf6, 0xf6,
+    0x0e, 0xbe, 0xfc, 0x62, 0x77, 0x97, 0x1d, 0x85, 0xf9, 0x74, 0x98, 0x86, 0x59, 0xc4, 0x16, 0xe1,
+    0x84, 0xb3, 0x7c, 0x9a, 0xde, 0xce, 0x07, 0x6c, 0xe7, 0x01, 0xbb, 0x9d, 0xf2, 0x39, 0x01, 0x1e,
+    0xc7, 0xd9, 0xec, 0x36, 0xcc, 0x38, 0x8b, 0x52, 0x9e, 0xb3, 0x79, 0x5a, 0xb0, 0x7c, 0x91, 0xc4,
+    0x05, 0x93, 0xcd, 0x40, 0x97, 0xa8, 0x6a, 0x2e, 0x9a, 0x1a, 0x2d, 0xb3, 0x8c, 0xcf, 0x8b, 0x37,
+    0x08, 0xec, 0x10, 0xe0, 0x88, 0x56, 0x4e, 0x46, 0xe9, 0x3c, 0x67, 0xe1, 0x4d, 0x18, 0x27, 0xe1,
+    0x30, 0xe1, 0x58, 0x07, 0x41, 0x27, 0xe9, 0x08, 0xba, 0xb3, 0x1b, 0xe3, 0xdb, 0x20, 0xbf, 0x99,
+    0x00, 0xe4, 0x2c, 0x2e, 0xf8, 0x97, 0x5f, 0xe0, 0x83, 0x42, 0xfe, 0x12, 0x75, 0x0f, 0xd9, 0x9c,
+    0xdf, 0xb2, 0x33, 0x5e, 0xf8, 0x7d, 0x00, 0x49, 0x40, 0xbd, 0x71, 0xb8, 0x93, 0xa7, 0x49, 0x1c,
+    0x31, 0xf8, 0x32, 0x0e, 0xe7, 0x1e, 0xdb, 0x79, 0xcc, 0x3c, 0x7a, 0x42, 0x3f, 0x07, 0xd4, 0x46,
+    0xbe, 0x9a, 0x0d, 0xd3, 0x84, 0x41, 0xa9, 0x65, 0x2e, 0xb0, 0xc5, 0xdf, 0x17, 0x59, 0x98, 0x53,
+    0xab, 0xbf, 0x8a, 0x26, 0x82, 0xc5, 0xea, 0xcb, 0x2f, 0xc6, 0xcb, 0xf9, 0xa8, 0x88, 0xd3, 0x39,
+    0xc3, 0x17, 0x67, 0x54, 0xcb, 0xc7, 0xaf, 0x7d, 0x76, 0xf7, 0xe5, 0x17, 0x0c, 0xfe, 0x44, 0xa7,
+    0x46, 0x49, 0x98, 0xe7, 0x1c, 0x3b, 0x84, 0x2f, 0x03, 0xc2, 0x85, 0xbf, 0xfb, 0x1f, 0xf9, 0x37,
+    0xbb, 0xd8, 0x31, 0x2c, 0x87, 0x68, 0xc8, 0x8b, 0x55, 0x82, 0x08, 0x10, 0xdd, 0xf1, 0xe4, 0x9b,
+    0x78, 0xcc, 0x7c, 0x59, 0x3f, 0x88, 0xe7, 0xa3, 0x64, 0x19, 0xf1, 0xdc, 0xc7, 0x61, 0x64, 0x7c,
+    0xb2, 0x4c, 0xc2, 0xcc, 0xeb, 0xb3, 0x0f, 0x1f, 0x98, 0xab, 0x04, 0xbc, 0xea, 0x57, 0x40, 0x55,
+    0xf1, 0x4d, 0x60, 0x87, 0x59, 0x38, 0x8f, 0xf2, 0x66, 0xa8, 0x43, 0x03, 0xaa, 0x2c, 0x7d, 0xa0,
+    0x8f, 0x76, 0x1e, 0xce, 0xf0, 0x9d, 0xaa, 0x3c, 0x8e, 0xe7, 0x91, 0xef, 0x8f, 0xfa, 0xec, 0xf0,
+    0x31, 0x1b, 0x05, 0x79, 0x11, 0x66, 0x45, 0xfe, 0x73, 0x5c, 0x4c, 0xa9, 0x35, 0x68, 0xe7, 0xeb,
+    0xaf, 0xd9, 0xbd, 0x8b, 0x72, 0x5e, 0x60, 0x06, 0xf4, 0xc1, 0x89, 0x5f, 0xb2, 0x95, 0xcb, 0xaa,
+    0x23, 0xa3, 0xbe, 0xc2, 0x5c, 0xc6, 0x8b, 0x65, 0x36, 0x17, 0x8d, 0x3e, 0x61, 0x57, 0xf7, 0xef,
+    0xa8, 0x6f, 0xeb, 0x9d, 0xfb, 0x77, 0xf8, 0x28, 0xc8, 0x97, 0xc3, 0xbc, 0xc8, 0x80, 0x0d, 0xfc,
+    0xef, 0xfa, 0xeb, 0x2b, 0xb6, 0xcf, 0x3c, 0xec, 0xec, 0x5a, 0x92, 0x03, 0xd2, 0x89, 0xe0, 0x80,
+    0x8a, 0xb4, 0xc4, 0xf4, 0x0a, 0x5a, 0x06, 0x92, 0x9d, 0x86, 0x40, 0xae, 0xc5, 0x80, 0xa5, 0x50,
+    0x22, 0xbb, 0x8d, 0x73, 0x5e, 0x95, 0xc7, 0xc9, 0x14, 0xa8, 0xc8, 0xa7, 0x9c, 0x17, 0x16, 0x39,
+    0xbc, 0x38, 0x7f, 0xf5, 0x92, 0x88, 0x61, 0x00, 0x78, 0x49, 0xd2, 0x0c, 0xd1, 0xe5, 0x59, 0x84,
+    0xa1, 0xf0, 0x28, 0x0a, 0x40, 0xf7, 0xc5, 0x93, 0x43, 0x8f, 0x1e, 0xec, 0xb3, 0xfb, 0x77, 0xf4,
+    0x65, 0x7d, 0xe0, 0x95, 0x5d, 0xd7, 0x2a, 0x0b, 0x2a, 0x3d, 0xac, 0x11, 0x9f, 0x36, 0xc5, 0x1a,
+    0x3b, 0x04, 0x30, 0x12, 0x5f, 0xd4, 0xe9, 0x97, 0xdd, 0xd0, 0x30, 0x78, 0xf5, 0x08, 0xb9, 0x89,
+    0x66, 0xed, 0xd0, 0x43, 0x38, 0x1e, 0x03, 0x09, 0x10, 0xee, 0xe0, 0xd7, 0x43, 0xef, 0xfe, 0x1d,
+    0x7e, 0xae, 0x3d, 0x85, 0xdf, 0xc7, 0x8f, 0x80, 0x35, 0xd8, 0x34, 0xe3, 0xe3, 0x43, 0xaf, 0x62,
+    0xc6, 0xaf, 0xe0, 0x35, 0xb5, 0xb0, 0xf6, 0x1e, 0x3f, 0xda, 0x85, 0x12, 0xf0, 0x1f, 0x1e, 0x3f,
+    0xbe, 0x92, 0x5d, 0x5a, 0x1b, 0x73, 0x76, 0xf5, 0x28, 0x56, 0xed, 0x29, 0xf0, 0xed, 0x4d, 0xee,
+    0xc6, 0x04, 0x89, 0x66, 0xaf, 0xc4, 0x75, 0x92, 0x86, 0x11, 0x0d, 0xd0, 0x2f, 0x47, 0x25, 0xe1,
+    0x8f, 0x79, 0x31, 0x9a, 0xfa, 0xbd, 0xaa, 0x7b, 0xbd, 0x7e, 0x35, 0xea, 0x00, 0x66, 0x70, 0xee,
+    0x67, 0x3c, 0x5f, 0xc0, 0x4b, 0x8e, 0xc4, 0xa9, 0xbe, 0x07, 0x05, 0x70, 0xbb, 0xdf, 0xaf, 0x95,
+    0x45, 0xf4, 0x40, 0x31, 0x0d, 0x73, 0xf8, 0x37, 0x86, 0x89, 0xf3, 0xc5, 0x84, 0xcc, 0x42, 0x68,
+    0x8f, 0xa5, 0x63, 0x06, 0x25, 0x03, 0xfa, 0xf1, 0x34, 0x49, 0xfc, 0xdd, 0x47, 0xa5, 0x38, 0x39,
+    0xf4, 0xfc, 0x8b, 0xff, 0xf4, 0x2e, 0xbf, 0xe9, 0x7b, 0xbb, 0x13, 0x73, 0x0e, 0xd4, 0x9f, 0x3e,
+    0x5f, 0x61, 0x14, 0xf9, 0x04, 0xe5, 0xe2, 0xc1, 0xa5, 0x9a, 0x53, 0xf5, 0xb7, 0xae, 0x7e, 0xae,
+    0xf5, 0x8e, 0x8e, 0xb0, 0xbc, 0xef, 0x13, 0xb3, 0xdd, 0xad, 0xfb, 0x1a, 0xa9, 0xbf, 0x04, 0x34,
+    0xb9, 0xa8, 0x16, 0x64, 0x72, 0x31, 0x4d, 0x97, 0x05, 0x1b, 0x02, 0xf9, 0x5f, 0xa3, 0xbe, 0xc0,
+    0x42, 0x28, 0x9d, 0x07, 0x2c, 0x4f, 0x59, 0x38, 0x67, 0xcb, 0x79, 0xc6, 0xc3, 0xd1, 0x94, 0x84,
+    0xf0, 0xf3, 0xa3, 0xd7, 0x04, 0xcd, 0x7f, 0xfa, 0x86, 0xcd, 0xd2, 0x88, 0xf7, 0x41, 0x87, 0x24,
+    0x2b, 0x36, 0xe3, 0x21, 0xc8, 0xdb, 0x59, 0x9c, 0xe7, 0xa4, 0x70, 0xa8, 0xfb, 0x8e, 0x29, 0x3a,
+    0x2b, 0x5b, 0xf5, 0x97, 0x59, 0x52, 0x22, 0x00, 0x09, 0xf5, 0x1e, 0x3c, 0x40, 0x91, 0x13, 0xa5,
+    0xa3, 0xe5, 0x0c, 0x94, 0x41, 0xf0, 0x97, 0x25, 0xcf, 0x56, 0x67, 0x3c, 0xe1, 0xa3, 0x22, 0xcd,
+    0xfc, 0x2b, 0xd0, 0x64, 0xd7, 0x17, 0x82, 0xdc, 0xee, 0xdf, 0x41, 0xd9, 0xb5, 0x77, 0x79, 0x05,
+    0x28, 0x14, 0x33, 0x6d, 0xb0, 0x05, 0x96, 0x04, 0xa6, 0x28, 0x01, 0x8d, 0xa0, 0xf7, 0x05, 0x3f,
+    0x4e, 0x38, 0xfe, 0xf2, 0x7b, 0xf8, 0xba, 0x57, 0x8a, 0x5d, 0xf8, 0x11, 0x64, 0x1c, 0x99, 0xa8,
+    0x57, 0xa1, 0xa4, 0xa7, 0xbf, 0xc5, 0x36, 0xe1, 0x35, 0x34, 0x29, 0x9f, 0x96, 0x80, 0xa7, 0x3c,
+    0x8c, 0x82, 0x70, 0xb1, 0xe0, 0xf3, 0xe8, 0xf9, 0x34, 0x4e, 0x22, 0x1f, 0xcb, 0x4b, 0x94, 0xdf,
+    0x84, 0x19, 0xf4, 0x2d, 0x8c, 0x00, 0x1d, 0xf9, 0x4f, 0x71, 0x78, 0x06, 0xa8, 0x05, 0x54, 0x1f,
+    0x82, 0xd6, 0x49, 0x72, 0x7e, 0xc0, 0x00, 0x83, 0x67, 0x88, 0x7a, 0xa8, 0xc6, 0x09, 0xdf, 0x3f,
+    0xf3, 0xa1, 0x2c, 0xb3, 0x58, 0x42, 0x1f, 0xf2, 0xb2, 0xb2, 0x41, 0xea, 0xd0, 0x58, 0xb2, 0x7a,
+    0x2b, 0xdf, 0xf8, 0xc8, 0x2a, 0x25, 0x0e, 0x4f, 0x87, 0x7f, 0x06, 0x4c, 0x05, 0xd7, 0x7c, 0x25,
+    0x5f, 0x04, 0x40, 0x98, 0xc7, 0x30, 0x6d, 0x3e, 0x68, 0x31, 0x93, 0x6a, 0x05, 0x9a, 0xb8, 0x40,
+    0x88, 0x8e, 0x29, 0x50, 0xcd, 0x12, 0x4d, 0xcf, 0x56, 0x27, 0x11, 0x54, 0xd4, 0xa9, 0x0e, 0x27,
+    0x49, 0xd6, 0xa9, 0x51, 0xae, 0xf6, 0x2e, 0x28, 0x56, 0x0b, 0xe0, 0xa6, 0x43, 0x40, 0xe8, 0x68,
+    0xca, 0x47, 0xd7, 0xc3, 0xf4, 0x7d, 0xcf, 0x49, 0xe9, 0xaa, 0x3c, 0x95, 0x02, 0x25, 0x7b, 0x48,
+    0xac, 0x7f, 0x11, 0x47, 0x97, 0x36, 0xa9, 0x43, 0x51, 0x60, 0x50, 0xa3, 0x8d, 0x70, 0xf2, 0x9a,
+    0x94, 0x0c, 0x36, 0x73, 0xf6, 0xe6, 0xe9, 0xeb, 0x1e, 0x92, 0x8e, 0xf3, 0xed, 0xd1, 0xc9, 0x4f,
+    0xed, 0xed, 0xc7, 0xf3, 0x39, 0xcf, 0xce, 0x81, 0xe3, 0x5b, 0x7a, 0xa0, 0x31, 0x9b, 0x94, 0x63,
+    0xfd, 0x9a, 0x18, 0x12, 0xf6, 0x52, 0x39, 0x39, 0x06, 0x71, 0xd7, 0x28, 0x01, 0xde, 0x22, 0x0d,
+    0x94, 0x16, 0x5a, 0x2e, 0xd8, 0x88, 0x4c, 0xa7, 0x30, 0x49, 0x86, 0xe1, 0xe8, 0xba, 0x6a, 0x33,
+    0xe7, 0xc5, 0x79, 0x3c, 0xe3, 0xc0, 0xa3, 0xbe, 0xd9, 0xc8, 0xc0, 0x32, 0xd2, 0xf4, 0xe9, 0x32,
+    0x18, 0x43, 0xf6, 0x5a, 0xc8, 0x43, 0xdd, 0xda, 0x7a, 0x7c, 0xc8, 0xf6, 0x50, 0xed, 0xec, 0x42,
+    0xa3, 0x0a, 0xea, 0x13, 0xe4, 0xfd, 0x43, 0xd0, 0x3c, 0x55, 0x39, 0x52, 0x9c, 0x3d, 0xbd, 0x50,
+    0xbb, 0x24, 0x75, 0x90, 0xc7, 0xbd, 0x52, 0xba, 0xa6, 0xd7, 0xce, 0xf9, 0x28, 0xa6, 0x59, 0x7a,
+    0x4b, 0x06, 0xdb, 0x71, 0x96, 0x01, 0xc7, 0xf7, 0x5e, 0xf3, 0xe2, 0x36, 0xcd, 0xae, 0x4b, 0xb1,
+    0xcc, 0x6e, 0x43, 0x61, 0x4a, 0xa6, 0xd7, 0xd0, 0x19, 0xf6, 0x4d, 0x25, 0xaf, 0xc1, 0xa6, 0x28,
+    0x96, 0x39, 0xce, 0x61, 0x8b, 0x98, 0xd4, 0xf4, 0x42, 0x59, 0x11, 0xad, 0x5d, 0x5f, 0xaf, 0xb3,
+    0xae, 0x0d, 0xcb, 0x60, 0xb9, 0xba, 0xa4, 0xe5, 0xd8, 0x57, 0xb2, 0x6c, 0x00, 0x60, 0x9a, 0xf0,
+    0x80, 0x1e, 0x88, 0xc7, 0x86, 0x06, 0x01, 0x2b, 0x08, 0xd0, 0xb7, 0x52, 0xa2, 0xd9, 0xec, 0xd7,
+    0x47, 0xcd, 0x70, 0x45, 0x83, 0x25, 0x03, 0x83, 0xc6, 0x38, 0xbe, 0x81, 0x2f, 0x2f, 0xe3, 0xbc,
+    0xe0, 0x40, 0xd6, 0xbe, 0x77, 0x74, 0xfa, 0xea, 0x79, 0x0a, 0x95, 0xe1, 0x19, 0xc8, 0x60, 0x8e,
+    0xe6, 0x95, 0xd1, 0x03, 0x20, 0xc2, 0x1f, 0x40, 0xe8, 0x80, 0x8c, 0xe3, 0x30, 0xd9, 0x23, 0x10,
+    0x3c, 0x45, 0x4a, 0x64, 0x18, 0x95, 0x36, 0x3e, 0x98, 0x5e, 0x2c, 0xca, 0xd2, 0x45, 0x04, 0x56,
+    0xbe, 0x94, 0xb3, 0x49, 0x9a, 0xf3, 0xd7, 0x69, 0x11, 0x8f, 0x63, 0xc0, 0x42, 0xac, 0xe1, 0x50,
+    0x88, 0x96, 0xaa, 0x6e, 0xb3, 0x70, 0xf1, 0xca, 0x42, 0x9e, 0x59, 0x59, 0x2c, 0x11, 0x84, 0xe0,
+    0x47, 0xbe, 0x6a, 0x01, 0x61, 0x15, 0xb5, 0x00, 0x21, 0x19, 0x77, 0x02, 0x63, 0x14, 0xf4, 0xc4,
+    0x52, 0xa1, 0x24, 0xdb, 0x6a, 0x2c, 0x20, 0x61, 0xee, 0x59, 0x2d, 0xf6, 0x6d, 0xb1, 0x5a, 0x51,
+    0x80, 0x57, 0x2d, 0x92, 0x80, 0x40, 0x44, 0x3d, 0x98, 0x67, 0xd5, 0x1d, 0xa4, 0xe3, 0x71, 0xba,
+    0x9c, 0x47, 0x81, 0xd7, 0xc6, 0xb5, 0xe5, 0x24, 0x9d, 0x67, 0x20, 0x12, 0x58, 0x08, 0x95, 0x6f,
+    0xb8, 0x5a, 0x45, 0xe9, 0x83, 0x15, 0x6f, 0x7e, 0x96, 0xcb, 0x2b, 0x7b, 0xe1, 0x23, 0x81, 0xbc,
+    0x4a, 0x87, 0xa8, 0x6f, 0x22, 0x5e, 0x88, 0x5e, 0xe8, 0x00, 0xe2, 0x5c, 0xbe, 0x3d, 0x64, 0xbb,
+    0x4f, 0xe7, 0x30, 0xdf, 0x71, 0xf4, 0xe1, 0x96, 0x0f, 0x4f, 0xcf, 0x3e, 0xc4, 0x6f, 0xa6, 0xb0,
+    0x4e, 0x84, 0x8f, 0x30, 0x82, 0x7f, 0x69, 0xf4, 0xe1, 0x19, 0xac, 0x21, 0xaf, 0x9f, 0xc1, 0x30,
+    0x57, 0x1f, 0x4e, 0x8e, 0x45, 0xad, 0x0f, 0xa7, 0x0b, 0x9e, 0x85, 0xec, 0x55, 0x3c, 0x8f, 0x77,
+    0x63, 0xb0, 0x9f, 0xf2, 0xc2, 0x9f, 0x87, 0x37, 0xf1, 0x24, 0x04, 0xdd, 0x1d, 0x80, 0x19, 0x98,
+    0x3d, 0x9d, 0xa0, 0xde, 0x38, 0x30, 0x5b, 0x3c, 0x4f, 0x97, 0x60, 0x2f, 0x81, 0x90, 0x06, 0x0a,
+    0xc5, 0xaf, 0xb4, 0x36, 0xe8, 0xe1, 0x42, 0xef, 0x16, 0xd6, 0x0c, 0x20, 0x0d, 0x00, 0xe5, 0x15,
+    0x98, 0x59, 0xf8, 0x9e, 0x2a, 0xbc, 0x49, 0x61, 0x41, 0x9b, 0xb3, 0xc7, 0x6c, 0x4f, 0x1f, 0x9b,
+    0x80, 0x35, 0x05, 0x62, 0x25, 0x89, 0x0a, 0xfa, 0x37, 0x46, 0x83, 0x25, 0xaf, 0x96, 0x57, 0xd4,
+    0xc4, 0x19, 0x36, 0x81, 0xbc, 0x06, 0xcd, 0xee, 0x1d, 0x58, 0x2f, 0x5f, 0xa5, 0x37, 0xa4, 0x88,
+    0x84, 0x92, 0xd6, 0xfb, 0x7a, 0x7e, 0xfa, 0xe3, 0xf3, 0x17, 0xbf, 0x9e, 0xbf, 0x78, 0x7b, 0x7c,
+    0xf6, 0xe2, 0xf4, 0xe5, 0x11, 0x94, 0x79, 0xb0, 0x47, 0x5a, 0x7c, 0x11, 0xbf, 0x07, 0xed, 0xa4,
+    0x17, 0x7d, 0x79, 0xfa, 0xfa, 0x87, 0x5f, 0xdf, 0x40, 0xc1, 0xb3, 0x5f, 0x8f, 0x7e, 0x7c, 0xfb,
+    0xf4, 0xfc, 0xe4, 0xf4, 0xb5, 0x58, 0x3c, 0x53, 0xf9, 0x59, 0x0c, 0x12, 0x3f, 0xe7, 0x50, 0x34,
+    0xca, 0xb5, 0xde, 0xbf, 0x04, 0xad, 0xc0, 0x94, 0x2a, 0x09, 0x61, 0x75, 0xb8, 0x62, 0x3b, 0xec,
+    0xd5, 0xe9, 0x4f, 0xc7, 0x47, 0xec, 0xf4, 0xc7, 0xf3, 0xb3, 0x93, 0xa3, 0x63, 0xe4, 0xcb, 0x21,
+    0x87, 0x79, 0x06, 0x1e, 0xcd, 0x63, 0x34, 0xc5, 0x26, 0x49, 0x3a, 0x44, 0x91, 0x52, 0x0d, 0x22,
+    0xce, 0x4b, 0xa2, 0x43, 0x80, 0xb5, 0xb1, 0x94, 0xcd, 0x9d, 0xcc, 0xe3, 0x22, 0x86, 0x66, 0xfe,
+    0x8b, 0xd6, 0x3c, 0xd7, 0x4c, 0x69, 0x6a, 0x16, 0x8e, 0x41, 0xce, 0x30, 0x10, 0x1a, 0xa8, 0x92,
+    0x50, 0x6b, 0xad, 0x0c, 0xcb, 0x0a, 0xca, 0x3e, 0x57, 0x45, 0x9b, 0x19, 0xaa, 0x87, 0xe5, 0xca,
+    0x9e, 0xf4, 0xf4, 0xe5, 0x88, 0x0e, 0xc1, 0x60, 0x1e, 0xfd, 0x45, 0x5d, 0x8c, 0x81, 0x29, 0x11,
+    0xce, 0x27, 0xbc, 0x07, 0xc2, 0x8b, 0xbb, 0xe4, 0xa7, 0x6b, 0xe0, 0x60, 0xc6, 0x87, 0x19, 0xf4,
+    0x4c, 0x19, 0x18, 0x96, 0x66, 0x10, 0x72, 0x15, 0x4b, 0x03, 0x49, 0x14, 0xdc, 0xaf, 0x49, 0x56,
+    0x9b, 0x03, 0x69, 0x8a, 0x50, 0xd3, 0x70, 0x59, 0xb7, 0x9c, 0x2f, 0xa9, 0x5c, 0x4d, 0x43, 0x40,
+    0x83, 0x5c, 0xb7, 0xbd, 0x6e, 0x4b, 0x3e, 0x75, 0x9b, 0xbb, 0xb8, 0x6c, 0xe8, 0x05, 0xa2, 0x54,
+    0x4f, 0xef, 0x99, 0x72, 0xd3, 0x28, 0xdb, 0x4e, 0xca, 0x15, 0xb7, 0xca, 0xad, 0x61, 0xc5, 0xa9,
+    0x77, 0x05, 0x88, 0x80, 0xd6, 0x61, 0x88, 0x70, 0x5a, 0x76, 0xd0, 0x14, 0xf2, 0xa8, 0x67, 0xeb,
+    0x53, 0x89, 0x8b, 0x17, 0x71, 0xc4, 0x71, 0x28, 0x45, 0x96, 0x26, 0xb9, 0x58, 0x29, 0x8b, 0x0a,
+    0xf5, 0xd2, 0x62, 0xc0, 0x19, 0x9f, 0x01, 0x6f, 0x3d, 0x2b, 0x50, 0x0e, 0xcb, 0x06, 0x4d, 0xfb,
+    0xbe, 0x17, 0x88, 0x22, 0x3b, 0xc3, 0x62, 0xee, 0x6c, 0x55, 0xc1, 0xc9, 0x81, 0x68, 0xb3, 0x36,
+    0x28, 0x54, 0xa0, 0x05, 0x44, 0x94, 0x85, 0x93, 0x17, 0x28, 0x26, 0x78, 0x33, 0x14, 0x2c, 0xb3,
+    0x43, 0xb2, 0x84, 0x3b, 0x21, 0xd5, 0x9f, 0x08, 0x2b, 0x4f, 0x0e, 0xb2, 0x5f, 0x8d, 0x37, 0xa0,
+    0x55, 0x45, 0x10, 0xc5, 0xf9, 0x22, 0x09, 0x57, 0x28, 0xeb, 0xe6, 0x20, 0x4c, 0x7b, 0x07, 0x4d,
+    0x10, 0xa8, 0xf7, 0x7d, 0x35, 0xce, 0xed, 0x6a, 0x57, 0x23, 0xeb, 0x6b, 0xa3, 0xec, 0x06, 0x43,
+    0x1a, 0xd9, 0x5d, 0xe8, 0x43, 0x8c, 0x6d, 0x13, 0x89, 0x9c, 0x4d, 0x41, 0x7e, 0x9b, 0x24, 0xb2,
+    0x9c, 0xff, 0x4e, 0x24, 0x1d, 0x89, 0xe4, 0xe3, 0x09, 0xe4, 0x53, 0x89, 0xa3, 0xd7, 0xe6, 0x68,
+    0x70, 0x88, 0xc5, 0xa7, 0x11, 0x58, 0x88, 0x64, 0x6e, 0x08, 0x34, 0x59, 0xc2, 0x10, 0x84, 0x89,
+    0x30, 0x4a, 0x60, 0x35, 0x39, 0x20, 0x27, 0xdd, 0x80, 0xe1, 0x0a, 0x71, 0x20, 0xdc, 0x10, 0x87,
+    0xe8, 0xde, 0x43, 0x57, 0x2c, 0x20, 0x37, 0x27, 0xf3, 0x4b, 0x73, 0x96, 0x7d, 0x15, 0x3d, 0x0c,
+    0xc3, 0x87, 0x63, 0x78, 0x14, 0xf1, 0x7c, 0x04, 0xa6, 0x30, 0x68, 0x2d, 0x43, 0x84, 0x99, 0x06,
+    0x9a, 0xe6, 0x0c, 0xa8, 0x8a, 0xe0, 0x22, 0x2b, 0xe3, 0xa8, 0x4c, 0x58, 0xb4, 0x5c, 0x24, 0x68,
+    0xaf, 0x2a, 0x9b, 0xa0, 0xc4, 0x4c, 0x83, 0xc7, 0xe1, 0xab, 0xfb, 0x77, 0x71, 0xb4, 0xbe, 0xaa,
+    0xfb, 0x69, 0xc2, 0x84, 0x67, 0x85, 0x7f, 0x25, 0x1c, 0x8c, 0x6b, 0x76, 0x41, 0xe5, 0x2e, 0x51,
+    0x63, 0x86, 0x09, 0xe9, 0x4c, 0x58, 0xcc, 0x99, 0x36, 0x74, 0x70, 0x65, 0x13, 0x88, 0x61, 0xe8,
+    0x19, 0x38, 0xb5, 0xb5, 0x44, 0xb3, 0x2b, 0xc3, 0x8b, 0xe2, 0x1b, 0xaf, 0xae, 0x1d, 0x04, 0xab,
+    0x8a, 0x15, 0x30, 0x93, 0x36, 0xb2, 0x57, 0x2f, 0x85, 0x6e, 0x01, 0x16, 0x47, 0xf5, 0x17, 0xb8,
+    0x08, 0x86, 0x05, 0x89, 0x5c, 0xc8, 0xd3, 0x6c, 0x39, 0x0a, 0xc1, 0x8c, 0x60, 0xcf, 0xe0, 0xa3,
+    0xfe, 0x12, 0x27, 0x0a, 0x5d, 0x26, 0xf0, 0x61, 0x4f, 0x86, 0x30, 0x17, 0x77, 0xc6, 0x59, 0xcc,
+    0x81, 0xfe, 0x56, 0x60, 0xeb, 0x91, 0x25, 0xc2, 0x80, 0x9a, 0xc1, 0x6c, 0x33, 0x27, 0x46, 0x99,
+    0xa4, 0xb5, 0x09, 0x90, 0xcd, 0x08, 0xda, 0x9d, 0x64, 0x71, 0xf4, 0x3c, 0x4d, 0x96, 0xb3, 0x39,
+    0xd9, 0x76, 0x68, 0x9a, 0x1d, 0x6c, 0x28, 0xfe, 0x36, 0xbd, 0xed, 0x5c, 0x56, 0x80, 0x3e, 0x9e,
+    0x47, 0xe4, 0x98, 0x5f, 0x84, 0x73, 0xf6, 0xaf, 0x1e, 0x59, 0x72, 0x2f, 0xd1, 0xba, 0xc8, 0x70,
+    0xaa, 0x67, 0xd4, 0xcb, 0xcd, 0x6d, 0x5a, 0x40, 0xb4, 0xb9, 0x77, 0x0a, 0xdf, 0xbf, 0xef, 0x28,
+    0x1f, 0x7a, 0x07, 0xdb, 0x8d, 0xc8, 0xa8, 0xe0, 0xa0, 0xe6, 0xc9, 0xc9, 0x11, 0x11, 0x5c, 0x50,
+    0xa4, 0x2f, 0xd3, 0x5b, 0x9e, 0x3d, 0x07, 0x22, 0xd3, 0x96, 0x27, 0x92, 0x3e, 0xe4, 0x62, 0x95,
+    0x4d, 0xd0, 0xee, 0xa3, 0xb5, 0x25, 0xf9, 0x27, 0x59, 0x3c, 0x5b, 0x64, 0x64, 0x9d, 0x0b, 0x64,
+    0x93, 0xff, 0xb2, 0x46, 0x30, 0xa5, 0xeb, 0xc9, 0xcb, 0xa1, 0xd2, 0x68, 0xea, 0x35, 0x51, 0x0e,
+    0xf9, 0x7c, 0xd0, 0x3f, 0x0f, 0x3d, 0xba, 0x32, 0x4b, 0x3c, 0x02, 0xa6, 0x52, 0x4e, 0xe9, 0x11,
+    0xb0, 0xee, 0x4e, 0x3c, 0x1f, 0xa7, 0xde, 0xe3, 0xba, 0x50, 0xd5, 0x0b, 0x0a, 0xb0, 0xe4, 0xb6,
+    0xf6, 0x1e, 0x0b, 0xb7, 0xb5, 0xed, 0xfd, 0xef, 0xaf, 0x1f, 0xed, 0x42, 0x8d, 0x6e, 0x80, 0x50,
+    0xb0, 0x20, 0x20, 0x12, 0x30, 0x5b, 0xd4, 0x43, 0x76, 0xc4, 0x7a, 0xf8, 0xe9, 0xac, 0xe7, 0x7c,
+    0x96, 0x84, 0x43, 0x9e, 0x28, 0x48, 0x02, 0x73, 0x0c, 0x06, 0xa1, 0x16, 0x84, 0x4f, 0x58, 0x4f,
+    0x3c, 0xdc, 0x11, 0xb8, 0xef, 0xa1, 0x2f, 0xa8, 0xb7, 0x76, 0xe2, 0x24, 0x9e, 0x2f, 0x96, 0x05,
+    0x89, 0x0c, 0xc0, 0x9e, 0x34, 0xe7, 0x3d, 0x72, 0x7c, 0xdf, 0xbf, 0x03, 0x02, 0x58, 0xef, 0xdc,
+    0x84, 0x89, 0x07, 0x3c, 0x23, 0xec, 0xf9, 0x43, 0xaf, 0x48, 0x27, 0x93, 0x84, 0x9f, 0x11, 0x78,
+    0xbf, 0x57, 0x95, 0xe9, 0x0d, 0x7a, 0x24, 0x55, 0x7b, 0x7d, 0x67, 0x33, 0x44, 0x70, 0x46, 0x87,
+    0x7f, 0xcd, 0x6f, 0x71, 0xc7, 0x01, 0x5f, 0xd4, 0x86, 0x4c, 0xe3, 0xd3, 0x9e, 0x5e, 0xd5, 0x59,
+    0xcf, 0xa2, 0x1e, 0x0e, 0x2b, 0xf9, 0xec, 0x77, 0xea, 0xe9, 0x44, 0x3d, 0x1a, 0x1c, 0x81, 0x37,
+    0x9c, 0xbf, 0x25, 0xdf, 0x38, 0x6f, 0xb2, 0x51, 0x51, 0xd8, 0x26, 0x91, 0xc7, 0x7b, 0xc1, 0xde,
+    0x9e, 0x73, 0x3a, 0x1b, 0xfa, 0x8e, 0xba, 0x06, 0xfb, 0x8e, 0x9f, 0x9d, 0xfa, 0x7e, 0x75, 0x50,
+    0x73, 0xea, 0x0a, 0xaf, 0x70, 0x8d, 0x1a, 0x86, 0xcb, 0xa2, 0x40, 0xbf, 0xd0, 0x3f, 0x29, 0x35,
+    0x7c, 0xdc, 0xac, 0x8a, 0x41, 0xcb, 0x69, 0x01, 0x46, 0xf4, 0x24, 0x53, 0xe7, 0xcb, 0xe1, 0x0c,
+    0x30, 0xad, 0x6d, 0xdb, 0x69, 0x62, 0x42, 0x54, 0xb2, 0xc4, 0x04, 0xd3, 0x9d, 0x3b, 0x87, 0x9e,
+    0x30, 0x98, 0x9f, 0x51, 0x49, 0xf2, 0xd9, 0xf8, 0x64, 0x9d, 0xf5, 0x49, 0x2a, 0x80, 0x7d, 0x76,
+    0x7d, 0xe8, 0x2d, 0xc0, 0xb8, 0xcd, 0x45, 0x09, 0xbf, 0x12, 0x03, 0x25, 0x3d, 0x8b, 0x56, 0xb6,
+    0xe1, 0x67, 0x92, 0x4a, 0xf3, 0xe5, 0x6c, 0xc8, 0x7f, 0x67, 0xea, 0xad, 0x99, 0x5a, 0xc2, 0x19,
+    0xa7, 0xd9, 0xcc, 0x1e, 0xf3, 0x23, 0x7c, 0x08, 0xf3, 0x26, 0x88, 0xe2, 0xd0, 0x93, 0xee, 0x75,
+    0xf1, 0xf3, 0x04, 0x91, 0xee, 0xb7, 0x8a, 0x71, 0x5d, 0x5b, 0xc8, 0xe9, 0xd1, 0x29, 0x0e, 0x87,
+    0x7a, 0xe8, 0x49, 0x01, 0xe1, 0x24, 0x38, 0x02, 0x60, 0xd3, 0x1b, 0x3d, 0xc4, 0xbd, 0x49, 0x02,
+    0xca, 0xb3, 0x78, 0xe4, 0x6c, 0x5c, 0x52, 0xf8, 0xc7, 0x92, 0xf5, 0xe3, 0xd3, 0x3f, 0x39, 0x48,
+    0x51, 0x20, 0x14, 0xd1, 0xb2, 0x8d, 0xf8, 0x69, 0xa4, 0x59, 0xdc, 0x88, 0xfe, 0x9d, 0x62, 0xff,
+    0x41, 0x29, 0x96, 0x26, 0xe7, 0xd3, 0xe9, 0xf5, 0x1f, 0x9c, 0x36, 0x2d, 0xfb, 0xfc, 0x2d, 0xf9,
+    0x2c, 0x98, 0xec, 0x20, 0x99, 0xe6, 0x43, 0x5e, 0xa0, 0xd3, 0x58, 0x19, 0xe6, 0xcb, 0xc5, 0x22,
+    0xcd, 0x0a, 0xdb, 0xfa, 0xd7, 0x7d, 0x3b, 0x4d, 0xcb, 0x59, 0xa5, 0x68, 0x8d, 0xfd, 0x10, 0xe5,
+    0x22, 0xd1, 0x17, 0xb5, 0x57, 0x95, 0x1b, 0xc8, 0x32, 0x54, 0xab, 0x17, 0x26, 0x4a, 0xae, 0x9c,
+    0x30, 0x71, 0x06, 0xd5, 0x82, 0x03, 0x58, 0xee, 0x7f, 0xff, 0xea, 0x39, 0x8b, 0x49, 0xc5, 0x04,
+    0x45, 0xdc, 0xde, 0x67, 0xf4, 0xa2, 0xa4, 0x8b, 0x37, 0x59, 0xba, 0x08, 0x27, 0xe6, 0x76, 0x98,
+    0x09, 0xab, 0x74, 0x84, 0x18, 0xbe, 0xe6, 0xfa, 0xf2, 0x59, 0x0f, 0x29, 0xa8, 0xdc, 0x45, 0xf6,
+    0x4a, 0x09, 0x1d, 0x2f, 0xca, 0xd3, 0x45, 0xf3, 0x40, 0x5a, 0xb6, 0x19, 0xff, 0xca, 0x27, 0xd6,
+    0xd5, 0x99, 0xa0, 0x3c, 0x4c, 0x16, 0xe2, 0x05, 0x18, 0x1b, 0xeb, 0xf4, 0xb4, 0x19, 0xe5, 0xad,
+    0xab, 0x79, 0xd5, 0x90, 0x2e, 0xcf, 0x4a, 0xe1, 0xe3, 0x8d, 0xc3, 0x1c, 0xfd, 0x43, 0xfc, 0x3d,
+    0x98, 0x82, 0xd1, 0x4e, 0x98, 0x65, 0xe9, 0x6d, 0xbe, 0x13, 0x26, 0x85, 0xd1, 0xd7, 0xf5, 0x06,
+    0x1c, 0x0a, 0xa7, 0x99, 0x0b, 0x83, 0xe8, 0x0a, 0x13, 0xbb, 0x46, 0x9c, 0x22, 0x79, 0xec, 0xb5,
+    0x7c, 0x6b, 0xcf, 0x1d, 0xbe, 0xc2, 0xae, 0xd8, 0xa5, 0x40, 0x92, 0xca, 0x0d, 0x67, 0xb8, 0x6c,
+    0x34, 0xc7, 0xa2, 0xd7, 0x5c, 0xa5, 0x15, 0x5d, 0xb0, 0x3e, 0x5f, 0xec, 0xdc, 0xf0, 0xac, 0x88,
+    0x47, 0x60, 0x4d, 0xf7, 0xdd, 0x4b, 0x79, 0x1d, 0x47, 0x9a, 0x7b, 0xb0, 0x85, 0xfb, 0x15, 0xc6,
+    0x76, 0x70, 0x2e, 0x04, 0x5a, 0xcd, 0x5d, 0x2b, 0xcd, 0x90, 0x9e, 0xe3, 0xf6, 0xdb, 0x11, 0x14,
+    0x7e, 0x3a, 0x8f, 0xde, 0x52, 0x51, 0xb9, 0x5b, 0xe1, 0x9c, 0x07, 0x7b, 0xd7, 0xb9, 0x2a, 0x50,
+    0x39, 0xd1, 0xf4, 0xfe, 0x56, 0xa0, 0x4a, 0xaf, 0x9c, 0xbe, 0x03, 0x4a, 0x9b, 0x18, 0x82, 0xd1,
+    0xcc, 0xa6, 0x70, 0x37, 0x5f, 0xc5, 0x9b, 0x8a, 0xbd, 0x2f, 0xb1, 0xa5, 0x03, 0xed, 0xdb, 0x3e,
+    0xcc, 0xee, 0xdb, 0x28, 0xda, 0xf6, 0xbd, 0xd8, 0x5c, 0xaf, 0x6d, 0x01, 0x0d, 0xd8, 0x5e, 0x23,
+    0x5e, 0x31, 0x42, 0x71, 0x94, 0xc5, 0x43, 0xd5, 0x77, 0xdf, 0xe5, 0x66, 0x95, 0x72, 0x37, 0x74,
+    0x7b, 0x59, 0x6d, 0xf9, 0xd2, 0xb4, 0xe3, 0xb4, 0x55, 0xb0, 0x8f, 0x44, 0x71, 0x83, 0xf5, 0x21,
+    0x77, 0x01, 0x6c, 0xd2, 0x32, 0x67, 0x21, 0xe2, 0x09, 0x87, 0xe1, 0x9b, 0xb0, 0x5b, 0xc7, 0xac,
+    0xc7, 0xd8, 0x68, 0xc3, 0x3f, 0x9e, 0x03, 0x3f, 0x60, 0xe0, 0x32, 0xf1, 0x2b, 0x46, 0x24, 0x48,
+    0xea, 0xd3, 0x35, 0x90, 0x43, 0x00, 0x96, 0x18, 0x6a, 0x21, 0x47, 0x63, 0x1b, 0x52, 0xec, 0xa2,
+    0x42, 0xb1, 0x09, 0xee, 0x22, 0x9b, 0xdb, 0xa7, 0x55, 0x01, 0x02, 0xd0, 0x5c, 0x80, 0x96, 0x3a,
+    0xbf, 0x0c, 0xc4, 0xe7, 0xbb, 0x81, 0x72, 0x72, 0xc2, 0x58, 0x8b, 0x69, 0xf9, 0xeb, 0x05, 0x8f,
+    0x27, 0xd3, 0xc2, 0xaa, 0x89, 0xc3, 0x3b, 0x93, 0xb5, 0xcb, 0xef, 0xef, 0x0e, 0xea, 0xde, 0xb4,
+    0x59, 0xf8, 0x5e, 0xf8, 0xec, 0x70, 0x13, 0xf1, 0xbb, 0x6f, 0x0f, 0x1c, 0xef, 0xdf, 0x82, 0xa4,
+    0x74, 0xbf, 0x44, 0xef, 0x1d, 0x75, 0x06, 0x45, 0x47, 0x25, 0xc7, 0x1f, 0xee, 0x81, 0xe4, 0xfe,
+    0x5e, 0xec, 0x53, 0x9f, 0xcd, 0xc2, 0x24, 0x01, 0x9c, 0x62, 0x51, 0x97, 0x8f, 0xb3, 0x02, 0x24,
+    0xc6, 0xe1, 0x86, 0x64, 0x71, 0xdf, 0x89, 0x72, 0xe2, 0x89, 0x99, 0x12, 0x6e, 0x79, 0xb5, 0x65,
+    0x5f, 0x83, 0x0d, 0x4c, 0x85, 0xc5, 0x68, 0x27, 0xb8, 0x51, 0xf7, 0x4a, 0x03, 0x8e, 0x07, 0x04,
+    0x92, 0xe7, 0xd0, 0x78, 0xf9, 0xfd, 0x62, 0xef, 0x12, 0xba, 0x01, 0xc2, 0x95, 0x9c, 0x4d, 0xd1,
+    0xb9, 0x56, 0xc2, 0x7c, 0x24, 0x0b, 0x5a, 0x5a, 0xd9, 0xb9, 0x89, 0x00, 0x54, 0x2b, 0x63, 0xb6,
+    0xa2, 0x65, 0x46, 0x1f, 0x48, 0x90, 0xe9, 0x42, 0x3a, 0x2b, 0xf3, 0x66, 0x5c, 0x2d, 0x04, 0x84,
+    0x33, 0x02, 0xd0, 0x38, 0x1e, 0x29, 0x70, 0x14, 0x01, 0x7e, 0xf8, 0xa0, 0x51, 0x9b, 0x3b, 0x8c,
+    0x2d, 0x90, 0x80, 0x8f, 0xf8, 0x38, 0x5c, 0x26, 0x85, 0xdf, 0x16, 0x29, 0x6a, 0x8f, 0xca, 0x60,
+    0x2b, 0x6a, 0x30, 0x49, 0x27, 0xf1, 0xc8, 0xee, 0x3a, 0xd1, 0x31, 0xf6, 0x69, 0x43, 0xb7, 0x4b,
+    0xb6, 0xa0, 0x6e, 0xd7, 0xa4, 0xa6, 0xdc, 0xf3, 0x28, 0x37, 0xd3, 0xc9, 0x41, 0xc8, 0xa6, 0x3c,
+    0xb3, 0x7c, 0xe7, 0x2e, 0x25, 0x5b, 0xc8, 0x50, 0x11, 0x83, 0x2a, 0x7c, 0x6e, 0x0f, 0xb6, 0x16,
+    0xe3, 0x71, 0x04, 0xe2, 0x37, 0x98, 0xa7, 0xb7, 0xbe, 0xb3, 0xa4, 0x2b, 0xe0, 0x43, 0x57, 0xb5,
+    0x82, 0x15, 0x71, 0x13, 0x04, 0x4b, 0x83, 0x96, 0x8e, 0xa1, 0xd5, 0x5f, 0x9a, 0x0a, 0xbe, 0xb3,
+    0x0a, 0x9a, 0x7c, 0x2b, 0x51, 0x7e, 0xaa, 0xe8, 0x03, 0x4f, 0x63, 0xfc, 0x65, 0x19, 0xe3, 0x19,
+    0x09, 0xcd, 0x06, 0x01, 0x13, 0x24, 0x49, 0x01, 0x83, 0xe4, 0x03, 0x71, 0xe1, 0xb8, 0xc1, 0x14,
+    0xf9, 0xbc, 0x5b, 0x97, 0x2a, 0x40, 0xe7, 0x8f, 0x59, 0x3a, 0xab, 0x4c, 0x9b, 0x0a, 0xf0, 0xd7,
+    0x5f, 0x1b, 0xc6, 0x0b, 0x98, 0xd0, 0x61, 0x3c, 0xcf, 0x7d, 0x15, 0x72, 0xd1, 0x7d, 0x37, 0xf4,
+    0x9e, 0xde, 0x86, 0x73, 0x50, 0x6a, 0x3b, 0x99, 0x76, 0x32, 0x2a, 0xd4, 0xb0, 0x02, 0xe6, 0x37,
+    0x73, 0x17, 0x57, 0xc1, 0x2a, 0xf3, 0xc9, 0x1b, 0x2c, 0x8a, 0x94, 0x80, 0x86, 0x6f, 0x4d, 0x4b,
+    0x37, 0xb4, 0x56, 0xf6, 0xad, 0x22, 0x91, 0x7e, 0x5b, 0x59, 0xd2, 0x67, 0x8a, 0x43, 0x4e, 0x95,
+    0x24, 0xa8, 0xd3, 0x66, 0x4b, 0x5c, 0x62, 0xf9, 0x78, 0xe0, 0x0a, 0x1f, 0xea, 0xd7, 0xe8, 0xc8,
+    0x1c, 0xe9, 0x08, 0x79, 0x38, 0x79, 0xa9, 0xc6, 0x8b, 0x4c, 0xba, 0x69, 0x7c, 0xa3, 0x84, 0x87,
+    0x99, 0xc2, 0x86, 0x89, 0xa9, 0xb6, 0x6e, 0x97, 0xc6, 0x83, 0xd0, 0xfe, 0x56, 0x90, 0x0e, 0xe1,
+    0x0b, 0x9f, 0xf7, 0x06, 0x76, 0x9f, 0x3e, 0x11, 0x28, 0x98, 0x7d, 0xdd, 0x61, 0xae, 0x1b, 0xd1,
+    0xd5, 0x1c, 0x27, 0xf9, 0x31, 0x7d, 0xdf, 0x04, 0x6d, 0xab, 0x4e, 0xd7, 0xf6, 0x83, 0x1b, 0x28,
+    0x65, 0x6d, 0x8f, 0x6d, 0x13, 0xe5, 0xad, 0x1d, 0xc6, 0x43, 0xbd, 0x4e, 0xb3, 0x60, 0xd7, 0x8d,
+    0xa1, 0x22, 0x5b, 0x72, 0xf7, 0x52, 0xc2, 0x8c, 0x1e, 0xf2, 0x94, 0x3a, 0xa9, 0xad, 0x3c, 0x3e,
+    0x41, 0xb4, 0xe7, 0x5d, 0x64, 0x71, 0xde, 0x59, 0x0e, 0xe3, 0xa2, 0xe3, 0x26, 0xce, 0x97, 0x61,
+    0xc2, 0xc6, 0x9c, 0x47, 0x66, 0xc4, 0x75, 0x27, 0x71, 0x6b, 0x6c, 0x88, 0xc2, 0xda, 0x7f, 0x84,
+    0x51, 0x7b, 0x87, 0xac, 0xb7, 0x17, 0xfc, 0x9b, 0x2b, 0x08, 0xc3, 0x28, 0x5e, 0x64, 0xe1, 0x3c,
+    0x27, 0x5f, 0x14, 0x1e, 0x3c, 0x80, 0x35, 0x1a, 0xf7, 0x1f, 0x04, 0x7b, 0xdf, 0xf7, 0x1d, 0xd1,
+    0x17, 0x96, 0xb2, 0x69, 0x26, 0xba, 0x59, 0xba, 0xcc, 0xb9, 0x24, 0x61, 0xfc, 0xc0, 0x89, 0x1b,
+    0xb0, 0x3b, 0xb6, 0x80, 0xa9, 0x01, 0x9b, 0x7c, 0x5f, 0x68, 0xb9, 0x2a, 0x8a, 0xa3, 0x2b, 0xc8,
+    0xe5, 0xa2, 0x87, 0xa6, 0x6c, 0xba, 0x40, 0x80, 0x5b, 0x54, 0xd6, 0x59, 0xea, 0x33, 0xf5, 0x47,
+    0xe3, 0xab, 0xa6, 0x0e, 0x6d, 0x39, 0x89, 0x1d, 0xfb, 0x6f, 0x18, 0x6f, 0x5d, 0x06, 0xb1, 0x6e,
+    0xe7, 0x40, 0x85, 0x8f, 0x56, 0x83, 0xea, 0x5e, 0xc5, 0x7c, 0x7d, 0xb7, 0x80, 0xf8, 0x04, 0x76,
+    0x92, 0xc6, 0x02, 0x4f, 0x8a, 0x10, 0x99, 0xea, 0x55, 0x58, 0x4c, 0x83, 0x70, 0x98, 0xfb, 0x06,
+    0x77, 0xb1, 0x1d, 0xcd, 0x0c, 0x6a, 0x81, 0xf0, 0xae, 0x09, 0xc2, 0x3b, 0x1d, 0xc2, 0xbb, 0xcd,
+    0x73, 0x25, 0xfb, 0xf3, 0xb8, 0x16, 0x70, 0x8b, 0x27, 0x83, 0x44, 0x4b, 0xb5, 0x77, 0xee, 0xd3,
+    0x04, 0xba, 0x79, 0xe7, 0x90, 0x5b, 0x35, 0xc6, 0x52, 0x6e, 0xb2, 0x91, 0x38, 0x07, 0xa2, 0x7c,
+    0x0e, 0x80, 0xc5, 0x67, 0x18, 0xa6, 0x0d, 0x73, 0xf0, 0x9c, 0x46, 0xf4, 0x16, 0x4a, 0xf8, 0x7d,
+    0x97, 0x44, 0x79, 0x1e, 0x26, 0xa3, 0x65, 0x82, 0xce, 0x04, 0xf4, 0x24, 0xd0, 0xc2, 0x69, 0x91,
+    0xe6, 0x31, 0x2d, 0x0b, 0xcc, 0xc2, 0x74, 0xe6, 0x95, 0x56, 0x6f, 0x0a, 0x6f, 0xb0, 0x5c, 0xf3,
+    0x1f, 0x0c, 0xc4, 0xf7, 0x11, 0x8f, 0x13, 0xbf, 0x36, 0x0f, 0xd8, 0xb3, 0x20, 0xe1, 0x63, 0x58,
+    0xaf, 0xee, 0x56, 0x0b, 0xb8, 0xbe, 0x8d, 0x52, 0x04, 0x8d, 0xe7, 0x28, 0x3a, 0xc1, 0x7d, 0xa7,
+    0xe0, 0x02, 0x2f, 0x29, 0xb0, 0x62, 0x39, 0xd7, 0x77, 0x8e, 0xf0, 0x87, 0xea, 0xac, 0x2e, 0xa3,
+    0xad, 0x5c, 0xf2, 0x75, 0xe7, 0x2e, 0x44, 0x8a, 0xe1, 0x9d, 0x61, 0xa1, 0x43, 0x60, 0x96, 0x2c,
+    0xc7, 0x23, 0x0c, 0x7e, 0x73, 0xdc, 0x89, 0x3c, 0x13, 0x4b, 0xa1, 0x24, 0x5e, 0x1f, 0x0f, 0xbc,
+    0xe1, 0x94, 0x3f, 0x74, 0x92, 0x1c, 0x8c, 0x6f, 0x23, 0x60, 0x11, 0x9c, 0xd2, 0x0c, 0xb5, 0x3e,
+    0x7b, 0x08, 0x3a, 0x0b, 0xf1, 0x90, 0x71, 0x2a, 0x26, 0x6f, 0x88, 0xf3, 0x1e, 0x66, 0x71, 0x7d,
+    0x80, 0xc6, 0xcc, 0xc5, 0x73, 0x5f, 0x3c, 0x19, 0xe8, 0x8b, 0xf2, 0x1d, 0x1d, 0x03, 0xdf, 0xb0,
+    0x07, 0x35, 0x8f, 0xb0, 0x36, 0x47, 0x00, 0x01, 0x7e, 0x0e, 0xca, 0x35, 0xfb, 0x4e, 0x39, 0x42,
+    0x59, 0x71, 0xab, 0xb8, 0x20, 0xd1, 0xee, 0x16, 0xc1, 0x41, 0xd0, 0x58, 0xad, 0x8d, 0xd6, 0x55,
+    0xa5, 0xdb, 0xa4, 0x10, 0xe2, 0xf8, 0xb3, 0x0a, 0xb4, 0x56, 0x4f, 0x4c, 0x5b, 0x6c, 0x6a, 0x57,
+    0x03, 0xa4, 0x72, 0xac, 0xfd, 0x36, 0xa6, 0xc0, 0x76, 0x76, 0x40, 0x77, 0xe5, 0xef, 0xb4, 0x94,
+    0x5d, 0xfa, 0xbf, 0x51, 0xb7, 0x36, 0x43, 0xe8, 0xa6, 0xee, 0x37, 0x2e, 0x00, 0x3e, 0xae, 0x07,
+    0x1d, 0x14, 0x7c, 0xf7, 0x2e, 0x18, 0x4a, 0xbb, 0x7f, 0xd0, 0xc5, 0x0f, 0x92, 0x29, 0x0f, 0x46,
+    0xb3, 0x1f, 0x44, 0x38, 0x0f, 0x37, 0x39, 0x70, 0x3e, 0xd6, 0xf7, 0xb1, 0xd1, 0x9d, 0xb3, 0x79,
+    0xb3, 0xc9, 0xe6, 0x21, 0xcd, 0x59, 0xe9, 0x50, 0x84, 0x7f, 0x37, 0x1b, 0xdc, 0x50, 0xb8, 0x92,
+    0x29, 0x9a, 0xb5, 0xad, 0x31, 0x24, 0xcd, 0x9d, 0x8a, 0xf2, 0x0b, 0x35, 0xd8, 0x2d, 0xfe, 0x70,
+    0x97, 0x2b, 0x1d, 0x94, 0x54, 0x70, 0xaa, 0xdc, 0xae, 0x35, 0x49, 0xf0, 0x93, 0x29, 0x02, 0x68,
+    0x3b, 0x48, 0x78, 0x99, 0x3f, 0x49, 0x1a, 0x2c, 0x8b, 0x24, 0x9e, 0x23, 0xbd, 0xf4, 0xbe, 0x5d,
+    0xbc, 0x27, 0xcb, 0x02, 0xe8, 0xec, 0x26, 0xcc, 0xfc, 0x9d, 0x1d, 0xb9, 0x79, 0x8b, 0xad, 0x4d,
+    0x32, 0x1c, 0xf7, 0x8e, 0xd8, 0x65, 0xff, 0x9c, 0xab, 0x00, 0x41, 0xae, 0x9f, 0x75, 0x1d, 0x20,
+    0x40, 0x7e, 0xc2, 0x4a, 0xe0, 0xb3, 0xf4, 0xc9, 0x12, 0x15, 0xee, 0x4e, 0xfd, 0xf3, 0xac, 0x06,
+    0x3a, 0x88, 0x95, 0x7b, 0xba, 0x2b, 0xf8, 0x37, 0x5a, 0x0f, 0xbc, 0xb7, 0x99, 0x1b, 0xac, 0x11,
+    0xc1, 0xf5, 0xee, 0xf2, 0x2b, 0x9b, 0xcf, 0x55, 0xf9, 0x77, 0x9b, 0x4d, 0x64, 0xb4, 0xca, 0x72,
+    0xb1, 0x83, 0x03, 0x36, 0x50, 0x3c, 0x5b, 0xce, 0x30, 0x0c, 0xdc, 0x6d, 0x4f, 0x42, 0x01, 0x69,
+    0xf3, 0x69, 0xdb, 0x0c, 0xdf, 0xb1, 0x7d, 0xf6, 0xad, 0xc3, 0x00, 0x06, 0xe0, 0x4a, 0x38, 0x94,
+    0x56, 0xb0, 0x04, 0x60, 0xd8, 0xc2, 0x86, 0x20, 0xf9, 0x06, 0x06, 0xbf, 0xd9, 0xb6, 0x06, 0xd0,
+    0xa5, 0x3c, 0xe9, 0x02, 0x5b, 0x16, 0x06, 0xe0, 0xab, 0x2e, 0x16, 0x76, 0x65, 0x85, 0x0a, 0xe4,
+    0x6c, 0xb6, 0x45, 0xc9, 0xd8, 0x16, 0x36, 0xf9, 0x73, 0x65, 0x98, 0x6e, 0xb2, 0xb7, 0xc9, 0xf2,
+    0x23, 0x53, 0xf8, 0xc1, 0x41, 0x0b, 0xbc, 0xb7, 0x64, 0xa3, 0xb6, 0xda, 0xd8, 0xcd, 0x90, 0xcc,
+    0x5f, 0xb5, 0x19, 0x01, 0x9b, 0x57, 0x3d, 0xb3, 0xed, 0x66, 0x63, 0x30, 0x0e, 0xd3, 0xb9, 0x3e,
+    0x05, 0x02, 0x98, 0x78, 0xa8, 0x9b, 0xd1, 0xda, 0x38, 0xb6, 0xb1, 0xa4, 0x45, 0x54, 0xfb, 0x15,
+    0xad, 0x70, 0xee, 0xdf, 0xa9, 0x6e, 0x1a, 0x01, 0x0d, 0xed, 0x01, 0xf1, 0x5a, 0x55, 0xd1, 0x29,
+    0xaa, 0xfb, 0x19, 0x2c, 0xec, 0xdf, 0x40, 0x48, 0xb4, 0x6e, 0x66, 0xfe, 0xad, 0x2c, 0xe6, 0x4a,
+    0x47, 0x7e, 0x66, 0x1b, 0x78, 0x83, 0xaa, 0xea, 0x60, 0x05, 0x7f, 0x0c, 0x04, 0xb7, 0xbe, 0xfb,
+    0x24, 0x4b, 0xf8, 0x53, 0xbb, 0xb1, 0x85, 0x2d, 0x4c, 0xfb, 0x9c, 0x89, 0x84, 0x92, 0x77, 0x88,
+    0x2d, 0xc2, 0xc5, 0xd6, 0x39, 0x6d, 0xfc, 0x98, 0xe2, 0xd9, 0xef, 0xb2, 0xfb, 0x84, 0xb2, 0x43,
+    0x6d, 0xc4, 0xef, 0xcb, 0x6f, 0x5a, 0xf7, 0xb4, 0x38, 0x90, 0xb2, 0x15, 0x47, 0x9a, 0x03, 0x9a,
+    0x33, 0x4c, 0x50, 0xe0, 0x0d, 0x2a, 0xef, 0xb6, 0x3e, 0xcc, 0xd6, 0xda, 0x55, 0x7c, 0xb2, 0x5e,
+    0xbd, 0x49, 0xb1, 0x37, 0x87, 0x56, 0x39, 0xc7, 0xeb, 0xa9, 0xe3, 0x86, 0x9e, 0x1d, 0x60, 0x51,
+    0x1e, 0xe6, 0x6b, 0x08, 0x88, 0xea, 0x30, 0x4c, 0x37, 0x59, 0x34, 0x03, 0xa8, 0x8f, 0xb4, 0x9b,
+    0x2d, 0xb6, 0x6e, 0xd8, 0x0e, 0xc7, 0xad, 0x3f, 0x4c, 0x9d, 0x02, 0x44, 0xb8, 0x64, 0x94, 0xe8,
+    0xa7, 0xdc, 0xa0, 0x1b, 0x97, 0x69, 0x0f, 0xf2, 0xed, 0x8e, 0x75, 0x39, 0x4e, 0x7f, 0x8b, 0x56,
+    0xb0, 0x91, 0xc6, 0x23, 0xe0, 0xdd, 0xf6, 0xc2, 0x37, 0x85, 0x99, 0x88, 0x83, 0x82, 0x30, 0x75,
+    0x62, 0x6d, 0x45, 0x83, 0x50, 0xb9, 0x2f, 0x74, 0x4e, 0x90, 0xc7, 0x91, 0x90, 0xf7, 0xe4, 0xe8,
+    0xac, 0xcc, 0x10, 0x0e, 0xdc, 0x53, 0x10, 0xa1, 0xe7, 0xea, 0xbf, 0xa0, 0x23, 0x19, 0x53, 0xa9,
+    0x9f, 0x5c, 0xc7, 0x3c, 0x1b, 0xb9, 0x3b, 0x32, 0x92, 0x64, 0xbd, 0xac, 0x82, 0x99, 0x29, 0xc4,
+    0xd7, 0xf2, 0xf0, 0x9e, 0x62, 0x29, 0xc7, 0x91, 0x48, 0xb9, 0xb9, 0x8b, 0x8a, 0xca, 0x59, 0xa9,
+    0x16, 0x2e, 0x22, 0xf3, 0xb9, 0x59, 0x85, 0xe9, 0x29, 0xb4, 0xec, 0xfd, 0x38, 0xbf, 0x9e, 0x23,
+    0x7a, 0x7e, 0xae, 0x9d, 0x34, 0x94, 0x06, 0xa8, 0x38, 0x47, 0x68, 0x55, 0xa7, 0xa7, 0x58, 0x5d,
+    0x1e, 0xb6, 0xa9, 0x55, 0x93, 0xe7, 0x43, 0xad, 0x6a, 0xf4, 0x14, 0xab, 0x59, 0xc7, 0x46, 0x6b,
+    0xd5, 0xd5, 0x29, 0x52, 0xab, 0xbe, 0x78, 0x8c, 0x00, 0xd4, 0xe9, 0xd2, 0x5a, 0x4d, 0x79, 0xb4,
+    0xd1, 0xaa, 0x48, 0x4f, 0xb1, 0x5e, 0xbd, 0x82, 0x3c, 0xee, 0x68, 0x55, 0xa0, 0xa7, 0xaa, 0x82,
+    0x16, 0xa6, 0xd6, 0x7a, 0x20, 0x56, 0xc6, 0x59, 0x1b, 0x27, 0x5e, 0x9d, 0xd2, 0x10, 0x6d, 0x45,
+    0xa4, 0x8e, 0x8a, 0x3a, 0xcb, 0xc0, 0x13, 0x99, 0xc4, 0xa1, 0xcc, 0x35, 0xb2, 0x65, 0x30, 0xa3,
+    0x04, 0x57, 0x8e, 0x47, 0x11, 0x21, 0xca, 0x6d, 0xf1, 0xae, 0x16, 0x32, 0x20, 0xce, 0x17, 0x8b,
+    0x97, 0xee, 0x75, 0x95, 0x7c, 0xe9, 0x50, 0x05, 0xe2, 0xc5, 0xce, 0x48, 0x84, 0xe1, 0xf6, 0xfa,
+    0x1d, 0x8f, 0xab, 0xbb, 0x33, 0x32, 0x95, 0x8c, 0x2c, 0x4e, 0x94, 0x51, 0x0a, 0x98, 0x7d, 0x91,
+    0x5a, 0x29, 0x2e, 0xf2, 0x32, 0xed, 0x02, 0x26, 0xa6, 0x24, 0x05, 0x07, 0x33, 0x90, 0x84, 0x18,
+    0xe0, 0xb4, 0x2c, 0x28, 0xa8, 0x6c, 0x01, 0xca, 0x51, 0x9d, 0x4f, 0xc7, 0x41, 0x19, 0x99, 0x61,
+    0x8c, 0x91, 0x19, 0x6f, 0xb6, 0x62, 0xf6, 0x8f, 0x65, 0x78, 0x07, 0xd3, 0x5b, 0x14, 0x47, 0xc9,
+    0x38, 0xf1, 0xf0, 0x00, 0xac, 0x15, 0xf8, 0x18, 0x0c, 0x2a, 0xf7, 0x91, 0x68, 0x33, 0x43, 0x0e,
+    0x34, 0xff, 0x9a, 0x8e, 0x5e, 0xf8, 0x0e, 0x68, 0xae, 0xf6, 0xcb, 0x56, 0xb4, 0xfc, 0x50, 0x0d,
+    0x96, 0x26, 0xe5, 0x53, 0x3c, 0x83, 0x99, 0x86, 0x22, 0x01, 0xc0, 0x3c, 0x29, 0xf8, 0x4c, 0x4b,
+    0xfc, 0x83, 0x35, 0x01, 0x45, 0xae, 0x86, 0xaa, 0x0d, 0x18, 0x3d, 0xcc, 0xd5, 0xf3, 0x5a, 0xa3,
+    0x0d, 0x29, 0xa8, 0xa1, 0x26, 0xf3, 0x31, 0xf7, 0x9c, 0x8a, 0x32, 0xa4, 0xa6, 0xea, 0xe4, 0xd9,
+    0x9e, 0xcb, 0xa9, 0x47, 0xf9, 0xa8, 0x08, 0x0e, 0x5a, 0xc9, 0x92, 0x88, 0xf6, 0x41, 0x13, 0xd5,
+    0xb2, 0x3c, 0x75, 0xcb, 0xf6, 0xa4, 0xf7, 0xac, 0x74, 0x14, 0xfa, 0x4d, 0x91, 0x01, 0xad, 0xa1,
+    0x92, 0x86, 0x62, 0xdb, 0xd2, 0x04, 0x6f, 0xe4, 0xef, 0x4f, 0x61, 0x46, 0x57, 0xec, 0x6a, 0x19,
+    0xf6, 0x57, 0x0a, 0x97, 0x21, 0x9f, 0x86, 0x37, 0x31, 0x20, 0xd5, 0x0e, 0xb9, 0x6e, 0xec, 0x74,
+    0x5b, 0x9e, 0x94, 0x4a, 0x2e, 0x95, 0x79, 0x51, 0x2a, 0x31, 0xb6, 0x89, 0xf7, 0x9a, 0x44, 0x93,
+    0x28, 0xd0, 0x73, 0xbb, 0x49, 0x46, 0xe5, 0xa1, 0x81, 0x2d, 0x24, 0x5b, 0xeb, 0xba, 0x4a, 0x4e,
+    0x86, 0xc3, 0xf6, 0x41, 0x41, 0xb2, 0xc1, 0xea, 0xd9, 0xe4, 0x11, 0xd6, 0x43, 0xba, 0x7e, 0x8a,
+    0x45, 0xf6, 0xa0, 0x43, 0x35, 0x08, 0x7b, 0x8e, 0x31, 0x69, 0x1e, 0xa5, 0x82, 0xec, 0x75, 0x8a,
+    0xe2, 0x2a, 0x15, 0x11, 0xd0, 0xbb, 0xc8, 0x91, 0x5a, 0xe2, 0x24, 0x6f, 0x71, 0xb0, 0xb5, 0x4c,
+    0xa3, 0x46, 0x7e, 0xe5, 0x74, 0x8e, 0x5a, 0xd8, 0x28, 0x1a, 0x75, 0x4f, 0x93, 0xb2, 0xee, 0x77,
+    0x1d, 0xd4, 0x39, 0x9d, 0x4c, 0x2e, 0xb7, 0x3b, 0xcd, 0x04, 0x68, 0x16, 0x62, 0x5d, 0x68, 0xd4,
+    0x50, 0xfd, 0x44, 0xf6, 0x07, 0xcf, 0x45, 0x38, 0x31, 0xbb, 0xae, 0x25, 0x1f, 0x6a, 0x51, 0xf4,
+    0x32, 0x99, 0x0a, 0xd1, 0x05, 0xca, 0x23, 0xd0, 0x5d, 0x79, 0x1c, 0x71, 0x07, 0xab, 0xb4, 0x10,
+    0x93, 0x8b, 0x96, 0x3e, 0xf7, 0xdc, 0x74, 0x9d, 0x97, 0xf5, 0xc6, 0xd4, 0x4b, 0xd8, 0x8e, 0x50,
+    0x56, 0xd7, 0x9c, 0x2f, 0x72, 0xd2, 0xe5, 0xc8, 0xdc, 0x79, 0x88, 0x52, 0x05, 0x40, 0x03, 0x0e,
+    0xaa, 0x2c, 0x58, 0x58, 0x10, 0x8f, 0x52, 0x60, 0x20, 0xdc, 0x85, 0x4a, 0xe5, 0x58, 0x06, 0x82,
+    0x83, 0x1a, 0x2a, 0x30, 0xb3, 0xde, 0x9f, 0xf8, 0xca, 0x77, 0x65, 0xc1, 0x2d, 0x6b, 0x07, 0x09,
+    0x9f, 0x4f, 0xc0, 0xe0, 0x7f, 0xc2, 0xae, 0x4a, 0x6d, 0x74, 0x26, 0x2b, 0xef, 0xdf, 0xbf, 0x2b,
+    0xcb, 0x5d, 0x68, 0x7a, 0xf0, 0x52, 0x64, 0x18, 0xae, 0x95, 0xf7, 0xec, 0x41, 0x19, 0x99, 0x51,
+    0x35, 0x1d, 0x50, 0x5f, 0x15, 0xd0, 0x18, 0xe9, 0x14, 0x01, 0x0c, 0xe7, 0xdf, 0xcf, 0x4e, 0x5f,
+    0x07, 0xe4, 0x90, 0xf3, 0x0d, 0xdd, 0x3a, 0x91, 0xba, 0xd5, 0x18, 0x5c, 0xbf, 0xb6, 0x5c, 0xa8,
+    0x60, 0x59, 0x0a, 0xdb, 0x6e, 0xf4, 0x26, 0x4c, 0xe2, 0xa8, 0x4a, 0x26, 0xf7, 0x34, 0xcb, 0xc2,
+    0x55, 0x80, 0x69, 0x8f, 0x7d, 0x7b, 0x99, 0x53, 0xa3, 0x95, 0xd2, 0x74, 0xe9, 0x07, 0xb3, 0x70,
+    0xe1, 0x9b, 0x53, 0xed, 0x0f, 0x31, 0xef, 0x0d, 0x90, 0x0b, 0x7c, 0x5a, 0xab, 0x8e, 0xaa, 0x60,
+    0xbf, 0xd6, 0xa9, 0xaa, 0xdf, 0x81, 0x9d, 0x00, 0x4b, 0x76, 0xe8, 0x88, 0x52, 0xa1, 0x36, 0x78,
+    0xc4, 0xf4, 0xd1, 0x54, 0x19, 0xa4, 0xab, 0x8a, 0x41, 0x1c, 0xf5, 0x1b, 0x11, 0x62, 0xda, 0xec,
+    0x4d, 0x8e, 0x2c, 0x09, 0x66, 0xd0, 0xfa, 0x5e, 0xad, 0x98, 0xb6, 0xa8, 0x42, 0x2b, 0x83, 0xf6,
+    0x46, 0x71, 0xd5, 0xd0, 0x5a, 0x42, 0xac, 0x28, 0x5a, 0x8b, 0xd0, 0x6a, 0xa3, 0xb5, 0x04, 0xae,
+    0x44, 0xcc, 0x02, 0x7d, 0x27, 0xaa, 0x3a, 0x9e, 0x36, 0x31, 0x91, 0xef, 0xb0, 0x32, 0x1b, 0x0e,
+    0x9f, 0x74, 0x88, 0x7f, 0xd0, 0x40, 0xab, 0xf0, 0x9b, 0x60, 0x54, 0x95, 0x38, 0xe8, 0x0c, 0x50,
+    0xf8, 0x72, 0x9b, 0xc1, 0xc1, 0xfb, 0x2e, 0xc0, 0xb4, 0x48, 0x0b, 0x17, 0xac, 0x4c, 0xbe, 0xee,
+    0x08, 0xaa, 0xb9, 0x53, 0x19, 0xbd, 0xec, 0x60, 0x9a, 0x99, 0x42, 0x41, 0xe3, 0x2d, 0x50, 0xde,
+    0xb3, 0xba, 0xa9, 0x58, 0x4e, 0xe1, 0x30, 0x8d, 0x56, 0xd5, 0xf2, 0x1d, 0xcb, 0x62, 0x50, 0xb5,
+    0x55, 0xbd, 0xf5, 0xe8, 0x28, 0xd8, 0x29, 0x19, 0xd7, 0x4e, 0x5d, 0x35, 0xf6, 0x44, 0xe4, 0x09,
+    0x63, 0xf7, 0xcc, 0xb5, 0x4c, 0x87, 0xa4, 0x7f, 0x35, 0x18, 0x0e, 0xd2, 0x6a, 0xcc, 0x41, 0xa8,
+    0x2d, 0x5b, 0xaa, 0x5c, 0x84, 0x55, 0x7a, 0xe2, 0x5a, 0x7b, 0xed, 0xb9, 0x66, 0xbb, 0x1c, 0x0a,
+    0x7b, 0xb0, 0xb7, 0xe7, 0xf6, 0x48, 0x55, 0xf3, 0x84, 0x39, 0x93, 0xc2, 0xeb, 0xea, 0x98, 0x5d,
+    0x2e, 0xf3, 0x3e, 0xe2, 0xa5, 0x04, 0x61, 0x51, 0x80, 0x0c, 0xa4, 0x94, 0xdd, 0xa9, 0x4c, 0x99,
+    0xa9, 0x9c, 0x51, 0xf8, 0x3d, 0x40, 0x6c, 0x1c, 0x69, 0xb9, 0x58, 0x15, 0x8c, 0xf6, 0x94, 0x84,
+    0x9a, 0xb4, 0xaf, 0x96, 0x61, 0x75, 0x39, 0x2f, 0x45, 0xb1, 0x67, 0xa8, 0x19, 0x4d, 0x67, 0x55,
+    0xea, 0x43, 0xc9, 0x6c, 0xd4, 0x07, 0x25, 0x63, 0xd7, 0x65, 0x35, 0x6d, 0xaf, 0x09, 0x57, 0x53,
+    0x83, 0xe3, 0x18, 0x8f, 0xf5, 0xaa, 0xa4, 0x88, 0x4f, 0xb4, 0xc4, 0xcd, 0x1f, 0x3e, 0x34, 0x46,
+    0x97, 0x37, 0x40, 0xd2, 0x8e, 0xa8, 0x7f, 0x22, 0x28, 0xa1, 0xee, 0x2e, 0x8c, 0xa3, 0xda, 0x97,
+    0xdb, 0xc2, 0xa4, 0x34, 0x5c, 0xce, 0x83, 0x4d, 0x0e, 0xf2, 0x8c, 0xa3, 0xfd, 0xaa, 0x9e, 0x43,
+    0x6a, 0xe3, 0xa0, 0xf6, 0x85, 0x67, 0xc9, 0x11, 0x17, 0x09, 0xfd, 0xdc, 0x77, 0x66, 0xfa, 0x42,
+    0x57, 0x55, 0xc9, 0x6c, 0x9e, 0xa3, 0x2a, 0x6a, 0x9a, 0xfd, 0x0d, 0x08, 0x25, 0xf7, 0xdc, 0x45,
+    0x99, 0xc3, 0x9f, 0x10, 0xb1, 0xc9, 0x75, 0x37, 0x70, 0xd9, 0xd4, 0x74, 0xfb, 0xc1, 0xf6, 0x6d,
+    0x09, 0x59, 0x59, 0x77, 0xf2, 0x39, 0xda, 0x40, 0x9d, 0xb7, 0xa9, 0x09, 0x2c, 0x63, 0xcf, 0x25,
+    0xf3, 0x5c, 0xd0, 0x50, 0x3f, 0x6e, 0x82, 0x86, 0x65, 0xba, 0x41, 0x53, 0x42, 0x7d, 0xbf, 0x69,
+    0xcd, 0xa3, 0x29, 0xb4, 0xfd, 0x56, 0x85, 0x38, 0x68, 0xab, 0x0f, 0xfa, 0x62, 0xbf, 0x45, 0xfb,
+    0x35, 0xd4, 0x55, 0x1a, 0x6b, 0xbf, 0x59, 0xd7, 0x35, 0xd7, 0x74, 0x37, 0x29, 0x14, 0x9b, 0xa3,
+    0xd6, 0xda, 0x7a, 0xb6, 0x6e, 0x5e, 0x28, 0x49, 0x67, 0xb3, 0xd4, 0x4b, 0x6d, 0x5a, 0x0b, 0xb1,
+    0x1e, 0x89, 0x1d, 0x02, 0x87, 0xf7, 0xb7, 0xb4, 0xdd, 0xa5, 0xcd, 0x7d, 0xc7, 0x5c, 0xbb, 0x14,
+    0xf9, 0xbe, 0x21, 0xe5, 0x06, 0x56, 0x21, 0x6a, 0x68, 0x50, 0xf3, 0x86, 0x81, 0xd2, 0xd8, 0x77,
+    0xe8, 0x2d, 0x74, 0x58, 0x02, 0x30, 0xa7, 0x66, 0x34, 0xf7, 0xe7, 0x9c, 0x1e, 0x35, 0xc3, 0xea,
+    0x1f, 0x88, 0x45, 0x82, 0xb8, 0xf3, 0x24, 0x1e, 0xaf, 0x7c, 0x73, 0x40, 0x86, 0xb4, 0x16, 0x89,
+    0x0c, 0xb5, 0x4c, 0xd5, 0x34, 0xa4, 0x7b, 0xa5, 0xdb, 0xb1, 0x6a, 0x5b, 0x2a, 0x14, 0xf2, 0xb0,
+    0x6d, 0xd6, 0x28, 0x46, 0x2f, 0xc5, 0xd6, 0xa4, 0x63, 0x79, 0x72, 0xe0, 0x3a, 0xe3, 0xdd, 0xe8,
+    0xee, 0xab, 0xf5, 0x95, 0xfa, 0xe2, 0xee, 0x2d, 0xe0, 0x53, 0xcc, 0x0b, 0x79, 0x79, 0x85, 0x67,
+    0x17, 0x57, 0x8f, 0x98, 0x05, 0x05, 0xa6, 0x79, 0xe6, 0xba, 0xf4, 0x08, 0xb7, 0xe3, 0x68, 0xa1,
+    0x00, 0x48, 0x8a, 0x64, 0xce, 0x39, 0xd0, 0x5e, 0xc7, 0xe7, 0xe1, 0xa4, 0x1f, 0x94, 0x60, 0xff,
+    0xa8, 0xee, 0x35, 0x52, 0x97, 0x66, 0xd0, 0x2d, 0x46, 0x2c, 0x9e, 0xcc, 0xc1, 0xb2, 0xc9, 0x99,
+    0x48, 0x9d, 0x4f, 0x0d, 0x62, 0xcb, 0x39, 0x1e, 0x71, 0xcd, 0x56, 0x8a, 0xde, 0x1d, 0x4b, 0x3f,
+    0xdd, 0x31, 0x89, 0x19, 0xa9, 0x5b, 0x15, 0xb3, 0x48, 0xdf, 0x7f, 0x65, 0x74, 0x5b, 0x25, 0xeb,
+    0x5f, 0x50, 0x96, 0xfe, 0x7e, 0xa7, 0x54, 0xfc, 0x56, 0xde, 0x7c, 0x72, 0xf9, 0x3c, 0xdc, 0x7b,
+    0x88, 0xa7, 0xfa, 0xa8, 0x1f, 0x68, 0x76, 0xed, 0x39, 0x2d, 0x23, 0xeb, 0x5e, 0x95, 0x7a, 0x47,
+    0xf6, 0x7a, 0x7d, 0x8a, 0x71, 0x54, 0x57, 0x88, 0x60, 0x52, 0xcc, 0x09, 0xac, 0xf9, 0xb7, 0xc9,
+    0xca, 0x6f, 0xb0, 0x78, 0xcb, 0x2d, 0x2d, 0x22, 0x79, 0x7f, 0x3d, 0x7b, 0x3a, 0x7b, 0x03, 0x93,
+    0x1b, 0x43, 0x81, 0x10, 0xcc, 0x94, 0x8b, 0x5b, 0xc5, 0xa0, 0xda, 0x35, 0x31, 0x97, 0x96, 0xcb,
+    0x56, 0x34, 0xe2, 0x5f, 0xcc, 0x78, 0x11, 0x5e, 0x36, 0xb9, 0xd9, 0x1c, 0x77, 0x98, 0x60, 0x79,
+    0x52, 0x6b, 0x3f, 0x66, 0x89, 0xcb, 0xb1, 0x54, 0x0a, 0xa1, 0x22, 0x2e, 0xc8, 0xe5, 0x46, 0x15,
+    0xe8, 0x47, 0x5b, 0x69, 0x3b, 0x9d, 0x36, 0x72, 0xc7, 0x39, 0x56, 0xea, 0xf5, 0x8d, 0xdb, 0x2a,
+    0x3e, 0x1e, 0xda, 0x11, 0x47, 0x97, 0xf2, 0x02, 0xc9, 0xd0, 0x05, 0x33, 0xaa, 0x5e, 0x6f, 0x0b,
+    0xf9, 0x64, 0x06, 0xb3, 0x8e, 0x8e, 0xe3, 0x6c, 0xa4, 0xa0, 0xc5, 0xf8, 0xc8, 0x01, 0xa7, 0x76,
+    0xc1, 0x98, 0x28, 0xad, 0x7e, 0x83, 0x94, 0x36, 0x4b, 0x38, 0x8f, 0xf5, 0xe9, 0xce, 0x1e, 0xaa,
+    0x2f, 0x18, 0x12, 0x2a, 0x5f, 0x5c, 0xba, 0xbc, 0xa0, 0xc6, 0x4d, 0x63, 0x0e, 0x5f, 0x4f, 0x09,
+    0x83, 0xed, 0x8b, 0x8b, 0xc8, 0x5c, 0x27, 0x43, 0x9b, 0xb7, 0x85, 0xec, 0xae, 0x55, 0x8e, 0x92,
+    0xd6, 0x7d, 0x8c, 0xda, 0x68, 0x2a, 0xff, 0x86, 0xd8, 0x21, 0x8c, 0x37, 0x1e, 0xe8, 0xb4, 0xbc,
+    0xda, 0xdd, 0x53, 0xec, 0x34, 0x6c, 0x0b, 0x98, 0x9b, 0x4a, 0x2c, 0xde, 0x5c, 0x43, 0x27, 0x23,
+    0xec, 0x75, 0x4b, 0x0d, 0x6b, 0xf7, 0x4c, 0xcb, 0xeb, 0x21, 0x60, 0x35, 0x1e, 0xed, 0xdc, 0x78,
+    0x16, 0xd3, 0xa6, 0x49, 0x6c, 0xe9, 0xa8, 0xda, 0x1f, 0xb0, 0x1d, 0x92, 0x0e, 0x0a, 0xe8, 0x91,
+    0x9f, 0xb6, 0xc9, 0x81, 0xbc, 0xb1, 0xb1, 0x67, 0x72, 0xdf, 0xc0, 0x40, 0x87, 0xa3, 0x19, 0xb7,
+    0xff, 0x10, 0x9b, 0xc6, 0x2f, 0x3d, 0xf7, 0x49, 0xd0, 0x26, 0x1f, 0xc1, 0x16, 0x64, 0x46, 0x04,
+    0x5e, 0xf7, 0xa2, 0xb5, 0xd1, 0xd7, 0xe7, 0xa1, 0x2d, 0x67, 0xac, 0x01, 0xae, 0xf5, 0x82, 0x38,
+    0xea, 0x56, 0x45, 0x2d, 0x0e, 0x83, 0x16, 0xea, 0x72, 0x45, 0x19, 0x60, 0x15, 0x2b, 0x8b, 0x71,
+    0xcd, 0xdd, 0x14, 0x88, 0x5b, 0xfb, 0x5c, 0xd1, 0x06, 0xd4, 0xc5, 0x91, 0x53, 0x14, 0x56, 0xd5,
+    0x45, 0xe0, 0xb6, 0x3b, 0xda, 0x00, 0x01, 0xd0, 0xb7, 0x56, 0x08, 0x28, 0x74, 0xfb, 0xce, 0xa8,
+    0x03, 0xac, 0x6f, 0x25, 0x5a, 0xae, 0x57, 0x17, 0xc9, 0xb1, 0x5d, 0x31, 0x08, 0x58, 0x5d, 0xa6,
+    0x62, 0xee, 0xc8, 0xbd, 0x57, 0xf7, 0xef, 0x04, 0x92, 0x29, 0xb9, 0x35, 0x4e, 0xd0, 0xfa, 0xf2,
+    0xaa, 0xa1, 0x7a, 0x2d, 0xee, 0xa5, 0x13, 0x33, 0xaf, 0x1b, 0x23, 0x73, 0x4a, 0x2a, 0xd7, 0xcd,
+    0x23, 0xb9, 0x43, 0xed, 0xf4, 0x79, 0x5b, 0xfb, 0xc9, 0x7d, 0x8a, 0x28, 0xdb, 0xeb, 0x7c, 0x53,
+    0xcf, 0x16, 0xbb, 0xbb, 0xed, 0xbb, 0xba, 0xed, 0xbb, 0xb9, 0xf6, 0xed, 0x50, 0xb5, 0x7b, 0x7c,
+    0xca, 0x1b, 0x2a, 0xcb, 0xb3, 0x28, 0x32, 0x9a, 0x43, 0xf2, 0x5d, 0x95, 0x26, 0xa5, 0x34, 0x20,
+    0x9b, 0x52, 0x69, 0xaa, 0x9e, 0xd1, 0x2f, 0x15, 0x5a, 0xd0, 0x78, 0xee, 0x78, 0x2f, 0xf8, 0x43,
+    0x75, 0xee, 0xb8, 0x2d, 0x47, 0xc2, 0x26, 0x70, 0x0a, 0xc6, 0x7a, 0xc0, 0x1e, 0x7c, 0xbf, 0xa7,
+    0x5f, 0x3d, 0x57, 0x0e, 0x49, 0xa4, 0xfb, 0x65, 0x32, 0xc7, 0x70, 0x3d, 0x77, 0x4f, 0x15, 0x4c,
+    0x5a, 0x0e, 0xd2, 0xc8, 0x10, 0x3c, 0x39, 0x39, 0x02, 0x5d, 0x58, 0xb9, 0x02, 0xf1, 0x96, 0xb5,
+    0x91, 0xe3, 0x42, 0x12, 0x2b, 0x93, 0x3b, 0xa5, 0xdd, 0xfb, 0x4a, 0xa4, 0x97, 0xbd, 0xd2, 0xaf,
+    0x23, 0xb9, 0x37, 0x72, 0xf9, 0x01, 0x4d, 0x02, 0xb9, 0x2a, 0x6f, 0x3c, 0xa1, 0xfe, 0x9e, 0x1c,
+    0x31, 0x99, 0xa7, 0xb8, 0x57, 0x5d, 0xe2, 0x73, 0xd5, 0xe9, 0x0e, 0x1f, 0x3c, 0x72, 0x3e, 0x0d,
+    0xc1, 0xac, 0x1a, 0x55, 0x87, 0x4c, 0x70, 0x47, 0x4a, 0x44, 0x55, 0xe2, 0xfe, 0x38, 0xbf, 0x89,
+    0x47, 0x2a, 0xc4, 0x1b, 0xfb, 0x57, 0x5d, 0x7e, 0x73, 0x13, 0x0f, 0x33, 0xda, 0xb7, 0xd1, 0xfa,
+    0x59, 0x7b, 0xeb, 0x7f, 0xbf, 0x57, 0x63, 0x23, 0x44, 0xd1, 0xfb, 0x69, 0x26, 0xaf, 0x04, 0xfa,
+    0xe5, 0xd5, 0xcb, 0x17, 0x45, 0xb1, 0x78, 0xcb, 0xc9, 0xfb, 0x52, 0x92, 0x21, 0x16, 0xca, 0xe5,
+    0x7a, 0x77, 0x64, 0x7b, 0x3e, 0x41, 0x25, 0xe2, 0xb9, 0x21, 0x52, 0x8b, 0x14, 0x1a, 0xa8, 0x26,
+    0x1a, 0xc0, 0x06, 0x29, 0x70, 0xbb, 0xdf, 0xfb, 0xe1, 0xf8, 0x1c, 0x18, 0xe6, 0x6a, 0x57, 0x9f,
+    0xac, 0x27, 0x71, 0x74, 0x48, 0x89, 0x11, 0xbf, 0x26, 0xc8, 0x87, 0x78, 0x8b, 0x23, 0x7c, 0xae,
+    0xaf, 0x06, 0x74, 0x0c, 0xa9, 0xaf, 0x01, 0xc9, 0x41, 0x62, 0xf8, 0x4e, 0x82, 0x91, 0xc4, 0x2f,
+    0x22, 0x0a, 0xb5, 0xf8, 0x3b, 0x07, 0xa1, 0xe8, 0x59, 0x63, 0x35, 0x12, 0x71, 0xe3, 0xfd, 0xe3,
+    0x51, 0xac, 0xb9, 0x6c, 0xb7, 0xc3, 0xb1, 0x8d, 0xad, 0xde, 0xae, 0xd6, 0x63, 0x44, 0x16, 0x5e,
+    0x69, 0x86, 0x31, 0x61, 0xdd, 0xb1, 0x43, 0x9c, 0x47, 0x3e, 0xc7, 0x3c, 0x8f, 0xdd, 0xe9, 0x18,
+    0x7f, 0xfc, 0x45, 0x43, 0x91, 0x9e, 0xe6, 0x52, 0x43, 0x91, 0x0c, 0x0d, 0xc0, 0xc7, 0xc7, 0xf5,
+    0x4b, 0x01, 0x2d, 0x5e, 0xc2, 0x36, 0x2f, 0xba, 0x25, 0xd0, 0xbc, 0x14, 0x30, 0xaf, 0xcc, 0x8d,
+    0x07, 0x11, 0xa4, 0xae, 0x35, 0xd6, 0xc6, 0x7b, 0x04, 0x91, 0x8d, 0x63, 0x9e, 0xd0, 0x68, 0x31,
+    0x6a, 0x51, 0x82, 0xd7, 0x6e, 0xd0, 0x72, 0x70, 0x9f, 0x11, 0xc9, 0x5e, 0xce, 0x53, 0xb9, 0xb9,
+    0xb9, 0x24, 0x93, 0x56, 0xeb, 0x43, 0x40, 0x0f, 0x8d, 0x08, 0x32, 0xbc, 0xbf, 0x44, 0x69, 0x05,
+    0xcd, 0x27, 0x23, 0x3d, 0xdc, 0x34, 0xde, 0x67, 0xca, 0x24, 0x32, 0x40, 0x2d, 0x42, 0x34, 0xe7,
+    0x5e, 0xa7, 0x11, 0xef, 0xe8, 0x2b, 0x36, 0x6e, 0x9a, 0x4a, 0xb3, 0x78, 0x82, 0x6a, 0x46, 0xaa,
+    0x62, 0xbd, 0x21, 0x3d, 0x5f, 0xa5, 0x92, 0xd7, 0x0d, 0xaf, 0x51, 0x1e, 0x07, 0x41, 0xd0, 0x73,
+    0x15, 0x03, 0xeb, 0x17, 0x73, 0xa1, 0x69, 0x07, 0xe3, 0xf5, 0xdb, 0x01, 0x7b, 0xbb, 0x8a, 0x0e,
+    0xb5, 0x59, 0x01, 0xa3, 0x71, 0x9a, 0x46, 0x68, 0x9b, 0x9e, 0x9e, 0x01, 0xed, 0x56, 0x2f, 0xf0,
+    0x0a, 0x4c, 0x9e, 0xe5, 0xfb, 0xec, 0x8e, 0xf5, 0x64, 0xd3, 0x3b, 0xe7, 0x30, 0xbc, 0x1e, 0x94,
+    0xc5, 0x9b, 0xf3, 0xe4, 0xfd, 0x70, 0xbb, 0xef, 0x77, 0x6e, 0x6f, 0x6f, 0x29, 0x23, 0xeb, 0xce,
+    0x32, 0x03, 0x1b, 0x78, 0x04, 0xd8, 0x89, 0x7a, 0x86, 0x7b, 0x0f, 0x1d, 0x75, 0x50, 0x8b, 0x26,
+    0x82, 0x78, 0x41, 0x94, 0xfa, 0xf1, 0xed, 0xc9, 0xf3, 0x74, 0x06, 0x2b, 0x7e, 0xb4, 0x31, 0xe9,
+    0x65, 0x5f, 0x05, 0xfc, 0x7d, 0xca, 0x5d, 0xae, 0x14, 0xb5, 0xec, 0x0e, 0x0e, 0x42, 0xf2, 0x4b,
+    0xd2, 0x09, 0x15, 0xd9, 0x78, 0x7c, 0xf8, 0xa7, 0xb6, 0x53, 0x10, 0x6d, 0xb3, 0xf3, 0x7f, 0xff,
+    0xf3, 0xdf, 0xb6, 0x91, 0xdf, 0x25, 0x41, 0x51, 0x0b, 0x48, 0x9d, 0x72, 0x0e, 0x36, 0xd4, 0xd4,
+    0x68, 0xc0, 0x75, 0xe6, 0x63, 0x4d, 0x5b, 0x53, 0x7b, 0xee, 0x23, 0x4a, 0xe8, 0x77, 0x13, 0x14,
+    0x2f, 0xb4, 0x17, 0xdd, 0x48, 0x66, 0x9f, 0xbc, 0xb4, 0x59, 0xcb, 0x75, 0xb6, 0xa3, 0x06, 0xfa,
+    0x59, 0xb2, 0x54, 0x90, 0x8b, 0x94, 0x4d, 0xf1, 0x92, 0x29, 0x29, 0xc6, 0xae, 0xf9, 0xca, 0x4a,
+    0x0b, 0x59, 0x6b, 0x66, 0x08, 0x95, 0x9b, 0xef, 0x72, 0xb4, 0x6c, 0xc0, 0x86, 0x69, 0xd7, 0x4d,
+    0xc2, 0xca, 0x04, 0x3c, 0xd8, 0x66, 0x56, 0xff, 0xfa, 0x4f, 0x31, 0xab, 0x0e, 0x1f, 0xba, 0x25,
+    0x38, 0x95, 0xb2, 0xa9, 0x2e, 0xa6, 0xd5, 0xb5, 0x8b, 0x40, 0x64, 0x65, 0x93, 0x4a, 0x57, 0x65,
+    0x59, 0x56, 0x68, 0xc2, 0xb2, 0xae, 0x7f, 0x75, 0x9b, 0xef, 0xef, 0xee, 0xc2, 0x5a, 0x42, 0xf8,
+    0x91, 0xd1, 0x90, 0xa7, 0xd5, 0xc2, 0x34, 0xcd, 0x0b, 0x5a, 0x68, 0xec, 0xde, 0xe6, 0x57, 0xa5,
+    0x09, 0x7c, 0xce, 0x93, 0x44, 0xdc, 0xc3, 0xce, 0xb3, 0x1b, 0x4c, 0x6f, 0x3b, 0x8d, 0xc9, 0x5c,
+    0xac, 0xa2, 0x77, 0xed, 0x0b, 0x76, 0x06, 0x78, 0x53, 0x37, 0x32, 0xb6, 0xba, 0x3e, 0x57, 0x5d,
+    0xa7, 0x1a, 0x57, 0xd7, 0xf0, 0x06, 0x04, 0xfb, 0x79, 0x0a, 0x46, 0x6f, 0x3e, 0xc2, 0xd0, 0xdf,
+    0x8c, 0x36, 0xa4, 0x51, 0xbe, 0x87, 0x32, 0x88, 0x08, 0x23, 0x3d, 0x72, 0x36, 0x0b, 0xe7, 0xab,
+    0xaa, 0x35, 0xa4, 0xf2, 0x11, 0x27, 0x9f, 0x2e, 0xac, 0xd6, 0x73, 0x72, 0x2f, 0x61, 0x17, 0xd0,
+    0x1a, 0x60, 0x49, 0x0c, 0xd8, 0xe7, 0x51, 0x20, 0xee, 0xb1, 0x2f, 0x43, 0x35, 0x55, 0xca, 0xb1,
+    0xf9, 0x32, 0x41, 0xb7, 0x95, 0xae, 0x80, 0xcd, 0x58, 0xce, 0x88, 0x0b, 0x3f, 0x04, 0x5a, 0x15,
+    0xa5, 0x3a, 0xd6, 0x73, 0x73, 0x99, 0x20, 0xfb, 0x95, 0x3c, 0x37, 0x1b, 0x6a, 0x23, 0x32, 0x5a,
+    0x1f, 0xaa, 0x99, 0x08, 0xe8, 0x82, 0x22, 0xb1, 0xb7, 0x81, 0x7e, 0xde, 0x72, 0x8a, 0x82, 0xd3,
+    0x37, 0xc7, 0xaf, 0x1d, 0x71, 0xbc, 0xea, 0xb4, 0x80, 0xbd, 0x33, 0xdc, 0x18, 0x2c, 0xe6, 0x7d,
+    0x55, 0x5d, 0x99, 0x59, 0xed, 0x11, 0xcb, 0xcd, 0x5f, 0xea, 0xdb, 0xad, 0x15, 0xf3, 0x51, 0x75,
+    0x8e, 0x4c, 0x1d, 0x6b, 0xff, 0xe2, 0x0e, 0x47, 0xbb, 0x4f, 0x3d, 0x58, 0x97, 0xde, 0xde, 0x35,
+    0x46, 0xc8, 0x03, 0xea, 0x4a, 0xb3, 0xa8, 0x82, 0x91, 0xce, 0xd1, 0xca, 0xb2, 0x93, 0xa0, 0x39,
+    0xa3, 0x68, 0xc5, 0x8e, 0x81, 0x5e, 0x55, 0xce, 0x30, 0x9d, 0xb0, 0x13, 0x6b, 0xa9, 0x0a, 0x44,
+    0x91, 0xad, 0xea, 0xde, 0xf9, 0x59, 0x3e, 0x31, 0xe3, 0xb2, 0xc4, 0x2a, 0x89, 0x6e, 0x60, 0xb6,
+    0xc2, 0xaf, 0xa0, 0x68, 0xa0, 0x68, 0xd1, 0x71, 0xe6, 0xa7, 0x7e, 0x57, 0xb4, 0xe3, 0xb4, 0xbe,
+    0x79, 0x01, 0xb4, 0x01, 0xb1, 0xc3, 0x05, 0x53, 0x76, 0x6f, 0x00, 0x29, 0xf2, 0x22, 0xe2, 0xb7,
+    0x7c, 0x8c, 0x27, 0x8b, 0x06, 0x34, 0xc8, 0x70, 0x82, 0x07, 0x50, 0xf1, 0x98, 0x6e, 0x26, 0x62,
+    0x0d, 0x75, 0x52, 0xaf, 0x6f, 0x27, 0x48, 0x48, 0x81, 0x14, 0xae, 0xb8, 0x99, 0xf0, 0xed, 0x1f,
+    0xfa, 0x75, 0x8c, 0xdb, 0xb2, 0x67, 0x53, 0x2f, 0x05, 0x82, 0xef, 0xc8, 0x16, 0x91, 0xf3, 0x52,
+    0x7e, 0x79, 0x2e, 0x4e, 0x49, 0x88, 0x23, 0x13, 0xf8, 0x5f, 0x3e, 0x28, 0x04, 0x13, 0xb0, 0x35,
+    0xba, 0x83, 0xf3, 0x89, 0x06, 0x38, 0x07, 0x7b, 0xce, 0xb8, 0xb2, 0x76, 0x4b, 0x90, 0x25, 0xe5,
+    0x31, 0x52, 0x25, 0x4c, 0x5e, 0xf1, 0xdb, 0x6c, 0xbb, 0x4a, 0xc7, 0x02, 0x52, 0x05, 0x8a, 0x98,
+    0x4a, 0x8e, 0xca, 0xf6, 0x6a, 0xfa, 0x65, 0xed, 0x22, 0x48, 0x8a, 0xce, 0xb6, 0x89, 0x19, 0x37,
+    0xa2, 0x30, 0xdc, 0x96, 0x56, 0x90, 0xa0, 0x29, 0x17, 0x32, 0x25, 0xa9, 0x7e, 0x41, 0xb3, 0x12,
+    0xea, 0x4d, 0x57, 0x90, 0xbb, 0x1a, 0x93, 0x33, 0x58, 0x8e, 0xad, 0x6a, 0xd1, 0x1a, 0x5a, 0x35,
+    0x18, 0x5e, 0x53, 0x95, 0xeb, 0x9a, 0x23, 0x63, 0xae, 0xa1, 0x9d, 0xe5, 0xab, 0xbc, 0xe0, 0x33,
+    0x5d, 0x26, 0x76, 0x9a, 0x18, 0xb2, 0x1f, 0xca, 0x4b, 0xe3, 0xd4, 0x57, 0xfd, 0x95, 0x9a, 0x7a,
+    0x7d, 0xef, 0x4a, 0x7a, 0x2e, 0x43, 0xf4, 0x6d, 0xb5, 0x5d, 0x58, 0xaa, 0xf7, 0xf0, 0x19, 0x95,
+    0xb6, 0xac, 0x72, 0xd9, 0x95, 0xe3, 0x8d, 0x77, 0xa6, 0x1b, 0xa0, 0x5e, 0x89, 0x5a, 0x16, 0x2c,
+    0xec, 0xf8, 0x96, 0x80, 0x70, 0xdf, 0xa9, 0x57, 0xa9, 0x6a, 0xb3, 0x37, 0x96, 0xc1, 0x20, 0x5f,
+    0x6a, 0x5e, 0x0e, 0x1d, 0x8f, 0x7d, 0xd3, 0xac, 0x37, 0xe0, 0xe8, 0xc1, 0x13, 0x87, 0x06, 0xf6,
+    0x75, 0x49, 0x56, 0xf5, 0x7e, 0x73, 0x85, 0xb5, 0x7e, 0x95, 0xb2, 0xf0, 0xb0, 0xde, 0xb9, 0x41,
+    0x39, 0xb3, 0x99, 0x53, 0x0d, 0xda, 0x4f, 0xa4, 0xfd, 0x5a, 0xb2, 0x08, 0x16, 0x19, 0x48, 0x21,
+    0x21, 0x96, 0x62, 0x4c, 0x1e, 0x8c, 0xd1, 0xc0, 0x0d, 0x8d, 0xd5, 0x07, 0x2c, 0x28, 0x41, 0xf6,
+    0xbb, 0x4a, 0xbb, 0xa1, 0xc8, 0xa8, 0xac, 0x64, 0x77, 0xdf, 0xa8, 0xa7, 0x85, 0x33, 0x8f, 0x13,
+    0xfe, 0xbe, 0x77, 0xb0, 0xc1, 0xc5, 0x83, 0xeb, 0x56, 0x7d, 0x32, 0x6b, 0x39, 0x82, 0x9d, 0x6e,
+    0x08, 0xdc, 0x8d, 0xfd, 0xed, 0x2e, 0x62, 0xde, 0xe0, 0xe4, 0xb8, 0x00, 0x59, 0x3d, 0x60, 0xdf,
+    0xef, 0x91, 0xc1, 0x78, 0xd9, 0x77, 0xcd, 0xa6, 0x62, 0xb7, 0xc7, 0xd6, 0x56, 0xf1, 0x26, 0x73,
+    0xb7, 0x09, 0x95, 0xf6, 0x86, 0xcb, 0xba, 0xe2, 0xe8, 0x7f, 0x31, 0xcc, 0xd6, 0xb5, 0xd4, 0xf8,
+    0xa5, 0x00, 0x71, 0xdc, 0x46, 0xfe, 0x19, 0xf9, 0xdf, 0xe8, 0xaf, 0x88, 0x65, 0xc0, 0xa3, 0x16,
+    0x3c, 0x2b, 0x56, 0x7e, 0x4f, 0xf6, 0xdf, 0x5d, 0xd8, 0x31, 0x38, 0x65, 0x54, 0x9f, 0x53, 0x1c,
+    0x4a, 0x75, 0x1b, 0x78, 0xdb, 0x3d, 0x1a, 0xd5, 0x38, 0x29, 0x67, 0x35, 0x55, 0xb5, 0x1c, 0xbd,
+    0xd2, 0x27, 0x41, 0xe0, 0x78, 0x74, 0x2e, 0x43, 0x60, 0x0c, 0x7f, 0xad, 0xf2, 0x6f, 0xd4, 0x23,
+    0x3a, 0x61, 0xc2, 0x9e, 0x16, 0x60, 0x6d, 0x0d, 0x97, 0x30, 0xf1, 0x3d, 0x0a, 0xa7, 0xa2, 0xe8,
+    0x15, 0x3c, 0x78, 0xae, 0x43, 0xec, 0xdb, 0x97, 0x48, 0x37, 0x9d, 0x3f, 0xac, 0x68, 0xe4, 0x6f,
+    0x44, 0xbf, 0xb5, 0x93, 0x8b, 0xc6, 0xc8, 0x37, 0x9c, 0x5f, 0x6c, 0x3d, 0xbb, 0xf8, 0x59, 0xcf,
+    0x2d, 0x56, 0xd1, 0x9d, 0xeb, 0xff, 0x07, 0xe6, 0x5e, 0xf0, 0xb0, 0x9d, 0x8b, 0x00, 0x00,
+};
+
+// style.css: 13382 bytes, 2950 gzipped
+static const uint8_t ESPWEBC_ASSET_2[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x5a, 0x79, 0x8f, 0xdb, 0xc6,
+    0x15, 0xff, 0x3f, 0x40, 0xbe, 0xc3, 0x74, 0x03, 0x03, 0x2b, 0x77, 0x29, 0x53, 0xd7, 0x7a, 0x57,
+    0x8b, 0x04, 0x6d, 0x0e, 0xa0, 0x05, 0x52, 0xb4, 0x40, 0x8a, 0xa2, 0x40, 0x10, 0x14, 0x23, 0x72,
+    0x28, 0x4d, 0x4d, 0x91, 0x04, 0x39, 0xd2, 0xee, 0xda, 0xf0, 0x77, 0xcf, 0x9b, 0x93, 0x73, 0x91,
+    0xd4, 0xda, 0x81, 0x89, 0xc4, 0xb6, 0x38, 0x6f, 0x8e, 0xf7, 0x7b, 0xf7, 0x1b, 0xbe, 0x79, 0x8d,
+    0xfe, 0x43, 0xda, 0x8e, 0xd6, 0xd5, 0x16, 0x2d, 0xe7, 0xe9, 0x7c, 0x8d, 0x12, 0xf4, 0x8f, 0x7a,
+    0x47, 0x4b, 0x82, 0x7e, 0xaa, 0x0e, 0xb8, 0xca, 0x48, 0x8e, 0xae, 0x7f, 0xa8, 0x8f, 0x0d, 0xce,
+    0xd8, 0x0c, 0xbd, 0x7e, 0xf3, 0xf5, 0x57, 0xdb, 0xb6, 0xae, 0x19, 0xfa, 0xf0, 0xf5, 0x57, 0x08,
+    0x25, 0xc9, 0x0e, 0x67, 0xef, 0xf6, 0x6d, 0x7d, 0xaa, 0xf2, 0x24, 0xab, 0xcb, 0xba, 0xdd, 0xa2,
+    0x6f, 0x16, 0xf7, 0x8b, 0x74, 0x95, 0x3e, 0xc8, 0xf1, 0x0a, 0x9f, 0xa3, 0x34, 0xc5, 0xa2, 0x58,
+    0x15, 0x8a, 0x26, 0xc7, 0xdd, 0x61, 0x72, 0xa1, 0x0c, 0xb7, 0x79, 0x8c, 0x68, 0x45, 0x56, 0x77,
+    0xb7, 0x9c, 0x48, 0x92, 0x31, 0xf2, 0xc4, 0xcc, 0x58, 0xbe, 0xc8, 0xd6, 0x85, 0x5e, 0xe0, 0x40,
+    0x70, 0x4e, 0x5a, 0x97, 0x80, 0x2c, 0xf3, 0x5d, 0x51, 0x98, 0xc9, 0xb4, 0x6a, 0x4e, 0x2c, 0xd9,
+    0xd5, 0x2d, 0x27, 0x0c, 0x36, 0xb0, 0x28, 0x46, 0xce, 0xaa, 0x60, 0x39, 0x31, 0x56, 0x57, 0xee,
+    0x66, 0x85, 0x78, 0x1e, 0x1c, 0x82, 0xc8, 0x4a, 0x6b, 0xb2, 0xda, 0xdc, 0x2f, 0x5c, 0xb2, 0x43,
+    0x7d, 0xb6, 0x4e, 0x94, 0xaf, 0x31, 0x5e, 0x1b, 0xf0, 0xda, 0xba, 0xc9, 0xeb, 0xc7, 0xe8, 0x52,
+    0x86, 0x7f, 0x85, 0x4d, 0xbd, 0xdf, 0x97, 0x24, 0x89, 0x6f, 0xeb, 0x2c, 0xda, 0x53, 0x5a, 0x87,
+    0xf7, 0xc6, 0x8a, 0x62, 0x54, 0x1c, 0x1e, 0xa9, 0xbb, 0x8e, 0xd2, 0x8d, 0x9a, 0xd1, 0x82, 0x66,
+    0x98, 0xd1, 0xf8, 0x91, 0x1c, 0x25, 0x71, 0x88, 0x69, 0x66, 0x1d, 0xcd, 0x39, 0x79, 0x56, 0xd6,
+    0x1d, 0xd1, 0xb0, 0x19, 0x8a, 0xbb, 0x4d, 0xb1, 0xe9, 0xf7, 0x7d, 0xa4, 0xf9, 0x9e, 0x30, 0x50,
+    0xcd, 0x23, 0x89, 0xab, 0x8a, 0x22, 0x38, 0xe3, 0xf2, 0x44, 0x22, 0x08, 0xa8, 0xe1, 0xe1, 0x43,
+    0x28, 0x82, 0x9c, 0x74, 0xd9, 0x28, 0x41, 0x84, 0xe7, 0xe5, 0x72, 0x71, 0xb7, 0x5e, 0xf6, 0x7a,
+    0x84, 0x81, 0x9b, 0xa2, 0xae, 0x58, 0xd2, 0xd1, 0xf7, 0x64, 0x8b, 0x16, 0x77, 0xcd, 0x93, 0xd6,
+    0xe7, 0x85, 0x33, 0x30, 0xdf, 0x90, 0xa3, 0x1e, 0x59, 0xba, 0x23, 0x4b, 0x6b, 0x68, 0xe5, 0x0e,
+    0x2d, 0xcc, 0x48, 0xe3, 0x0c, 0x98, 0xd7, 0x52, 0xe1, 0xa3, 0x43, 0x46, 0xf3, 0xa2, 0xa3, 0x4a,
+    0x04, 0xd1, 0x31, 0x5b, 0x00, 0x63, 0x04, 0x52, 0x00, 0x2e, 0x2f, 0x3e, 0x8d, 0x00, 0xd9, 0x22,
+    0x49, 0xe7, 0xf7, 0x86, 0xa4, 0x25, 0x47, 0x30, 0x9c, 0x64, 0xc7, 0x06, 0xce, 0x21, 0x24, 0x28,
+    0x5f, 0xae, 0xc4, 0xcb, 0x8f, 0x1c, 0xf7, 0x37, 0xaf, 0xd1, 0xcf, 0x74, 0x7f, 0x60, 0xe8, 0xdf,
+    0x07, 0x72, 0x24, 0xc2, 0xe5, 0xfd, 0x9a, 0x63, 0x86, 0x13, 0xc6, 0x7f, 0x7f, 0x7b, 0x55, 0xf2,
+    0xc1, 0xab, 0xdf, 0x46, 0x3c, 0xa0, 0x63, 0xe9, 0x03, 0x1e, 0xb0, 0x48, 0x8b, 0x75, 0x31, 0xe5,
+    0x01, 0x9d, 0x85, 0x86, 0x3c, 0x20, 0xb9, 0x85, 0xb5, 0x8c, 0x75, 0xda, 0x1e, 0x67, 0x25, 0x9e,
+    0x11, 0xff, 0xb7, 0x14, 0xcf, 0xc3, 0x88, 0xf7, 0xcb, 0xc4, 0x33, 0xe5, 0xfd, 0x2e, 0x74, 0x6d,
+    0xab, 0xd5, 0xfd, 0xbd, 0x4f, 0xe6, 0xba, 0xb6, 0xe5, 0xdd, 0x5b, 0x92, 0xdd, 0x5d, 0xe0, 0xda,
+    0x9c, 0x1d, 0x47, 0x1d, 0x9b, 0xb3, 0xe9, 0xb8, 0xf3, 0x72, 0x98, 0x9d, 0xf2, 0x4e, 0x8e, 0x00,
+    0x87, 0xbd, 0x93, 0xb3, 0x7d, 0xcc, 0xf3, 0x38, 0x42, 0x8a, 0x7a, 0x9e, 0x54, 0x3c, 0x23, 0xce,
+    0x27, 0xb6, 0x87, 0xe3, 0x7c, 0x62, 0x04, 0x63, 0xa0, 0x6a, 0x3b, 0xf8, 0x11, 0xb7, 0xef, 0x86,
+    0xcc, 0x20, 0x87, 0xb1, 0x51, 0x2b, 0x70, 0x8e, 0x3d, 0x94, 0x07, 0x88, 0x67, 0xc2, 0x0a, 0x9c,
+    0x85, 0x86, 0xac, 0xc0, 0x51, 0x65, 0x37, 0x0b, 0x10, 0xcf, 0x88, 0x15, 0x38, 0xba, 0x14, 0xcf,
+    0x01, 0x6c, 0x19, 0x0d, 0xe7, 0x00, 0x36, 0x33, 0x23, 0x01, 0x5e, 0x3c, 0x63, 0x56, 0xb0, 0x11,
+    0xcf, 0x05, 0x56, 0xe0, 0x9c, 0x6b, 0xd4, 0x0a, 0x62, 0xc6, 0xa2, 0xc7, 0x6e, 0xc5, 0x73, 0x91,
+    0x85, 0x44, 0xd3, 0x80, 0x28, 0xff, 0x93, 0xc1, 0x7d, 0x90, 0xd8, 0x8d, 0xab, 0xb6, 0xf0, 0xa2,
+    0x81, 0x3b, 0x42, 0x10, 0x04, 0xee, 0x89, 0xd8, 0x1d, 0x59, 0xc2, 0x31, 0x9f, 0x9d, 0x78, 0x2e,
+    0x88, 0xdd, 0x4a, 0x05, 0xb5, 0xf9, 0x7c, 0x0f, 0xd1, 0x1b, 0xfd, 0xc2, 0x9e, 0x4b, 0xd2, 0x09,
+    0xfb, 0x79, 0x8d, 0x3e, 0xa0, 0x5d, 0xfd, 0xc4, 0x43, 0x0e, 0xad, 0xf6, 0x5b, 0xa4, 0xb4, 0x0c,
+    0x5e, 0x3d, 0x20, 0x31, 0x67, 0x57, 0xe7, 0xcf, 0xd2, 0xa2, 0x44, 0xbc, 0x2a, 0xf0, 0x91, 0x96,
+    0xcf, 0x5b, 0xf4, 0xd7, 0x96, 0xe2, 0xf2, 0x06, 0x75, 0xb8, 0xea, 0x92, 0x8e, 0xb4, 0x54, 0x32,
+    0x13, 0x9e, 0xe0, 0x8c, 0xdb, 0xeb, 0xd0, 0x14, 0x67, 0x82, 0xda, 0x21, 0xe9, 0xd5, 0x5f, 0x0e,
+    0x1e, 0x71, 0xbb, 0xa7, 0x50, 0x00, 0x48, 0x23, 0x6b, 0x70, 0x9e, 0x8b, 0xf3, 0xc9, 0x9f, 0x82,
+    0x18, 0x43, 0xd4, 0x03, 0x82, 0x8c, 0x54, 0x8c, 0xb4, 0x0f, 0xe6, 0x84, 0x32, 0x78, 0xea, 0x7d,
+    0xed, 0x5c, 0x45, 0x2e, 0x9c, 0x3c, 0x92, 0xdd, 0x3b, 0xca, 0xe4, 0x86, 0xfc, 0x75, 0x82, 0xf3,
+    0xff, 0x9f, 0x3a, 0x06, 0x51, 0x38, 0x4d, 0x5f, 0x3d, 0x20, 0x00, 0xe9, 0x5f, 0x2d, 0x39, 0xc3,
+    0xaa, 0x88, 0xfe, 0xf3, 0x17, 0xf4, 0xbe, 0xae, 0x8f, 0x02, 0x29, 0x81, 0xc6, 0x61, 0x71, 0x83,
+    0x0e, 0x4b, 0xf8, 0x7f, 0x05, 0xb8, 0x39, 0xe7, 0x0f, 0xac, 0x78, 0x26, 0x00, 0x3c, 0x2c, 0x80,
+    0x30, 0x38, 0x97, 0x9d, 0x28, 0x29, 0xba, 0x65, 0x94, 0x6e, 0x19, 0xd0, 0xad, 0xa2, 0x74, 0x2b,
+    0x9f, 0xae, 0x89, 0x91, 0x35, 0x0e, 0xd5, 0x20, 0xfc, 0x52, 0xf0, 0xdf, 0x80, 0x7f, 0xdc, 0xe1,
+    0x56, 0xca, 0x1e, 0x34, 0x8c, 0x1d, 0x14, 0x42, 0x63, 0x82, 0x8e, 0xf9, 0xd4, 0x88, 0xb0, 0x23,
+    0x60, 0x39, 0x52, 0x5e, 0xa4, 0x2a, 0xa7, 0xcc, 0x69, 0xd7, 0x94, 0x18, 0xf4, 0xad, 0x28, 0x89,
+    0x7c, 0xc3, 0xff, 0x91, 0xe4, 0xb4, 0x25, 0x19, 0x13, 0x05, 0x22, 0x4c, 0x3f, 0x1d, 0x2b, 0xad,
+    0xe1, 0xfa, 0xd0, 0x02, 0xa6, 0x5e, 0x85, 0x24, 0x47, 0x73, 0xed, 0xb7, 0x24, 0x4f, 0x4d, 0xdd,
+    0x51, 0xb9, 0x46, 0x4b, 0x4a, 0xb0, 0xf3, 0x33, 0x71, 0xb7, 0xa4, 0x55, 0x49, 0x2b, 0x48, 0xd5,
+    0xca, 0x3a, 0x7b, 0xf7, 0x60, 0x83, 0x70, 0x27, 0x4f, 0xe7, 0xad, 0x29, 0xdd, 0xa6, 0x5c, 0x3a,
+    0xee, 0x62, 0x25, 0x72, 0xc2, 0xc0, 0xb6, 0xa8, 0xaa, 0x2b, 0x12, 0x02, 0x13, 0x14, 0x69, 0x3e,
+    0x30, 0x1b, 0x05, 0x4c, 0x76, 0x6a, 0x3b, 0x3e, 0xad, 0xa9, 0xa9, 0x51, 0x7f, 0x5f, 0x48, 0x81,
+    0xfc, 0xc3, 0xf4, 0x58, 0xd9, 0x1a, 0x05, 0x77, 0x4f, 0x78, 0x0e, 0xb9, 0x45, 0xeb, 0x35, 0xec,
+    0xc0, 0x8d, 0x40, 0x55, 0xdc, 0xac, 0x3e, 0x65, 0x07, 0xc4, 0x00, 0x4a, 0xc2, 0x84, 0x1d, 0x58,
+    0x16, 0x84, 0x9b, 0xe4, 0x00, 0xb3, 0x44, 0xf6, 0xa9, 0x19, 0x65, 0x2d, 0xb8, 0x84, 0x06, 0xb7,
+    0x60, 0x3f, 0x43, 0x18, 0x6d, 0x45, 0x68, 0xe1, 0x8e, 0x67, 0xc8, 0x5d, 0x04, 0x11, 0x68, 0xe6,
+    0x8b, 0x10, 0x5e, 0x03, 0xdf, 0x95, 0x2a, 0xfa, 0x8d, 0xcc, 0x0c, 0xaa, 0xbd, 0x70, 0xf1, 0xae,
+    0x03, 0x15, 0x61, 0x64, 0x54, 0x6f, 0x07, 0x23, 0xda, 0x4c, 0x09, 0x0d, 0x3c, 0xe4, 0x01, 0x03,
+    0x05, 0x68, 0x13, 0x82, 0x82, 0x07, 0x2d, 0x6e, 0xe1, 0x8f, 0x76, 0xbf, 0xc3, 0xd7, 0xe9, 0x0d,
+    0x52, 0xff, 0xcd, 0x97, 0x43, 0xd2, 0x7a, 0x0f, 0x11, 0x3a, 0x27, 0x4f, 0x5c, 0x36, 0x9f, 0x29,
+    0x29, 0xfc, 0x64, 0x24, 0x75, 0x9b, 0x9e, 0x0f, 0xe2, 0x25, 0x87, 0xa9, 0x28, 0xeb, 0xc7, 0x04,
+    0x00, 0xc0, 0x27, 0x56, 0x3b, 0x6e, 0xce, 0x0c, 0x76, 0x59, 0x5b, 0x97, 0xa5, 0x38, 0x97, 0x90,
+    0xa9, 0x10, 0x32, 0xf7, 0x70, 0xc7, 0xfa, 0x08, 0x40, 0x9e, 0x8e, 0x48, 0x52, 0xf4, 0xce, 0x2e,
+    0x04, 0x5b, 0x0a, 0xe6, 0xc6, 0xd1, 0x75, 0x87, 0xdb, 0x9e, 0xe5, 0x09, 0xd9, 0x0e, 0xe1, 0xfc,
+    0x09, 0xc6, 0x11, 0x33, 0x05, 0x15, 0xc6, 0x5a, 0x9c, 0xd3, 0x53, 0x07, 0x4a, 0xad, 0x0e, 0x15,
+    0x06, 0x08, 0xaf, 0x24, 0xfc, 0xb2, 0xf6, 0xe0, 0xe1, 0xea, 0xe9, 0x72, 0xe8, 0x78, 0xb4, 0xba,
+    0x68, 0xc7, 0xc6, 0x01, 0x4f, 0x5f, 0xa2, 0x40, 0xa3, 0xdb, 0x4b, 0xb3, 0xbc, 0xf1, 0x8c, 0xf4,
+    0x02, 0x59, 0x3a, 0x76, 0xda, 0xa7, 0x1a, 0x0a, 0xb0, 0xde, 0xf8, 0xc9, 0x01, 0x9f, 0x69, 0xdd,
+    0x0a, 0xd4, 0xfe, 0x72, 0x24, 0x39, 0xc5, 0xe8, 0x5a, 0xcc, 0xdd, 0x22, 0xf1, 0xd7, 0x0c, 0xe1,
+    0x2a, 0x47, 0xd7, 0x4a, 0x8e, 0xe0, 0xf3, 0xc1, 0xfd, 0xce, 0xe4, 0x09, 0xcc, 0x99, 0xd5, 0xb1,
+    0x22, 0x7e, 0xc0, 0x07, 0x8e, 0x3b, 0x0c, 0x19, 0x13, 0x78, 0x12, 0xbf, 0xab, 0x21, 0x49, 0xf7,
+    0x00, 0xde, 0xb7, 0x54, 0xa6, 0x58, 0xfc, 0x1f, 0xa0, 0x56, 0x47, 0x78, 0xcd, 0x44, 0x92, 0x06,
+    0x11, 0xa5, 0xe3, 0x61, 0xa1, 0x21, 0x98, 0x5d, 0x73, 0x93, 0x4a, 0x0a, 0x5a, 0x42, 0xba, 0x03,
+    0x8a, 0x01, 0x16, 0x78, 0xbd, 0x81, 0x00, 0x70, 0x83, 0x16, 0x45, 0x3b, 0x9b, 0xf5, 0xf3, 0x05,
+    0x59, 0x5b, 0x3f, 0xc2, 0xc4, 0x8d, 0x0e, 0x5f, 0x7b, 0xdc, 0x58, 0xc1, 0xcc, 0x58, 0xca, 0x32,
+    0x9d, 0x30, 0x92, 0x68, 0xd9, 0x31, 0xf3, 0xa7, 0xd0, 0x23, 0xde, 0x83, 0xc0, 0x79, 0x94, 0xc2,
+    0x6d, 0xb2, 0xe7, 0xca, 0x0e, 0x48, 0x5c, 0xb3, 0x1a, 0xb5, 0x5c, 0x03, 0x6f, 0x44, 0x1a, 0x89,
+    0x16, 0xfc, 0xac, 0x96, 0x16, 0xf2, 0x17, 0xb3, 0x1b, 0xbe, 0x14, 0x8a, 0x4d, 0xdd, 0xd5, 0x20,
+    0xd3, 0xe3, 0xd8, 0x5c, 0xff, 0x18, 0x52, 0xed, 0x36, 0x5c, 0x19, 0x37, 0xda, 0xfa, 0xb5, 0xf5,
+    0x64, 0xb8, 0xcc, 0xae, 0x41, 0x6f, 0xcf, 0x07, 0x94, 0xa0, 0x05, 0xe7, 0x7b, 0x16, 0xd5, 0xe8,
+    0x69, 0x6f, 0xa5, 0x95, 0x57, 0xe6, 0xba, 0x9e, 0x24, 0xa7, 0xb3, 0x03, 0x84, 0x78, 0x8e, 0x47,
+    0x8b, 0x67, 0xad, 0x30, 0x4e, 0xe2, 0x28, 0x52, 0xc9, 0x84, 0x82, 0x0a, 0x74, 0xce, 0xfb, 0x21,
+    0xf9, 0x0c, 0x24, 0xdc, 0xae, 0x13, 0x03, 0xac, 0x10, 0x84, 0x1e, 0x9a, 0x8b, 0x2a, 0x3e, 0xe6,
+    0x96, 0x8c, 0x66, 0x68, 0xb6, 0xc1, 0x10, 0x68, 0x9e, 0x93, 0xaa, 0x0f, 0x3a, 0x61, 0x5a, 0x1e,
+    0x8f, 0x30, 0x03, 0xc9, 0xcc, 0x09, 0x72, 0x73, 0xc8, 0xcf, 0x4b, 0xc0, 0x43, 0x79, 0x55, 0x3b,
+    0xbf, 0xe5, 0x9e, 0x14, 0xc9, 0x51, 0x98, 0x8a, 0xf2, 0x53, 0x0b, 0x8b, 0x82, 0xc1, 0xe2, 0xbd,
+    0xf2, 0x6c, 0x02, 0xfa, 0x04, 0x2b, 0x30, 0xcd, 0xfc, 0xef, 0x09, 0x03, 0x84, 0x94, 0x2b, 0x3c,
+    0x80, 0xd1, 0x72, 0x41, 0x59, 0x71, 0x43, 0xc2, 0x33, 0xe7, 0x0b, 0xed, 0xf9, 0xc8, 0x07, 0x2f,
+    0x06, 0xaa, 0xca, 0xd9, 0x8d, 0xaa, 0x6b, 0x1e, 0x3d, 0xd2, 0x48, 0x54, 0x5d, 0xcd, 0x3c, 0xe1,
+    0xf7, 0xf9, 0x43, 0x10, 0x96, 0x97, 0x69, 0x3c, 0x2c, 0xa3, 0xc0, 0x29, 0x01, 0x8f, 0xe2, 0xe4,
+    0xb2, 0x8d, 0x20, 0xce, 0x9a, 0xa8, 0x17, 0x1f, 0x46, 0x12, 0x08, 0x56, 0x37, 0xc2, 0xef, 0x8a,
+    0x1f, 0x25, 0x29, 0x58, 0xff, 0x4b, 0xe9, 0xf4, 0x72, 0xed, 0xd9, 0x80, 0x79, 0x11, 0x6a, 0x53,
+    0x94, 0xd5, 0xc1, 0xe8, 0x15, 0xaa, 0xfb, 0x90, 0xde, 0x8e, 0xe9, 0xfa, 0x68, 0xd5, 0x65, 0xf7,
+    0x24, 0x97, 0x5e, 0xaa, 0x09, 0x5e, 0x62, 0x17, 0xcd, 0x66, 0xea, 0x06, 0x67, 0x94, 0x3d, 0xf3,
+    0x46, 0xe7, 0x5b, 0x2b, 0xc8, 0x18, 0x40, 0xb7, 0x5c, 0x81, 0xce, 0x84, 0x57, 0x4c, 0xd6, 0x52,
+    0x3b, 0xd0, 0x0c, 0x21, 0x17, 0x57, 0xaa, 0xae, 0x24, 0xfa, 0xb5, 0x17, 0x3a, 0x03, 0xec, 0x48,
+    0x05, 0x6b, 0xc8, 0x82, 0xfa, 0x06, 0xa9, 0xc9, 0x10, 0xe6, 0xda, 0xe3, 0x90, 0x53, 0x88, 0xa3,
+    0x24, 0x57, 0x13, 0xbd, 0x1b, 0x5a, 0x15, 0xf5, 0x17, 0xf2, 0x28, 0x32, 0x74, 0x27, 0xd2, 0xcb,
+    0x1a, 0x0f, 0xa0, 0xb5, 0xf3, 0xef, 0xb0, 0x54, 0x87, 0x8a, 0x16, 0x4a, 0x4e, 0x76, 0x20, 0x08,
+    0xe2, 0x18, 0x2e, 0xd1, 0x1b, 0xde, 0x19, 0xe8, 0xe6, 0xdd, 0x79, 0x8f, 0xba, 0xa6, 0x85, 0x25,
+    0xa5, 0xc6, 0xf2, 0xb7, 0x6e, 0x71, 0xa6, 0x9a, 0xc8, 0x5a, 0xef, 0xf4, 0x6f, 0x1e, 0xba, 0xb6,
+    0x1c, 0x7a, 0xee, 0xc1, 0x7f, 0xe0, 0xb2, 0x16, 0xaf, 0x01, 0x6c, 0x46, 0x61, 0x7d, 0x5d, 0x47,
+    0x27, 0xe9, 0x7c, 0xa1, 0xda, 0xf2, 0xb6, 0xb1, 0x25, 0xfd, 0x3e, 0x31, 0x17, 0xd8, 0x77, 0x2d,
+    0x66, 0xf1, 0x44, 0xc4, 0x34, 0xb4, 0x67, 0x31, 0xfe, 0x37, 0x56, 0x25, 0x65, 0xb5, 0x52, 0xac,
+    0x86, 0x83, 0xbd, 0x56, 0xb4, 0x49, 0x1f, 0x29, 0x2f, 0x83, 0xa6, 0x8c, 0xef, 0x41, 0x44, 0x2f,
+    0x65, 0x7c, 0x13, 0xb7, 0x89, 0x3f, 0xbc, 0x49, 0xdf, 0x95, 0x09, 0x36, 0x11, 0x2a, 0x3a, 0xbe,
+    0x8b, 0x77, 0x9d, 0x30, 0xbc, 0x8d, 0xd5, 0x3f, 0xf2, 0xf7, 0x41, 0xa2, 0xfb, 0xf7, 0x2b, 0x7b,
+    0x6e, 0xc8, 0xb7, 0x57, 0xdc, 0xa0, 0xaf, 0x7e, 0x33, 0x76, 0xe1, 0x8c, 0x55, 0xa7, 0xe3, 0x8e,
+    0xb4, 0x7c, 0x54, 0xbc, 0x75, 0x94, 0x47, 0x04, 0xea, 0xb7, 0xe9, 0x2b, 0x08, 0xd3, 0x7d, 0x94,
+    0x0e, 0xeb, 0x71, 0x9d, 0x79, 0x0a, 0x47, 0x9d, 0xbe, 0x30, 0xdc, 0x69, 0x3f, 0xf6, 0xa2, 0xf4,
+    0xda, 0x73, 0xdc, 0xf2, 0xe4, 0xf4, 0xd8, 0xb4, 0xe0, 0x2d, 0x78, 0xdd, 0xd2, 0x29, 0x6b, 0x10,
+    0x1d, 0xd0, 0xa3, 0x24, 0xf2, 0x21, 0x17, 0xc5, 0xda, 0x9f, 0x60, 0x52, 0xdd, 0x32, 0x0c, 0x79,
+    0xb8, 0x15, 0x03, 0x3b, 0xb7, 0xc9, 0x63, 0xf3, 0xec, 0x4d, 0xd2, 0xa0, 0xab, 0xa4, 0xd7, 0xde,
+    0x6a, 0x64, 0xce, 0xe8, 0x39, 0x02, 0x30, 0xee, 0xe2, 0x5b, 0xf6, 0x97, 0x46, 0xd3, 0xb1, 0xc9,
+    0x88, 0xaa, 0x55, 0x5e, 0x60, 0x2a, 0xd7, 0x0c, 0xaf, 0x27, 0x3f, 0xa3, 0x16, 0x0b, 0xf4, 0x3c,
+    0x76, 0xdf, 0x35, 0x5c, 0xb6, 0x19, 0x20, 0x4d, 0x15, 0xe9, 0x6a, 0x50, 0x50, 0x4f, 0xaf, 0x22,
+    0x89, 0x04, 0xc4, 0x2d, 0x91, 0x4c, 0x0c, 0x54, 0xe7, 0x22, 0x9d, 0x55, 0xf0, 0xf9, 0x98, 0xf0,
+    0x10, 0xdc, 0x21, 0x82, 0x3b, 0x62, 0x64, 0xa3, 0xec, 0xe3, 0x82, 0x32, 0x30, 0x50, 0xeb, 0x4f,
+    0xaa, 0x0d, 0x7b, 0xc0, 0x46, 0xda, 0x24, 0xfc, 0xa2, 0xa3, 0x25, 0xb9, 0x0e, 0x89, 0x2d, 0xe1,
+    0xb0, 0xba, 0xad, 0x3a, 0x53, 0x63, 0x98, 0x34, 0x24, 0x54, 0x04, 0x11, 0x88, 0x9f, 0x47, 0xfb,
+    0x25, 0x6e, 0x9c, 0x0a, 0xb5, 0x4a, 0x4b, 0x11, 0x54, 0x48, 0x9e, 0xc2, 0x95, 0xcf, 0x26, 0x26,
+    0xc5, 0x95, 0xe5, 0x07, 0x3e, 0x0b, 0x5e, 0x87, 0x7b, 0xc7, 0x22, 0xad, 0x65, 0x7d, 0x83, 0xb3,
+    0xd7, 0xf0, 0xc7, 0xfe, 0x98, 0x0c, 0xeb, 0x93, 0x5a, 0x1f, 0xd3, 0xd6, 0xa5, 0x3d, 0xa1, 0xf9,
+    0x06, 0xa6, 0x7b, 0xa4, 0x0c, 0x50, 0x82, 0xd4, 0x07, 0x29, 0xde, 0x39, 0x52, 0x25, 0xde, 0x91,
+    0x72, 0xae, 0xc6, 0x3e, 0xc8, 0x3a, 0x6f, 0xa0, 0x3a, 0x18, 0x6b, 0x76, 0x1a, 0x0c, 0x6f, 0xb5,
+    0xa8, 0x7b, 0xe8, 0x56, 0x36, 0xfc, 0x72, 0x27, 0x07, 0x7d, 0x33, 0x97, 0x77, 0x4a, 0x7d, 0x8c,
+    0xc7, 0x24, 0xa0, 0x59, 0xfc, 0x1b, 0xcd, 0x89, 0xc8, 0x80, 0x72, 0x52, 0xe0, 0x53, 0xc9, 0x50,
+    0x76, 0x20, 0xd9, 0x3b, 0x30, 0x73, 0x80, 0x09, 0xaa, 0x74, 0xc2, 0x48, 0xf9, 0x2c, 0xfd, 0xbe,
+    0xe2, 0xd3, 0x0a, 0x68, 0x76, 0x3e, 0xea, 0x72, 0x92, 0x7a, 0xfb, 0xeb, 0xdf, 0x03, 0xba, 0x0f,
+    0x29, 0x12, 0xed, 0x28, 0x70, 0x25, 0xd6, 0x32, 0x85, 0x99, 0xcd, 0xf5, 0xff, 0xba, 0xc7, 0x10,
+    0x62, 0x6f, 0x91, 0x98, 0x9f, 0x53, 0xbe, 0x5a, 0x1f, 0x40, 0xd6, 0x11, 0xfa, 0x57, 0xeb, 0x9e,
+    0x4e, 0x9b, 0xa0, 0xf9, 0x3d, 0xa0, 0x5d, 0x23, 0xb7, 0x64, 0x33, 0xbd, 0xa9, 0xe5, 0xfa, 0xd2,
+    0xf9, 0xba, 0x33, 0x3b, 0xb8, 0xe6, 0x19, 0x4a, 0x17, 0xf8, 0xdc, 0xee, 0x08, 0x28, 0x1a, 0x99,
+    0x66, 0x57, 0x1b, 0xc4, 0xd5, 0x95, 0x07, 0xf7, 0xf2, 0xd6, 0x28, 0x92, 0xf6, 0x51, 0xfd, 0x1b,
+    0x09, 0xc1, 0xda, 0xfc, 0xd6, 0x5c, 0x5b, 0x6f, 0xa6, 0xf9, 0xfe, 0x04, 0x66, 0x37, 0xa2, 0x01,
+    0x11, 0xd3, 0xe4, 0x41, 0xd6, 0x8d, 0x15, 0xdc, 0xc6, 0x94, 0x5b, 0xb1, 0xb6, 0x8a, 0x67, 0x0f,
+    0x42, 0x4f, 0xb7, 0x42, 0x9b, 0xc1, 0x80, 0xff, 0x8c, 0x42, 0x3d, 0x9a, 0x62, 0x33, 0xee, 0x3f,
+    0x26, 0x16, 0xf7, 0x38, 0x10, 0xd0, 0xf0, 0x8a, 0x49, 0x85, 0x20, 0xde, 0xf6, 0xfa, 0xef, 0x35,
+    0x97, 0xc6, 0xec, 0xe1, 0xd2, 0x53, 0x78, 0xa9, 0xa8, 0x8b, 0xdd, 0x67, 0x9e, 0x84, 0x83, 0x37,
+    0x1b, 0x44, 0xaf, 0xa8, 0xb3, 0x53, 0x17, 0xc7, 0xce, 0xc9, 0x03, 0x64, 0x26, 0x30, 0xe9, 0x7a,
+    0xe5, 0xf9, 0xbd, 0xbb, 0xe1, 0xaa, 0xd2, 0xe1, 0x74, 0xec, 0x6a, 0xa1, 0xa0, 0x4f, 0x24, 0xef,
+    0x53, 0xaf, 0xd4, 0x6a, 0x0a, 0xc4, 0xfb, 0xfc, 0x83, 0xd7, 0x66, 0x63, 0x37, 0xd3, 0x17, 0x5c,
+    0x96, 0x3a, 0x89, 0x3a, 0xda, 0xbc, 0x1a, 0x68, 0xaf, 0xdc, 0x0d, 0x67, 0x45, 0x61, 0x77, 0xe6,
+    0xe2, 0xc8, 0x07, 0x19, 0x4c, 0x06, 0x91, 0x83, 0xb0, 0x47, 0x62, 0x3a, 0x57, 0xd1, 0xbc, 0xdf,
+    0x9c, 0x72, 0x65, 0x5f, 0xa0, 0x05, 0x17, 0xed, 0xde, 0x8d, 0xe3, 0xab, 0x0b, 0x6f, 0x7c, 0x4d,
+    0x9b, 0x65, 0x18, 0x59, 0xb7, 0x58, 0x8d, 0x6c, 0x7f, 0x24, 0x5d, 0x87, 0xf7, 0x6e, 0x0e, 0x71,
+    0xbb, 0xb9, 0xf4, 0x04, 0xba, 0xe0, 0x8e, 0x76, 0xf3, 0x1e, 0x0f, 0x00, 0x65, 0x22, 0xb0, 0xe2,
+    0xba, 0xf4, 0xd8, 0xe2, 0xa6, 0x5f, 0xb6, 0x9f, 0x41, 0xca, 0x92, 0x36, 0x1d, 0xed, 0xfa, 0x06,
+    0x85, 0x9b, 0x9e, 0x57, 0x0c, 0xd3, 0xca, 0x4b, 0xf5, 0x16, 0xea, 0x84, 0x61, 0xf6, 0x12, 0xc8,
+    0x8a, 0x2b, 0xe7, 0x74, 0x4f, 0xc4, 0xda, 0x32, 0x48, 0xa7, 0x26, 0xb2, 0xb4, 0x20, 0x01, 0xfe,
+    0xa3, 0xca, 0x0e, 0xf3, 0x9d, 0x47, 0x04, 0xf0, 0x17, 0xdc, 0x00, 0x0d, 0x48, 0xd1, 0xfb, 0xbe,
+    0xe0, 0xc5, 0x59, 0x7b, 0x16, 0xde, 0x2e, 0x7c, 0xe9, 0x9e, 0x74, 0xf4, 0x2b, 0xa4, 0xd9, 0x88,
+    0x27, 0x48, 0x87, 0x7c, 0x81, 0x29, 0xf2, 0x37, 0xcd, 0x50, 0xbb, 0xf9, 0x02, 0x73, 0x4c, 0xed,
+    0x3b, 0xb7, 0x47, 0xa5, 0x16, 0xbb, 0xba, 0xcc, 0x7b, 0xd0, 0xc4, 0x44, 0x5f, 0xa9, 0x2f, 0xd0,
+    0xe2, 0x21, 0x94, 0x04, 0xd2, 0x1d, 0xe8, 0x23, 0x8b, 0x55, 0x93, 0x03, 0x9b, 0x7e, 0x87, 0x94,
+    0xf4, 0xfa, 0xa4, 0xf5, 0x95, 0x2e, 0xac, 0x00, 0xc3, 0x12, 0x83, 0x39, 0xee, 0x4a, 0xbb, 0x7b,
+    0xa9, 0xd5, 0x0c, 0x59, 0x2d, 0xc4, 0x89, 0xeb, 0x68, 0xd5, 0xf6, 0x72, 0x2b, 0xf4, 0x91, 0x06,
+    0xbf, 0x1b, 0x38, 0x82, 0xc3, 0xcc, 0xc9, 0x53, 0x83, 0xc1, 0x5f, 0xe7, 0xc8, 0xdb, 0x3d, 0x76,
+    0x09, 0x76, 0xd9, 0xd4, 0xbe, 0x81, 0x1a, 0x04, 0xad, 0x0b, 0xee, 0x21, 0xd2, 0xc8, 0x37, 0x3b,
+    0x2f, 0xb2, 0x84, 0x31, 0x7f, 0xa4, 0xae, 0x13, 0x38, 0x43, 0x24, 0x0f, 0x93, 0xfc, 0xf9, 0xbd,
+    0x97, 0x69, 0xeb, 0xa2, 0x21, 0xd2, 0x49, 0x71, 0x96, 0xb2, 0xaf, 0x38, 0x5d, 0x23, 0xe1, 0x72,
+    0x0b, 0x53, 0x3b, 0x2b, 0x59, 0x09, 0x09, 0xe4, 0x55, 0x23, 0x5f, 0xf8, 0x47, 0xf7, 0xba, 0xd1,
+    0xfa, 0x6e, 0x24, 0x28, 0xa4, 0xac, 0x57, 0xa1, 0x0f, 0xf3, 0x3a, 0x5f, 0x75, 0xc3, 0xe8, 0x91,
+    0xbe, 0x17, 0x81, 0xaa, 0x73, 0xee, 0x50, 0xf9, 0x47, 0x01, 0x6a, 0x8f, 0xb7, 0xb7, 0x77, 0x3c,
+    0x75, 0x12, 0x1b, 0xfb, 0xf7, 0x9e, 0x2f, 0xbf, 0xe7, 0x5c, 0x7b, 0xf7, 0x9c, 0xe1, 0x4d, 0xe7,
+    0xba, 0x2f, 0x0e, 0xc5, 0x5d, 0x67, 0xcf, 0x4f, 0xe8, 0x33, 0x22, 0x97, 0x86, 0x6b, 0x7e, 0x69,
+    0xb8, 0xd6, 0x04, 0x1f, 0xe5, 0x27, 0xe6, 0xde, 0x67, 0x3a, 0xa1, 0x42, 0xc6, 0x2e, 0xc0, 0xfd,
+    0xb9, 0xae, 0x41, 0xca, 0x0f, 0x27, 0xd4, 0x3a, 0xc6, 0x28, 0x47, 0x0b, 0x2f, 0xb5, 0xa0, 0xfe,
+    0xa0, 0xe8, 0x3b, 0x50, 0xe7, 0xf3, 0xb6, 0xc4, 0x1d, 0x84, 0x81, 0x03, 0x2d, 0x0d, 0xa4, 0x23,
+    0x2a, 0xed, 0x5f, 0xff, 0xea, 0x23, 0xda, 0x37, 0x98, 0xf1, 0x1b, 0x17, 0x13, 0xbd, 0x34, 0xe7,
+    0x11, 0x54, 0xfd, 0x55, 0xfd, 0x1e, 0xa1, 0xbb, 0x72, 0x1a, 0xae, 0xb0, 0xf2, 0x16, 0x18, 0xcc,
+    0x80, 0x27, 0x98, 0x1c, 0x08, 0x05, 0x43, 0xdc, 0x07, 0x09, 0xd9, 0x4d, 0xf8, 0x5a, 0xa5, 0x61,
+    0x72, 0x64, 0x2c, 0x01, 0x0a, 0x75, 0xe3, 0x23, 0xff, 0x83, 0x6f, 0xf5, 0xf1, 0x77, 0x8f, 0x7c,
+    0xec, 0x7a, 0x46, 0x34, 0x00, 0x00,
+};
+
+// espwebc.html: 22529 bytes, 4661 gzipped
+static const uint8_t ESPWEBC_ASSET_3[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x1c, 0x6b, 0x73, 0xdb, 0xb8,
+    0xf1, 0x7b, 0x7e, 0x05, 0xc2, 0x76, 0x4a, 0xa9, 0xb5, 0xc8, 0x24, 0xd7, 0x76, 0x3a, 0xb6, 0xe5,
+    0x19, 0xc7, 0x8f, 0x9e, 0x6f, 0xe2, 0x8b, 0x1b, 0xd9, 0x4d, 0x3b, 0xb9, 0xcc, 0x85, 0x22, 0x21,
+    0x09, 0x31, 0x5f, 0x47, 0x42, 0x96, 0xdd, 0xab, 0xff, 0x7b, 0x77, 0x01, 0xf0, 0x0d, 0x52, 0x14,
+    0xe3, 0x5c, 0xaf, 0x33, 0xf5, 0x24, 0x23, 0x12, 0x8f, 0xc5, 0x62, 0xdf, 0x00, 0x16, 0x3c, 0x7c,
+    0x7e, 0xfa, 0xf6, 0xe4, 0xfa, 0x9f, 0x57, 0x67, 0x64, 0xc5, 0x03, 0xff, 0xe8, 0xd9, 0x21, 0xfe,
+    0x10, 0xdf, 0x09, 0x97, 0x53, 0x83, 0x86, 0xc6, 0xd1, 0x33, 0x28, 0xa1, 0x8e, 0x77, 0xf4, 0x8c,
+    0xc0, 0xdf, 0x61, 0x40, 0xb9, 0x43, 0x42, 0x27, 0xa0, 0x53, 0xf3, 0x8e, 0xd1, 0x4d, 0x1c, 0x25,
+    0xdc, 0x24, 0x6e, 0x14, 0x72, 0x1a, 0xf2, 0xa9, 0xb9, 0x61, 0x1e, 0x5f, 0x4d, 0x3d, 0x7a, 0xc7,
+    0x5c, 0x3a, 0x11, 0x2f, 0x7b, 0x84, 0x85, 0x8c, 0x33, 0xc7, 0x9f, 0xa4, 0xae, 0xe3, 0xd3, 0xe9,
+    0x4b, 0x53, 0x01, 0xf2, 0x59, 0x78, 0x4b, 0x12, 0xea, 0x4f, 0x8d, 0x94, 0x3f, 0xf8, 0x34, 0x5d,
+    0x51, 0xca, 0x0d, 0xc2, 0x1f, 0x62, 0x3a, 0x35, 0x38, 0xbd, 0xe7, 0xb6, 0x9b, 0xa6, 0x06, 0x59,
+    0x25, 0x74, 0xa1, 0x5a, 0x58, 0x58, 0x50, 0xc6, 0xc2, 0x5d, 0x39, 0x49, 0x4a, 0xf9, 0xd4, 0xb8,
+    0xb9, 0x3e, 0x9f, 0xfc, 0x25, 0xab, 0xe2, 0x8c, 0xfb, 0xf4, 0xe8, 0x6c, 0x76, 0xf5, 0xcd, 0x2b,
+    0x72, 0x12, 0x85, 0x0b, 0xb6, 0x5c, 0x27, 0x0e, 0x67, 0x51, 0x48, 0x2e, 0x00, 0xc9, 0x64, 0xe1,
+    0xb8, 0xf4, 0xd0, 0x96, 0x8d, 0x64, 0x07, 0x01, 0x5c, 0x3e, 0xe3, 0x9f, 0x45, 0x93, 0x24, 0x4a,
+    0xc8, 0xcf, 0x79, 0x01, 0xfe, 0xb9, 0x91, 0x1f, 0x25, 0xfb, 0x80, 0xae, 0x77, 0x90, 0x97, 0x3f,
+    0x3e, 0x2b, 0xfa, 0x2c, 0x58, 0x12, 0x6c, 0x9c, 0x84, 0x4e, 0x18, 0xa7, 0x41, 0xad, 0xef, 0x3c,
+    0x4a, 0x3c, 0x0a, 0x9d, 0x5f, 0xc6, 0xf7, 0x24, 0x8d, 0x7c, 0xe6, 0x91, 0xdf, 0xb8, 0xae, 0x7b,
+    0x50, 0x69, 0x13, 0x3b, 0x9e, 0xc7, 0xc2, 0x25, 0x34, 0x7a, 0x11, 0xdf, 0x57, 0xab, 0x02, 0x27,
+    0x59, 0xb2, 0x70, 0x32, 0x8f, 0x38, 0x8f, 0x82, 0x7d, 0xf2, 0xaa, 0xd2, 0xa0, 0x1d, 0x87, 0xd5,
+    0x37, 0x35, 0x34, 0x14, 0x1c, 0x1e, 0xc5, 0xfb, 0xe4, 0x45, 0x1f, 0x08, 0x2c, 0x58, 0x36, 0x40,
+    0xdc, 0x4b, 0xa6, 0x22, 0x1a, 0x0d, 0x44, 0x3d, 0x96, 0xc6, 0xbe, 0xf3, 0xb0, 0x4f, 0xe6, 0x7e,
+    0xe4, 0xde, 0x1e, 0xb4, 0x0e, 0xfe, 0xb2, 0x36, 0x03, 0xc1, 0x04, 0xbb, 0xc4, 0x85, 0xc3, 0xd4,
+    0x4d, 0x58, 0xcc, 0x49, 0x9a, 0xb8, 0x53, 0x63, 0xc5, 0x79, 0x9c, 0xee, 0xdb, 0xb6, 0xeb, 0x85,
+    0x9f, 0x53, 0xcb, 0xf5, 0xa3, 0xb5, 0xb7, 0xf0, 0x01, 0x47, 0xcb, 0x8d, 0x02, 0xdb, 0xf9, 0xec,
+    0xdc, 0xdb, 0x3e, 0x9b, 0xa7, 0xb6, 0x9b, 0x3c, 0xc4, 0x3c, 0x9a, 0x7c, 0x4e, 0xed, 0x3f, 0x5a,
+    0x2f, 0xac, 0x17, 0xc5, 0xbb, 0x15, 0xb0, 0xd0, 0xfa, 0x0c, 0x82, 0x03, 0x43, 0x08, 0xb0, 0x95,
+    0x31, 0x0a, 0xb6, 0x83, 0x08, 0xa7, 0x9c, 0x78, 0x4e, 0xba, 0xfa, 0x2e, 0xfd, 0x3b, 0x4d, 0x52,
+    0x14, 0x98, 0x29, 0x31, 0x5e, 0x5a, 0x2f, 0x8c, 0x02, 0x59, 0x2f, 0x72, 0xd7, 0x01, 0x08, 0xba,
+    0x05, 0xec, 0x3a, 0xbb, 0x83, 0x87, 0x37, 0x2c, 0x05, 0xc1, 0xa7, 0xc9, 0xc8, 0x3c, 0x7d, 0x7b,
+    0x79, 0x22, 0xb5, 0xe0, 0x4d, 0xe4, 0x78, 0xd4, 0x33, 0xf7, 0xc8, 0x62, 0x1d, 0xba, 0x42, 0xf0,
+    0x46, 0xe3, 0x1a, 0x21, 0x7d, 0x68, 0x72, 0x0a, 0x43, 0xcd, 0x23, 0x27, 0xf1, 0x46, 0xe3, 0x2a,
+    0xad, 0xd6, 0xb1, 0xe7, 0x70, 0x3a, 0x7b, 0x00, 0xc8, 0xc1, 0x45, 0xb8, 0x88, 0xb0, 0xbe, 0xd2,
+    0xc0, 0xb6, 0x41, 0x94, 0x85, 0x4e, 0xb1, 0x7f, 0x51, 0xe2, 0x02, 0x08, 0xc2, 0xa3, 0xe5, 0x12,
+    0x14, 0x6a, 0x49, 0x9c, 0x05, 0xc8, 0x38, 0x01, 0x64, 0x08, 0x4b, 0xc5, 0x30, 0xd4, 0x23, 0x4e,
+    0xe8, 0x11, 0xea, 0x53, 0x44, 0x3c, 0x25, 0xf4, 0x1e, 0x50, 0xae, 0xf2, 0x2d, 0x9b, 0xd4, 0x4f,
+    0x6b, 0x9a, 0x3c, 0xcc, 0xa0, 0xa5, 0xcb, 0xa3, 0xe4, 0xd8, 0xf7, 0x47, 0xa6, 0x85, 0xc0, 0x27,
+    0x42, 0x59, 0xcc, 0xb1, 0xb5, 0x88, 0x92, 0x33, 0xc7, 0x5d, 0x8d, 0x8a, 0x79, 0x89, 0x9a, 0xfa,
+    0xe4, 0xf0, 0x4f, 0x54, 0x68, 0xa8, 0xe4, 0xfa, 0xcc, 0xbd, 0xad, 0x90, 0x86, 0x62, 0x03, 0x1d,
+    0x08, 0x35, 0xd3, 0x19, 0xc8, 0x0c, 0x89, 0x93, 0x28, 0x76, 0x96, 0x52, 0x8b, 0xd9, 0x82, 0x84,
+    0xd4, 0xa5, 0x69, 0xea, 0x24, 0x0f, 0x7b, 0x04, 0x34, 0x15, 0x6c, 0xc8, 0x03, 0x81, 0x8a, 0x94,
+    0x27, 0x6b, 0x97, 0xaf, 0x13, 0x0a, 0x5a, 0x06, 0xef, 0x50, 0x28, 0xb0, 0x90, 0xb4, 0xa1, 0xa9,
+    0x76, 0x00, 0x31, 0xba, 0x95, 0xc2, 0x18, 0x57, 0xc5, 0x10, 0x75, 0x86, 0x54, 0x45, 0x04, 0x49,
+    0x72, 0x26, 0xa9, 0x09, 0x02, 0xc2, 0x57, 0x4c, 0x48, 0x65, 0x4a, 0x53, 0xae, 0xe8, 0x65, 0xb6,
+    0x74, 0x07, 0xc4, 0x47, 0xa5, 0xce, 0x6d, 0x73, 0x16, 0x23, 0x15, 0xcd, 0x00, 0xb8, 0x93, 0xa6,
+    0x48, 0x41, 0x4b, 0x4e, 0x64, 0x64, 0xd2, 0xfb, 0x18, 0x58, 0x4a, 0x5b, 0x07, 0x7a, 0x6c, 0x94,
+    0x3e, 0xd6, 0x5a, 0x3e, 0x76, 0x8b, 0x94, 0x13, 0x02, 0x41, 0xf9, 0x0a, 0x04, 0x49, 0xd0, 0x87,
+    0xf8, 0x8a, 0x7f, 0x29, 0x81, 0x32, 0x5a, 0xef, 0x78, 0xe9, 0xdc, 0x02, 0xc9, 0x91, 0xee, 0x2b,
+    0x40, 0xcb, 0xa7, 0xe7, 0xcc, 0xa7, 0x52, 0x8a, 0x84, 0xe4, 0xc9, 0xc2, 0x9b, 0xc4, 0x9f, 0xad,
+    0xe7, 0x01, 0x83, 0x32, 0x68, 0xe8, 0xd1, 0x05, 0x0b, 0x41, 0x32, 0xe7, 0x14, 0x64, 0x0a, 0x45,
+    0xd8, 0x17, 0xc2, 0x0b, 0x43, 0x06, 0x15, 0xe8, 0x77, 0x4e, 0x42, 0x16, 0x00, 0xee, 0x22, 0x8c,
+    0xd7, 0x48, 0xed, 0x5c, 0x54, 0x97, 0x94, 0x2b, 0xfa, 0xbc, 0x7e, 0xb8, 0xf0, 0x46, 0x26, 0x36,
+    0xaa, 0x93, 0x03, 0xe9, 0x9d, 0x77, 0xd6, 0x51, 0x3b, 0xaf, 0xd4, 0x09, 0x2a, 0xa0, 0xbd, 0xa4,
+    0x20, 0xa9, 0xf5, 0x39, 0x81, 0xec, 0x3a, 0x7e, 0x4a, 0xeb, 0x04, 0x7d, 0xd6, 0xc0, 0x7b, 0x9d,
+    0xf8, 0xe7, 0x51, 0x12, 0x74, 0x61, 0x1d, 0x71, 0xe7, 0x46, 0xb6, 0xd2, 0xe1, 0xae, 0x00, 0xe8,
+    0x30, 0x57, 0x55, 0x1a, 0xbc, 0x53, 0x41, 0xe4, 0x1c, 0xef, 0x9c, 0xec, 0xbd, 0xd0, 0x06, 0x66,
+    0x9e, 0x53, 0xee, 0xae, 0x32, 0x97, 0x0d, 0xe6, 0x90, 0x3b, 0x95, 0x16, 0x0b, 0xac, 0x7e, 0xcf,
+    0x16, 0x6c, 0x46, 0x39, 0x07, 0x96, 0xa5, 0x75, 0x5d, 0x11, 0x0d, 0x2e, 0xff, 0x76, 0x7d, 0xdd,
+    0xd9, 0xe0, 0x3d, 0x9d, 0xeb, 0xea, 0x85, 0x58, 0xe6, 0x6f, 0xb9, 0x8d, 0xa8, 0x59, 0xcb, 0x86,
+    0x6b, 0x46, 0xad, 0x4c, 0x9d, 0x3b, 0xea, 0xcd, 0x38, 0x18, 0x4e, 0x20, 0xf8, 0x77, 0xb3, 0xb7,
+    0xdf, 0x5b, 0x31, 0x06, 0x07, 0x23, 0x70, 0x45, 0x8e, 0x0f, 0x36, 0x24, 0x71, 0x96, 0x14, 0xe9,
+    0x7f, 0x01, 0x46, 0x75, 0x64, 0x78, 0x19, 0xb4, 0x0c, 0x0b, 0x63, 0xac, 0x61, 0xc0, 0xf3, 0x02,
+    0xe8, 0x18, 0xac, 0x0c, 0x98, 0x96, 0xb0, 0xa6, 0x36, 0xd8, 0xaa, 0x68, 0x64, 0xa1, 0xfc, 0x6a,
+    0xcd, 0x61, 0x2e, 0x01, 0xf3, 0xc8, 0x7b, 0xb0, 0x90, 0xaa, 0x10, 0xb7, 0xc8, 0xe6, 0x80, 0x6e,
+    0x1d, 0x42, 0x9d, 0x47, 0x1a, 0x6e, 0xe5, 0xb4, 0x71, 0x57, 0xd4, 0xbd, 0x3d, 0x49, 0x33, 0x97,
+    0xd5, 0xa0, 0x8e, 0x44, 0x5b, 0x52, 0x1d, 0xa4, 0x23, 0x8b, 0xa3, 0xcc, 0x71, 0x03, 0x47, 0x1c,
+    0x3b, 0x1c, 0x25, 0x34, 0x8d, 0x81, 0xa0, 0x80, 0xd6, 0x51, 0x8b, 0x7d, 0x12, 0x94, 0xc9, 0x9a,
+    0x59, 0xd1, 0x6d, 0x97, 0x1d, 0xe3, 0xab, 0x24, 0xda, 0x80, 0xb9, 0xde, 0x90, 0x33, 0x0c, 0xaa,
+    0x46, 0xe6, 0xb9, 0x03, 0x8a, 0x84, 0xee, 0x4a, 0x62, 0x44, 0x4e, 0x66, 0x33, 0xa2, 0xd3, 0xdd,
+    0x76, 0x53, 0x56, 0x9a, 0x54, 0x8e, 0x04, 0x86, 0x8b, 0x3a, 0xa3, 0xfd, 0xd8, 0x36, 0x4b, 0xa0,
+    0xc0, 0x35, 0xf4, 0x69, 0x9f, 0xa4, 0x14, 0xaa, 0x3b, 0x49, 0xd4, 0x4b, 0x07, 0x51, 0x9d, 0x12,
+    0xd5, 0xcb, 0x0a, 0xf0, 0x7d, 0x64, 0xff, 0x60, 0xff, 0xf0, 0xfb, 0x1f, 0xd2, 0xdf, 0x2b, 0xca,
+    0xef, 0xc3, 0xe3, 0xe8, 0xc3, 0x0f, 0x9e, 0xf5, 0xf1, 0x0f, 0x63, 0x78, 0x84, 0x2a, 0xdb, 0xee,
+    0x70, 0x04, 0x15, 0xd0, 0xbf, 0xfb, 0x5d, 0x65, 0xa8, 0x0f, 0x2f, 0x3f, 0x76, 0x11, 0x55, 0xcd,
+    0xbe, 0xd6, 0xa3, 0x85, 0x7e, 0xe0, 0xf8, 0x81, 0x99, 0x3b, 0x70, 0x08, 0x39, 0xa2, 0x40, 0x93,
+    0x30, 0xe2, 0x64, 0x11, 0xad, 0xc3, 0x9d, 0x3c, 0x4d, 0x93, 0xe4, 0xae, 0xa0, 0x97, 0x0c, 0xab,
+    0x3b, 0x29, 0x1e, 0x81, 0x70, 0x52, 0x89, 0x86, 0xc0, 0x66, 0x1f, 0xec, 0x98, 0x78, 0x6f, 0x19,
+    0x5e, 0x51, 0xc2, 0xbc, 0x09, 0x6f, 0xc3, 0x68, 0x13, 0x9a, 0x07, 0x9d, 0x8e, 0x4f, 0xa7, 0x3e,
+    0x42, 0x0a, 0xcb, 0xa1, 0x56, 0xa7, 0xfa, 0xd8, 0xa9, 0x68, 0xc9, 0xa0, 0x65, 0x2f, 0x05, 0xca,
+    0x05, 0xf4, 0x73, 0x8a, 0xaa, 0xd9, 0x4a, 0x1a, 0x18, 0x16, 0x5a, 0x8f, 0xf4, 0x84, 0x81, 0xf0,
+    0x16, 0xcc, 0xe5, 0xc9, 0x3e, 0x31, 0xd4, 0x34, 0x8d, 0x3d, 0x6d, 0x3b, 0x58, 0x74, 0x51, 0x3f,
+    0x8a, 0x71, 0xa5, 0xb1, 0xbd, 0x25, 0x2c, 0xcf, 0x7a, 0x34, 0x93, 0x31, 0x32, 0x0a, 0xf7, 0xb6,
+    0xb6, 0x4a, 0x62, 0x4a, 0xed, 0x34, 0xac, 0xd8, 0xc2, 0x8b, 0x66, 0xdc, 0xab, 0xb7, 0xf4, 0x79,
+    0x83, 0x22, 0x0a, 0x6b, 0xf5, 0xb0, 0x65, 0x86, 0xe9, 0x0c, 0x7c, 0x1d, 0x96, 0x4e, 0xef, 0x6a,
+    0x92, 0x29, 0x11, 0x24, 0x08, 0x33, 0x8b, 0xaa, 0xbb, 0x15, 0x25, 0xf3, 0x1c, 0x7d, 0x1c, 0x6f,
+    0x59, 0xfb, 0x30, 0x78, 0x4a, 0x4b, 0x83, 0x01, 0x1e, 0xee, 0x3a, 0x49, 0x60, 0x3c, 0xff, 0xa1,
+    0xd2, 0x1b, 0x42, 0xd7, 0x80, 0x81, 0x94, 0x41, 0x14, 0x35, 0xfa, 0xd0, 0x70, 0x08, 0x7b, 0x4d,
+    0x21, 0xff, 0xd8, 0x26, 0xbc, 0xd0, 0x3d, 0xef, 0xb9, 0x57, 0xa2, 0xf4, 0xc7, 0x71, 0xbb, 0xe2,
+    0x02, 0xee, 0x37, 0x82, 0x73, 0x18, 0xbe, 0x91, 0x82, 0xe0, 0x19, 0x71, 0xb4, 0x9d, 0x1a, 0x84,
+    0xb7, 0x58, 0x08, 0xf1, 0xcb, 0xb7, 0xd7, 0x97, 0x6f, 0x80, 0x9d, 0x9f, 0x1a, 0x7d, 0x0e, 0x63,
+    0x5c, 0xd1, 0xa3, 0x1e, 0x90, 0x7d, 0xf2, 0xdb, 0x9f, 0x8b, 0xee, 0x96, 0x52, 0x8f, 0xc7, 0x43,
+    0x3b, 0x3e, 0xd2, 0x75, 0x43, 0x57, 0x0f, 0xfa, 0x27, 0xba, 0x55, 0x56, 0x77, 0xad, 0x3d, 0x72,
+    0x27, 0x89, 0x5d, 0x0a, 0x7a, 0xb4, 0xb6, 0x3f, 0x2d, 0x14, 0xaf, 0x82, 0x59, 0xae, 0x90, 0x5d,
+    0x3d, 0x85, 0x22, 0xd6, 0xbb, 0x41, 0x61, 0x47, 0x9f, 0x92, 0x56, 0xd6, 0x3a, 0xe6, 0x35, 0xad,
+    0xbd, 0x33, 0x67, 0x55, 0xed, 0x79, 0xd7, 0x36, 0xc3, 0x4f, 0x03, 0x2d, 0x6a, 0x35, 0x42, 0xac,
+    0x09, 0x4e, 0x66, 0x4c, 0x41, 0x57, 0xcb, 0xed, 0x9e, 0x34, 0x24, 0x69, 0xb8, 0xb5, 0xef, 0x29,
+    0xdf, 0x44, 0xc9, 0x6d, 0x6e, 0x92, 0xc9, 0xc6, 0x49, 0x85, 0xda, 0x46, 0xb7, 0x66, 0xb7, 0x77,
+    0xa9, 0x19, 0xf1, 0x1d, 0xa2, 0x0c, 0x8c, 0xf3, 0xda, 0x91, 0x6e, 0xb5, 0x59, 0xb3, 0xd9, 0xc5,
+    0xe9, 0x8f, 0xdf, 0x3b, 0x01, 0x2e, 0xb9, 0xef, 0x1c, 0x7f, 0x8d, 0x21, 0x22, 0x82, 0xb2, 0xf2,
+    0x8a, 0x83, 0x01, 0x00, 0xaf, 0x1c, 0x8c, 0xfa, 0x34, 0x00, 0xb1, 0x62, 0x47, 0x80, 0xa0, 0x8a,
+    0x3f, 0x5e, 0x1e, 0x9f, 0xd4, 0xc1, 0xa9, 0xe2, 0x21, 0xd8, 0x1d, 0x5f, 0xb5, 0xcf, 0x58, 0xd5,
+    0x0d, 0x04, 0xdb, 0x3a, 0x6f, 0x55, 0x77, 0xf0, 0x75, 0x43, 0x18, 0x29, 0xed, 0xb8, 0xb8, 0x7d,
+    0xcf, 0xce, 0x19, 0x49, 0x95, 0xb0, 0x6f, 0x8b, 0x6c, 0x1c, 0x9f, 0x26, 0xbc, 0x19, 0x2e, 0x57,
+    0x60, 0x58, 0xe6, 0x78, 0xa0, 0x7a, 0x56, 0xd7, 0x67, 0xed, 0xea, 0x59, 0x6e, 0xf7, 0x7f, 0xf5,
+    0x54, 0x82, 0x85, 0x44, 0xf9, 0xf1, 0x75, 0x12, 0xdd, 0xd2, 0xa4, 0x2e, 0x57, 0xa5, 0xaa, 0x83,
+    0x01, 0x40, 0xaf, 0x70, 0x2f, 0x5d, 0x07, 0x12, 0x2b, 0x86, 0x00, 0x9c, 0x51, 0x8c, 0x48, 0x34,
+    0x00, 0xb1, 0x62, 0x08, 0xc0, 0x77, 0xd4, 0xbd, 0xd3, 0x02, 0xc4, 0x8a, 0x21, 0x00, 0x6f, 0xd2,
+    0x16, 0x2a, 0x62, 0xc5, 0x20, 0x1a, 0x6a, 0xd4, 0x3d, 0xaf, 0xf8, 0xc5, 0x74, 0x1d, 0x47, 0xfc,
+    0x52, 0x5d, 0xaf, 0xc0, 0x18, 0xae, 0xeb, 0x95, 0xad, 0x96, 0x0e, 0x4f, 0x5c, 0x34, 0xfb, 0xbf,
+    0xa6, 0x2b, 0x81, 0x02, 0x9a, 0x68, 0x05, 0x34, 0x2b, 0x3f, 0xd8, 0x1d, 0x9c, 0x4e, 0x3c, 0xb3,
+    0xf2, 0x01, 0xe0, 0x42, 0x8d, 0xcf, 0xcc, 0xca, 0x07, 0x80, 0x7b, 0x13, 0xb9, 0xc0, 0x04, 0x4b,
+    0x2c, 0x21, 0x40, 0x14, 0x4b, 0x00, 0xdf, 0x34, 0x4e, 0x74, 0xbe, 0xa2, 0xf6, 0x6c, 0xe8, 0xfc,
+    0x4b, 0x95, 0xa7, 0x0c, 0x62, 0x90, 0xee, 0xc8, 0xed, 0x53, 0xb9, 0x77, 0xaa, 0x3f, 0xa3, 0x90,
+    0x47, 0x07, 0x71, 0x22, 0x7e, 0x4f, 0xe9, 0xc2, 0x59, 0xfb, 0x8d, 0x4d, 0x28, 0xb9, 0x62, 0x5d,
+    0x44, 0x49, 0x70, 0x81, 0xe4, 0x94, 0x5d, 0xb8, 0x93, 0x00, 0xf1, 0x2d, 0xe6, 0xb5, 0xb5, 0x3d,
+    0x15, 0xe2, 0x2a, 0x94, 0xe6, 0x5c, 0xbd, 0x8e, 0xca, 0x5d, 0x35, 0x9b, 0xf7, 0x27, 0x51, 0x08,
+    0x41, 0x3c, 0xcf, 0xdb, 0x23, 0x25, 0x70, 0x17, 0x94, 0x04, 0x0e, 0x0b, 0x39, 0xfc, 0x57, 0xdb,
+    0xeb, 0x30, 0x0a, 0xac, 0x20, 0x5d, 0x2e, 0x38, 0x2b, 0x0e, 0x5b, 0x53, 0x4b, 0x83, 0x45, 0x34,
+    0xff, 0x8c, 0x8d, 0xa6, 0xe4, 0xad, 0x78, 0xb0, 0x16, 0xb0, 0xc2, 0x3c, 0x0b, 0x79, 0xc2, 0x68,
+    0x3a, 0xca, 0x30, 0xb4, 0xa8, 0x2a, 0xd0, 0x6d, 0x9d, 0x66, 0x53, 0x9e, 0x4e, 0x89, 0x09, 0xbc,
+    0x90, 0x5b, 0xdc, 0x1a, 0x61, 0x90, 0x03, 0xe5, 0x22, 0xd6, 0xb5, 0x94, 0x6f, 0x0a, 0x68, 0xdb,
+    0x3e, 0x69, 0x31, 0x0f, 0xb4, 0x14, 0xd9, 0x7e, 0x70, 0x0a, 0xd8, 0x86, 0x4b, 0xb6, 0x78, 0x18,
+    0xc9, 0x41, 0x35, 0x54, 0x3c, 0xf6, 0x3e, 0xaf, 0xa1, 0x17, 0xd2, 0xe9, 0xe6, 0xdd, 0x1b, 0x09,
+    0x03, 0xcf, 0x94, 0x50, 0x20, 0xe6, 0x4e, 0x0a, 0x02, 0x06, 0x0f, 0x62, 0x95, 0x1b, 0x53, 0x17,
+    0x96, 0x2e, 0xae, 0x60, 0x17, 0x99, 0x53, 0xa4, 0xae, 0xdc, 0x79, 0xe7, 0xd4, 0xab, 0x12, 0xd4,
+    0xa7, 0x1c, 0xb7, 0xeb, 0x01, 0x0b, 0xd3, 0xdc, 0x42, 0x27, 0x80, 0xd8, 0x4a, 0x28, 0x05, 0xc2,
+    0xc6, 0xbd, 0x62, 0x5c, 0x35, 0xd5, 0x60, 0xa9, 0x7d, 0xbe, 0x3a, 0xc8, 0xe0, 0x27, 0xce, 0x7b,
+    0x81, 0x44, 0x67, 0xd3, 0x0f, 0x64, 0x17, 0x37, 0x2b, 0x48, 0xd2, 0xb9, 0xd9, 0xb9, 0xe7, 0x91,
+    0xd9, 0x00, 0x3f, 0x5a, 0x8e, 0x0c, 0xa9, 0x68, 0xa8, 0xae, 0x82, 0x59, 0xfb, 0xc6, 0x9e, 0xe0,
+    0x9d, 0x86, 0x47, 0xe2, 0xb4, 0x09, 0x79, 0x20, 0x15, 0xfd, 0xea, 0xed, 0xec, 0x1a, 0x3c, 0xc3,
+    0x4f, 0x6b, 0x0a, 0x8c, 0xdb, 0x30, 0xbe, 0x22, 0x4e, 0x8c, 0xa7, 0x85, 0x09, 0xc3, 0x1d, 0x09,
+    0xcc, 0x5b, 0xc0, 0x63, 0x2b, 0xdc, 0x4a, 0xc1, 0xad, 0x77, 0x02, 0xbe, 0x46, 0x08, 0x83, 0xc6,
+    0x0d, 0x02, 0xf2, 0x7b, 0x9a, 0x39, 0x05, 0x94, 0xaf, 0x22, 0x6f, 0x9f, 0x98, 0x38, 0x92, 0xd9,
+    0xdc, 0xfd, 0x52, 0x43, 0xec, 0x93, 0x9f, 0x89, 0xa9, 0x0e, 0x80, 0x27, 0xd7, 0xa0, 0x57, 0x26,
+    0x74, 0x01, 0x54, 0x7c, 0xe6, 0x8a, 0x33, 0x45, 0x1b, 0xa7, 0x63, 0x92, 0xc7, 0x26, 0x00, 0xc4,
+    0x6b, 0x5f, 0xcc, 0xb6, 0x76, 0x44, 0xd7, 0xc7, 0xe9, 0x6e, 0x77, 0xb8, 0x9f, 0xbe, 0xbd, 0xbe,
+    0xbe, 0x22, 0x29, 0x77, 0xf8, 0x3a, 0x85, 0x55, 0x7f, 0xde, 0x56, 0x96, 0x3c, 0x7e, 0x6a, 0xdd,
+    0xb0, 0xea, 0xde, 0x5e, 0xcf, 0xd0, 0x0b, 0xf0, 0x20, 0x76, 0xd9, 0x82, 0x9d, 0x34, 0xce, 0xaa,
+    0x89, 0x66, 0x20, 0x60, 0xe7, 0x3b, 0x3a, 0x91, 0x8c, 0xcc, 0xac, 0x35, 0x5a, 0xae, 0x75, 0xb1,
+    0x9f, 0x74, 0x73, 0x21, 0xb9, 0x8a, 0xcf, 0x3e, 0x14, 0xa6, 0xca, 0x74, 0xa1, 0x45, 0x92, 0xaa,
+    0x48, 0x13, 0xb0, 0x7c, 0x96, 0x96, 0x32, 0xbd, 0xb5, 0xab, 0xd7, 0xd1, 0xd6, 0x50, 0x3d, 0xeb,
+    0x75, 0x2c, 0x36, 0x50, 0xe3, 0xb6, 0x9d, 0xa8, 0xe9, 0x8d, 0x23, 0x30, 0x6f, 0xab, 0x9b, 0xde,
+    0x75, 0x3f, 0xbe, 0xe1, 0x88, 0xd1, 0x08, 0x14, 0x6e, 0x9c, 0x98, 0xe4, 0x0f, 0xb2, 0xaf, 0xa5,
+    0x97, 0x87, 0x16, 0x87, 0xfc, 0x54, 0x19, 0x17, 0xca, 0xbb, 0xaa, 0x04, 0x97, 0x8b, 0xd0, 0xa3,
+    0xf7, 0xdb, 0x4e, 0x67, 0x1b, 0x8d, 0x4d, 0xbd, 0x77, 0x2f, 0x37, 0xbb, 0x49, 0xfc, 0x1e, 0x67,
+    0xd5, 0xd5, 0x0e, 0xdd, 0x60, 0x71, 0xbe, 0x38, 0x4d, 0xf0, 0xe1, 0x34, 0xe9, 0x03, 0xb6, 0xd2,
+    0x41, 0x0f, 0xdb, 0x93, 0xd1, 0xca, 0x79, 0x0d, 0x11, 0xcc, 0x77, 0xc9, 0xd2, 0x6d, 0x12, 0x67,
+    0x63, 0x2d, 0x41, 0xf1, 0x1c, 0xf7, 0x56, 0x64, 0xda, 0x44, 0x0b, 0x70, 0x77, 0xcc, 0xf1, 0x3d,
+    0x27, 0x64, 0xd4, 0x77, 0x02, 0xf8, 0xd1, 0x95, 0x89, 0x3e, 0xeb, 0xb9, 0xc5, 0x22, 0x3b, 0xa1,
+    0x8b, 0xd4, 0x46, 0xeb, 0x98, 0xda, 0x18, 0x84, 0xd8, 0x60, 0x95, 0xd1, 0xed, 0xda, 0x10, 0x81,
+    0xd0, 0x1f, 0x33, 0x64, 0xed, 0xc6, 0xc3, 0x04, 0x93, 0x0d, 0x44, 0x88, 0x6f, 0xd4, 0x8c, 0x3f,
+    0x7a, 0xd2, 0xf2, 0x24, 0x01, 0xdd, 0x0f, 0x1f, 0x6b, 0x6d, 0x1a, 0x3c, 0xeb, 0x3a, 0x22, 0xef,
+    0x91, 0x84, 0xd2, 0x27, 0xc8, 0x2b, 0xe8, 0xca, 0x0a, 0x42, 0x6a, 0xa5, 0x42, 0x06, 0xea, 0x16,
+    0x04, 0x22, 0x01, 0x08, 0xe8, 0xbf, 0xff, 0xdd, 0xc6, 0x88, 0x03, 0x4d, 0xaa, 0x42, 0x2b, 0x38,
+    0x18, 0x8c, 0xb5, 0xf6, 0x13, 0xfe, 0x21, 0xab, 0x6e, 0x33, 0x20, 0x52, 0x75, 0x8d, 0x2b, 0x9f,
+    0x42, 0x8c, 0x83, 0xb9, 0x36, 0x77, 0xcc, 0xa3, 0xc4, 0x21, 0x00, 0x9e, 0x79, 0x32, 0x8c, 0x84,
+    0x70, 0xc8, 0x32, 0x3a, 0x97, 0x67, 0x3a, 0x9b, 0xa3, 0x33, 0xf8, 0xf2, 0x9c, 0x43, 0x38, 0x70,
+    0x35, 0x27, 0x89, 0xbe, 0x18, 0xe7, 0x99, 0xd6, 0xb6, 0x8d, 0xf2, 0x09, 0x68, 0xc7, 0xef, 0xbb,
+    0x38, 0xed, 0xb9, 0x40, 0xad, 0x2f, 0x25, 0x72, 0x34, 0x51, 0x30, 0xdb, 0x96, 0xa8, 0xbb, 0x2c,
+    0x53, 0x5b, 0x56, 0x4e, 0x7d, 0x97, 0xab, 0xf9, 0x34, 0x8e, 0x93, 0xc4, 0x79, 0xb0, 0x58, 0x2a,
+    0x7e, 0x45, 0x27, 0x29, 0x53, 0x18, 0x9b, 0xfb, 0x34, 0x5c, 0x82, 0xd7, 0x44, 0xff, 0xf1, 0xa2,
+    0xeb, 0x2c, 0x59, 0x7f, 0x48, 0x5f, 0x9e, 0x31, 0xe6, 0x91, 0xd1, 0x20, 0xe6, 0x0f, 0x98, 0x6a,
+    0xc5, 0x42, 0x21, 0x13, 0x5d, 0x54, 0x78, 0x6c, 0xad, 0xa9, 0xe9, 0x2e, 0xe2, 0xd9, 0x0e, 0x46,
+    0x25, 0x13, 0x9e, 0x97, 0xfa, 0xc8, 0x29, 0xee, 0x46, 0xcf, 0x5e, 0xab, 0xd1, 0xed, 0x2b, 0xd2,
+    0x8a, 0x0c, 0x6c, 0x5b, 0x92, 0x96, 0xbc, 0xa1, 0xf4, 0x9a, 0x5b, 0x7d, 0x5f, 0xef, 0x34, 0xad,
+    0xdc, 0x62, 0xe9, 0xc8, 0x83, 0xb8, 0xe9, 0xd3, 0x9c, 0x34, 0x8e, 0xa1, 0x72, 0xde, 0x66, 0x9a,
+    0x07, 0x3d, 0x7b, 0xc9, 0xb3, 0x31, 0x35, 0x3a, 0xf6, 0x14, 0xb9, 0x9e, 0xe6, 0x41, 0x53, 0xd5,
+    0x85, 0x19, 0xcf, 0x32, 0x06, 0x47, 0x8b, 0xcd, 0x9e, 0x54, 0xf3, 0xee, 0x83, 0xc4, 0x93, 0x84,
+    0x62, 0xe0, 0xe7, 0x88, 0x84, 0x62, 0xe9, 0xf1, 0x00, 0x04, 0xa1, 0x4e, 0x59, 0x0f, 0x31, 0x39,
+    0xb5, 0x23, 0x69, 0x03, 0xab, 0x4f, 0xd9, 0x5d, 0xd9, 0x55, 0xba, 0x02, 0xac, 0xf2, 0x96, 0x23,
+    0xd3, 0x63, 0x77, 0xad, 0x39, 0x7a, 0xb2, 0xb3, 0x4c, 0xba, 0xc3, 0x53, 0x07, 0x9c, 0x63, 0x25,
+    0x2d, 0x56, 0x37, 0xd7, 0x62, 0x70, 0x91, 0x71, 0x78, 0xe6, 0x77, 0x0c, 0xbe, 0xfa, 0xa6, 0x6d,
+    0x6c, 0xd5, 0x57, 0x84, 0xdb, 0x2a, 0xb0, 0xc1, 0xb3, 0xd0, 0x6b, 0x2c, 0xc6, 0x03, 0xbb, 0xc5,
+    0xc6, 0x12, 0xcf, 0xa8, 0xe4, 0xe6, 0xf7, 0xf6, 0xb1, 0xf9, 0xf8, 0xa9, 0x7b, 0x12, 0xb0, 0xfc,
+    0xa0, 0xa1, 0x77, 0xb2, 0x62, 0xbe, 0x37, 0x52, 0xc0, 0xc7, 0x2d, 0xd8, 0x8b, 0x98, 0x73, 0x63,
+    0x5d, 0x04, 0x28, 0x9c, 0x5b, 0xd4, 0x84, 0x63, 0x66, 0x70, 0xe7, 0x1c, 0xa1, 0xbe, 0xcb, 0x44,
+    0x88, 0xee, 0x56, 0x9a, 0xb8, 0xe8, 0x27, 0xd5, 0xa0, 0x62, 0x52, 0x59, 0xf0, 0x51, 0x0e, 0x28,
+    0x30, 0xf8, 0x60, 0xd8, 0xc2, 0x86, 0x85, 0x62, 0x64, 0x7d, 0x8e, 0x97, 0xe6, 0x36, 0xc8, 0x8e,
+    0xcf, 0x25, 0xe4, 0x82, 0x5c, 0xb9, 0x49, 0x13, 0x83, 0x6d, 0x85, 0xd0, 0x2a, 0xe6, 0x7d, 0xba,
+    0xc9, 0x5c, 0x67, 0xec, 0x85, 0x99, 0xce, 0xc4, 0x59, 0xf3, 0xa8, 0x77, 0xcf, 0xfb, 0xf7, 0x98,
+    0x5e, 0x8d, 0x7d, 0xff, 0xfc, 0xc7, 0xf8, 0xde, 0x3c, 0x10, 0x19, 0xb0, 0x10, 0xf7, 0x40, 0x0d,
+    0x11, 0x99, 0xd7, 0x7d, 0xe1, 0x7c, 0x4b, 0xd9, 0x72, 0xc5, 0xf5, 0x80, 0x56, 0xa2, 0xae, 0x1d,
+    0x92, 0x46, 0x7c, 0x04, 0xf4, 0xd6, 0x24, 0xa0, 0x0e, 0x85, 0xf0, 0xe8, 0x5d, 0xa7, 0xa8, 0xc4,
+    0x6d, 0x82, 0x22, 0x3a, 0xd6, 0x75, 0xa1, 0x72, 0xd4, 0x0e, 0x0c, 0xce, 0xdf, 0x07, 0xe9, 0x84,
+    0x18, 0x62, 0xdc, 0xa9, 0xcf, 0xc0, 0xbc, 0x15, 0xd8, 0xb0, 0x41, 0x33, 0xc8, 0xfa, 0xd6, 0x27,
+    0x71, 0x2c, 0xca, 0xd5, 0x0c, 0xe4, 0xcb, 0x20, 0xf4, 0x33, 0xf8, 0xdd, 0x33, 0x60, 0x22, 0xc7,
+    0x62, 0x08, 0xfe, 0xb2, 0x67, 0x1d, 0x7b, 0x4c, 0x18, 0x50, 0xb8, 0xe3, 0xe3, 0x20, 0xcc, 0x25,
+    0xe4, 0x6e, 0xbc, 0x55, 0x4e, 0xc2, 0x30, 0xd4, 0xf3, 0xce, 0x75, 0xec, 0x4b, 0xf9, 0x0f, 0x30,
+    0x81, 0x2c, 0xcf, 0x7f, 0xc8, 0x1c, 0xf2, 0x21, 0xba, 0xa7, 0xe1, 0xae, 0xa2, 0x28, 0xa5, 0xaf,
+    0x79, 0xd8, 0x31, 0x8d, 0xf9, 0x9a, 0xf3, 0x28, 0x6c, 0x9b, 0x4b, 0x0e, 0xa1, 0x36, 0x17, 0xf3,
+    0x44, 0x54, 0x88, 0x0c, 0x74, 0x92, 0xd9, 0x37, 0x73, 0x1b, 0x8c, 0x3e, 0x29, 0xf9, 0xe3, 0x6d,
+    0x91, 0x27, 0x90, 0x0e, 0xf7, 0x47, 0x81, 0x6c, 0xf8, 0x78, 0x79, 0xfa, 0xa7, 0x6d, 0x21, 0xa6,
+    0x0a, 0x87, 0x64, 0x06, 0x35, 0x04, 0xd7, 0xb9, 0x2f, 0xc7, 0x3d, 0xe4, 0x07, 0x0c, 0x31, 0x55,
+    0x64, 0x69, 0x91, 0x4b, 0x96, 0xa6, 0x18, 0x72, 0xe1, 0x00, 0xa0, 0x18, 0x00, 0xdc, 0xea, 0xf2,
+    0x25, 0x5d, 0x0b, 0x90, 0xed, 0x21, 0x69, 0x96, 0xdc, 0x2d, 0xb1, 0x11, 0x4b, 0x93, 0x91, 0x9c,
+    0xdc, 0x1e, 0x51, 0x33, 0xeb, 0x17, 0xa9, 0x75, 0x49, 0x4a, 0x4e, 0xfc, 0x36, 0x49, 0xd1, 0x87,
+    0x5a, 0x15, 0x85, 0x91, 0x60, 0xb7, 0x9c, 0x63, 0x68, 0x8c, 0x71, 0xed, 0x3c, 0xa3, 0x3a, 0x53,
+    0xb1, 0xe3, 0x19, 0x78, 0x5a, 0xee, 0xe5, 0x7b, 0xa2, 0xbf, 0xc8, 0x9a, 0x6b, 0xc0, 0xa1, 0xa0,
+    0x6e, 0xc5, 0x05, 0x5e, 0x7a, 0x3e, 0x68, 0xc5, 0x85, 0x1d, 0xb7, 0xaf, 0x0f, 0xb8, 0x48, 0x55,
+    0xce, 0x4e, 0x66, 0xe0, 0x71, 0xf4, 0x01, 0x3b, 0x7e, 0xdc, 0x23, 0x46, 0xc6, 0x42, 0x6b, 0xce,
+    0x42, 0x63, 0x8f, 0xfc, 0x2c, 0x8e, 0x56, 0xf6, 0x89, 0x51, 0xde, 0x01, 0x8e, 0x40, 0xf4, 0xf9,
+    0x24, 0xe5, 0xa0, 0xfc, 0x81, 0xd1, 0x2a, 0x41, 0xca, 0x7c, 0xb1, 0xc5, 0xc3, 0x71, 0xe8, 0xdd,
+    0xc4, 0x98, 0xfb, 0x9e, 0x71, 0x4d, 0xdc, 0x66, 0x90, 0x1c, 0xfb, 0xaf, 0xae, 0x82, 0x76, 0x58,
+    0x00, 0x15, 0x8b, 0x69, 0x2f, 0xda, 0x84, 0x38, 0x99, 0x02, 0xca, 0xf0, 0x65, 0x51, 0x8b, 0x8c,
+    0x77, 0x93, 0x8d, 0xde, 0xc7, 0xc2, 0xf8, 0xb4, 0x98, 0x2b, 0xc9, 0xe0, 0x44, 0xec, 0xe6, 0x97,
+    0x58, 0xfc, 0x4e, 0x14, 0x8c, 0xb4, 0xbb, 0xe4, 0x58, 0x63, 0x45, 0x72, 0x56, 0xd3, 0xbe, 0x57,
+    0x9a, 0x54, 0x5c, 0x81, 0x6b, 0xf6, 0xd7, 0xeb, 0xc5, 0x42, 0x0c, 0x56, 0x39, 0x17, 0x04, 0x69,
+    0x5e, 0xfb, 0xbc, 0xeb, 0x06, 0x12, 0x08, 0x00, 0x74, 0x3a, 0x11, 0x37, 0xdc, 0xbe, 0x9b, 0xa1,
+    0x95, 0x1a, 0xe5, 0x2f, 0x3e, 0x9b, 0x5b, 0xef, 0xa3, 0xc4, 0x93, 0x9b, 0x03, 0xd2, 0xd1, 0x8c,
+    0x4a, 0xa3, 0x8d, 0xc7, 0x16, 0x8f, 0x66, 0xe2, 0x28, 0x6c, 0xd4, 0xb5, 0x18, 0xc0, 0x31, 0x9e,
+    0x4f, 0xa7, 0xdb, 0xa8, 0x56, 0x63, 0x37, 0xb4, 0x02, 0x4b, 0x93, 0xae, 0x48, 0xc0, 0x52, 0x91,
+    0x25, 0xff, 0x3c, 0xf7, 0x4c, 0x68, 0xe4, 0xf1, 0xf0, 0x71, 0x1d, 0xa3, 0x03, 0x00, 0xb1, 0xe2,
+    0x4e, 0x00, 0x81, 0x1b, 0xf5, 0xac, 0xed, 0x1a, 0xbe, 0x53, 0xdc, 0xb9, 0x6e, 0x32, 0x5f, 0x67,
+    0x37, 0x5b, 0x19, 0x8a, 0x3f, 0xc7, 0x72, 0x53, 0x45, 0x92, 0x4c, 0x07, 0xa2, 0x4d, 0x04, 0x75,
+    0x83, 0xb7, 0x0a, 0x5b, 0xdb, 0x59, 0xaf, 0x06, 0xdd, 0xfc, 0xd0, 0x55, 0x7a, 0x05, 0x75, 0xe1,
+    0x69, 0x8f, 0x28, 0xd4, 0x1a, 0xed, 0xf1, 0x02, 0xd2, 0xfd, 0x2a, 0x13, 0xe4, 0x7f, 0x5c, 0xbe,
+    0xf9, 0x16, 0x96, 0x56, 0xef, 0xe4, 0x31, 0x99, 0x0e, 0x3e, 0xb4, 0xb5, 0x20, 0x8e, 0x0e, 0x47,
+    0xea, 0x98, 0x8b, 0x98, 0xb6, 0x3c, 0x84, 0x99, 0x64, 0xea, 0x0a, 0x65, 0x3c, 0x59, 0x6b, 0x07,
+    0x13, 0x9d, 0x9b, 0x6a, 0x30, 0xee, 0x48, 0x12, 0xc1, 0x2e, 0xea, 0x4c, 0x0a, 0xf7, 0xa8, 0x5e,
+    0xbd, 0x78, 0xd1, 0x43, 0xba, 0xde, 0x5e, 0x1f, 0x67, 0x47, 0x43, 0xe9, 0xda, 0xc5, 0x2b, 0x80,
+    0x8b, 0xb5, 0xff, 0xbc, 0xf5, 0x6e, 0xc2, 0xb6, 0xab, 0x0f, 0x4d, 0xa8, 0x0b, 0x61, 0xad, 0x9e,
+    0xef, 0x70, 0xdb, 0x41, 0x4f, 0xc9, 0x14, 0x59, 0x94, 0xb1, 0x6c, 0xdc, 0x7a, 0x9d, 0xa7, 0x4c,
+    0xcb, 0x9c, 0x6c, 0x09, 0x9d, 0x47, 0x11, 0x3f, 0x9b, 0x5d, 0x35, 0xe8, 0xb7, 0x0b, 0x4f, 0x0b,
+    0x7e, 0xfe, 0xf5, 0x4c, 0xb2, 0x13, 0x7c, 0xe4, 0x86, 0xce, 0xdd, 0x89, 0x84, 0x5f, 0x70, 0x73,
+    0x20, 0x23, 0x77, 0x63, 0xa2, 0x22, 0xf5, 0x3b, 0x31, 0x36, 0x98, 0x1e, 0xcb, 0xd2, 0x27, 0x65,
+    0x74, 0xb1, 0xac, 0x02, 0xa3, 0x8b, 0x55, 0xb5, 0xb3, 0xae, 0xe6, 0x14, 0x05, 0x7b, 0xb6, 0xe4,
+    0x7f, 0xe0, 0x0d, 0x38, 0x7d, 0xbe, 0xd4, 0x57, 0xbb, 0xfd, 0x96, 0xf1, 0x78, 0xf0, 0x85, 0xc7,
+    0x2f, 0xbc, 0xcf, 0x58, 0x3f, 0x69, 0x3f, 0x0b, 0xc5, 0xa5, 0x4e, 0xb1, 0x55, 0x8f, 0x47, 0x65,
+    0xb8, 0x13, 0x87, 0x51, 0xb9, 0x17, 0x51, 0x19, 0x9c, 0xc9, 0x83, 0x14, 0x12, 0x80, 0xbb, 0x62,
+    0x31, 0x5e, 0xb4, 0x65, 0x41, 0xed, 0x9a, 0xed, 0x17, 0xdf, 0x83, 0x7c, 0x8a, 0x8b, 0x8e, 0x25,
+    0xf6, 0x6e, 0x58, 0x08, 0x71, 0x48, 0x21, 0xe3, 0xc8, 0xe5, 0x83, 0xec, 0x02, 0xba, 0xba, 0x10,
+    0xfe, 0xec, 0xd0, 0x96, 0x9f, 0x3b, 0x78, 0x76, 0x88, 0x47, 0xf3, 0xea, 0xba, 0xf8, 0xea, 0xa5,
+    0xee, 0x93, 0x02, 0xd0, 0xf4, 0xa5, 0x6a, 0x10, 0x1f, 0x5d, 0xe3, 0x42, 0x0c, 0xfe, 0x6d, 0xf0,
+    0x92, 0x2c, 0xd9, 0xe0, 0xb5, 0x56, 0xbc, 0x9f, 0x87, 0x74, 0x07, 0xe1, 0xf5, 0xb3, 0xbb, 0x1c,
+    0x6e, 0x19, 0x40, 0x9a, 0xa7, 0xdc, 0x1f, 0xca, 0x55, 0x20, 0x89, 0x42, 0xb1, 0x20, 0x9b, 0x1a,
+    0x0a, 0x57, 0xbc, 0xc0, 0x88, 0x2d, 0x2d, 0xf1, 0x25, 0x04, 0xd3, 0xce, 0xaf, 0x2e, 0x9a, 0xc6,
+    0xd1, 0x6b, 0xc7, 0xbd, 0xc5, 0xd8, 0x2a, 0xbf, 0x1c, 0x79, 0x68, 0x4b, 0x28, 0x47, 0x87, 0xf3,
+    0xe4, 0x48, 0x4e, 0xfb, 0xf0, 0xf9, 0x64, 0x22, 0xf3, 0x86, 0x33, 0x99, 0x23, 0x27, 0x78, 0x63,
+    0x7c, 0x32, 0x51, 0xe3, 0x7a, 0xec, 0x8e, 0x88, 0xed, 0xce, 0xa9, 0xe1, 0x52, 0xfc, 0x42, 0xc2,
+    0x24, 0xdf, 0x7c, 0x35, 0x8a, 0xdb, 0x00, 0x95, 0x66, 0xd8, 0xdf, 0x8d, 0x7c, 0xdf, 0x89, 0x53,
+    0x36, 0xf7, 0xa9, 0x51, 0x20, 0x2d, 0xaf, 0x28, 0xe3, 0x00, 0x6a, 0xa1, 0x3a, 0xc2, 0xe5, 0xe9,
+    0xd8, 0xa8, 0x5e, 0x2b, 0x38, 0x5c, 0xbd, 0x2a, 0xc3, 0x92, 0x17, 0xcc, 0x8d, 0xa3, 0x0a, 0x96,
+    0x40, 0xda, 0x57, 0xb5, 0x5e, 0x35, 0x14, 0x26, 0xea, 0xab, 0x13, 0x86, 0xe6, 0xa6, 0x83, 0x10,
+    0x58, 0xe6, 0x21, 0x15, 0xe5, 0xb1, 0x3f, 0xe2, 0x28, 0x45, 0x66, 0x6a, 0x68, 0x72, 0xbb, 0x4a,
+    0x53, 0x68, 0xb9, 0x12, 0xae, 0x19, 0x45, 0x8c, 0xe4, 0x3b, 0x73, 0xea, 0xa3, 0x6e, 0x4c, 0x8d,
+    0x3c, 0x3f, 0xdf, 0x38, 0xc2, 0x47, 0x5b, 0xcc, 0x07, 0xdf, 0xf7, 0x0f, 0x6d, 0xd1, 0xac, 0x05,
+    0x04, 0x13, 0xca, 0x5e, 0x7c, 0xf9, 0xc2, 0x10, 0x98, 0x17, 0xd0, 0xe4, 0xe7, 0x36, 0xca, 0x05,
+    0x98, 0xf0, 0xc2, 0x20, 0x76, 0x92, 0x7c, 0xee, 0x85, 0x17, 0x66, 0x18, 0x96, 0xf1, 0xc2, 0x77,
+    0x58, 0x73, 0x79, 0x3b, 0xe0, 0x16, 0xab, 0x2e, 0x25, 0xfc, 0x04, 0xd4, 0x32, 0x7e, 0x72, 0x98,
+    0x5e, 0x68, 0xa9, 0xeb, 0x02, 0x06, 0x2a, 0x16, 0x81, 0x07, 0x72, 0xec, 0x79, 0x10, 0xfc, 0xa6,
+    0x83, 0xa8, 0x95, 0x01, 0x53, 0xb8, 0xe4, 0xaf, 0x18, 0xcd, 0xe1, 0xb7, 0x00, 0x76, 0xa0, 0x94,
+    0xba, 0x6f, 0x60, 0x1c, 0x1d, 0x5f, 0x11, 0x2c, 0xf8, 0x42, 0x16, 0x66, 0xe0, 0xca, 0x54, 0xca,
+    0x87, 0xd8, 0x09, 0x2b, 0x49, 0xdb, 0x0c, 0xab, 0xa7, 0x61, 0x60, 0x06, 0xb6, 0x86, 0xdd, 0x36,
+    0x36, 0x2a, 0x63, 0x25, 0xc1, 0x4a, 0xbd, 0x02, 0xe1, 0xc2, 0x8c, 0x8f, 0x9a, 0x12, 0x97, 0xed,
+    0x51, 0x03, 0x8a, 0x8d, 0x6a, 0x5a, 0x53, 0x72, 0x1b, 0xb4, 0xbc, 0x64, 0x76, 0x8a, 0x57, 0xf5,
+    0x58, 0x18, 0x35, 0x91, 0x20, 0xfd, 0xab, 0x37, 0x6a, 0x15, 0x2c, 0x9f, 0xc8, 0xa8, 0x65, 0xe9,
+    0x46, 0xbf, 0x84, 0x51, 0x2b, 0xdd, 0x69, 0x50, 0x93, 0x91, 0x2f, 0x83, 0x14, 0xa2, 0x0c, 0x4c,
+    0x49, 0x5c, 0xa5, 0x68, 0x37, 0xbb, 0x96, 0xdf, 0x8d, 0x50, 0x88, 0xe1, 0xe3, 0x0e, 0x68, 0x85,
+    0xeb, 0x60, 0x8e, 0x83, 0xe6, 0x88, 0x09, 0x50, 0x65, 0xb4, 0x64, 0xc1, 0x00, 0xa4, 0xf0, 0x7e,
+    0x45, 0xce, 0xfa, 0xd0, 0x23, 0xd7, 0x51, 0xcc, 0xdc, 0xe1, 0x14, 0x13, 0xe0, 0xca, 0x88, 0xc9,
+    0x82, 0x01, 0x88, 0xe1, 0x3d, 0x0d, 0x85, 0x18, 0x3c, 0x52, 0x06, 0x0a, 0xfb, 0x85, 0xb8, 0x09,
+    0x88, 0x65, 0xdc, 0x64, 0xc1, 0x00, 0xdc, 0x30, 0xa5, 0x5e, 0xe1, 0x86, 0x8f, 0xc3, 0x51, 0x12,
+    0x80, 0xca, 0x28, 0x49, 0xc8, 0x3b, 0xc8, 0x94, 0xb0, 0x7e, 0x52, 0xa6, 0xbe, 0xd4, 0xca, 0x16,
+    0x00, 0x2b, 0x92, 0x35, 0xd8, 0xbe, 0xd6, 0xec, 0x89, 0xb2, 0xaf, 0x4f, 0x6d, 0x5b, 0x61, 0x89,
+    0xf2, 0x3f, 0x10, 0x2f, 0x96, 0x90, 0x7c, 0xaa, 0x70, 0x51, 0xe6, 0x5a, 0xfe, 0x12, 0x86, 0x35,
+    0xbb, 0x45, 0x22, 0xe7, 0x31, 0x58, 0xe2, 0x73, 0x30, 0x4a, 0xbc, 0x8a, 0xf7, 0xdd, 0x54, 0x30,
+    0xbb, 0x85, 0x22, 0xd1, 0xf9, 0x62, 0xb1, 0xcf, 0xc1, 0x95, 0xd0, 0x92, 0xef, 0xbb, 0xa3, 0x15,
+    0x8a, 0x50, 0x09, 0xd1, 0x1a, 0x1c, 0x89, 0xe5, 0x60, 0x4a, 0xe8, 0x84, 0xfd, 0x23, 0xb0, 0xec,
+    0xee, 0x81, 0xc4, 0x02, 0x9f, 0x76, 0xc0, 0x42, 0xdc, 0x56, 0x98, 0x47, 0xf7, 0x05, 0x26, 0x02,
+    0x54, 0x09, 0x13, 0xf9, 0xae, 0x64, 0xd5, 0xc7, 0x6d, 0xe0, 0x49, 0xde, 0x69, 0x58, 0x10, 0x56,
+    0xd1, 0x8c, 0xaf, 0x60, 0x23, 0x7e, 0x3d, 0x46, 0x40, 0x7d, 0x8e, 0x01, 0xcf, 0xa2, 0x93, 0x20,
+    0x5b, 0x94, 0xf7, 0x35, 0x05, 0x82, 0x23, 0xc5, 0x27, 0x0b, 0x8c, 0xc1, 0xf6, 0x12, 0x37, 0x11,
+    0xd5, 0x57, 0x10, 0xee, 0x98, 0x23, 0x4e, 0x0e, 0x88, 0x3c, 0x85, 0xf8, 0xd5, 0x5a, 0xcf, 0x76,
+    0x94, 0x9f, 0xc8, 0x96, 0x46, 0xdc, 0x41, 0xa0, 0x99, 0x3d, 0x1d, 0x66, 0x30, 0xcb, 0x8a, 0x84,
+    0xfb, 0x5b, 0x92, 0x65, 0xf2, 0x49, 0x2a, 0x90, 0x7c, 0x76, 0x5c, 0x97, 0xc6, 0x60, 0xad, 0xc5,
+    0x01, 0x5c, 0x5f, 0x9d, 0x91, 0x2f, 0x25, 0xe4, 0xb6, 0x6c, 0xb7, 0x59, 0xa2, 0x19, 0x22, 0xab,
+    0x78, 0x9b, 0x6d, 0xf4, 0x7f, 0x35, 0x3f, 0x5c, 0x63, 0x12, 0x6e, 0xbf, 0xfd, 0x0f, 0xc8, 0x93,
+    0xb8, 0x9c, 0x91, 0x1f, 0xfc, 0xe0, 0x9e, 0xdd, 0x13, 0x89, 0x54, 0x23, 0xbd, 0xfb, 0x49, 0x3c,
+    0x71, 0x3d, 0xb9, 0xda, 0x38, 0x2a, 0xd2, 0xc5, 0xf2, 0xd4, 0x64, 0xa4, 0xfd, 0x20, 0xd7, 0xd3,
+    0x80, 0x9e, 0xcb, 0x6d, 0xad, 0xbc, 0xf5, 0xa0, 0x22, 0xf6, 0x1d, 0x97, 0xae, 0x22, 0xdf, 0xa3,
+    0x49, 0xf1, 0x3d, 0x4c, 0x7a, 0xef, 0x04, 0xb1, 0x2f, 0x3f, 0x83, 0xa9, 0xc9, 0x9d, 0xdf, 0xd5,
+    0x6d, 0xbc, 0x29, 0x8b, 0x33, 0x79, 0x1b, 0xab, 0xcd, 0xc9, 0x5d, 0xc4, 0x3a, 0xe7, 0x6a, 0x79,
+    0xd6, 0x95, 0x9c, 0x06, 0x83, 0x88, 0xfc, 0x34, 0xd0, 0x33, 0xf5, 0xa9, 0xd0, 0x30, 0x0a, 0xe9,
+    0x41, 0xf9, 0xe3, 0xa0, 0xe2, 0xeb, 0xa6, 0xf8, 0xad, 0xce, 0x8a, 0x86, 0xec, 0xa0, 0x34, 0x8b,
+    0x28, 0x02, 0x25, 0x28, 0xb5, 0xeb, 0xb7, 0xad, 0xda, 0x6f, 0x57, 0xb5, 0x80, 0xea, 0xa8, 0x0f,
+    0xd3, 0xb6, 0x64, 0x2c, 0xe6, 0x13, 0x55, 0xdf, 0x8d, 0xdd, 0xac, 0x18, 0xa7, 0x30, 0xaf, 0x93,
+    0xc8, 0xa3, 0x64, 0xfe, 0xb0, 0x0f, 0xb0, 0xb1, 0xfd, 0x71, 0xd6, 0xfe, 0xd0, 0x76, 0x9a, 0x28,
+    0x2b, 0x10, 0x73, 0x40, 0x67, 0x99, 0xe0, 0xc7, 0x85, 0x26, 0x12, 0x5a, 0x94, 0xe0, 0x96, 0xf2,
+    0x41, 0x49, 0xf4, 0x4b, 0x67, 0x46, 0xc6, 0x91, 0x3a, 0x20, 0x81, 0xb7, 0x2a, 0xde, 0xc8, 0x32,
+    0x49, 0x1b, 0x28, 0x17, 0x1b, 0xdb, 0xb8, 0xd3, 0x8d, 0x5f, 0xfc, 0xfd, 0x0f, 0x8c, 0xff, 0x00,
+    0xf5, 0x01, 0x58, 0x00, 0x00,
+};
+
+static const ESPWebCAsset ESPWEBC_ASSETS[] = {
+    {"/dashboard.html", "text/html", ESPWEBC_ASSET_0, sizeof(ESPWEBC_ASSET_0), "\"33171b5d9c8c04fe\""},
+    {"/dash.js", "text/javascript", ESPWEBC_ASSET_1, sizeof(ESPWEBC_ASSET_1), "\"568f310654731a8c\""},
+    {"/style.css", "text/css", ESPWEBC_ASSET_2, sizeof(ESPWEBC_ASSET_2), "\"8f51d462c4af6409\""},
+    {"/espwebc.html", "text/html", ESPWEBC_ASSET_3, sizeof(ESPWEBC_ASSET_3), "\"8352f01b31955e2c\""},
+};
+
+#endif // ESPWEBC_ASSETS_H
@@ -0,0 +1,64 @@
+#include "ESPWebCCache.h"
+
+ESPWebCCache::ESPWebCCache() : lock(xSemaphoreCreateMutex())
+{
+    setSlots(1);
+}
+
+void ESPWebCCache::setSlots(size_t count)
+{
+    if (count == slots.size())
+    {
+        return;
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    for (size_t i = count; i < slots.size(); i++)
+    {
+        free(slots[i].buffer);
+    }
+    slots.resize(count, Slot());
+    xSemaphoreGive(lock);
+}
+
+size_t ESPWebCCache::capacity() const
+{
+    size_t total = 0;
+    for (const Slot &text : slots)
+    {
+        total += text.size;
+    }
+    return total;
+}
+
+size_t ESPWebCCache::write(uint8_t c)
+{
+    return write(&c, 1);
+}
+
+size_t ESPWebCCache::write(const uint8_t *data, size_t len)
+{
+    Slot *text = current;
+    if (text == nullptr)
+    {
+        return 0;
+    }
+    if (text->used + len > text->size)
+    {
+        size_t grown = text->size ? text->size : 512;
+        while (grown < text->used + len)
+        {
+            grown *= 2;
+        }
+        char *bigger = (char *)realloc(text->buffer, grown);
+        if (bigger == nullptr)
+        {
+            good = false;
+            return 0;
+        }
+        text->buffer = bigger;
+        text->size = grown;
+    }
+    memcpy(text->buffer + text->used, data, len);
+    text->used += len;
+    return len;
+}
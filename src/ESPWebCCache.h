@@ -0,0 +1,96 @@
+#ifndef ESPWEBC_CACHE_H
+#define ESPWEBC_CACHE_H
+
+#include <Arduino.h>
+#include <vector>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+// Last encoded readings, shared by the pollers, the SSE listeners and the
+// WebSocket pushes. The text is rebuilt when it is older than the TTL or its
+// key (the snapshot and widgets versions) changed, so serializing costs the
+// same with one client or twenty. Each slot keeps its own text, so pages
+// polled side by side do not evict each other. A buffer grows to the
+// largest text of its slot and is then reused.
+
+class ESPWebCCache : public Print
+{
+public:
+    ESPWebCCache();
+
+    // Independent texts sharing the lock and invalidate(), eg: one per page.
+    // Only called while widgets are registered.
+    void setSlots(size_t count);
+
+    // Calls use(data, length) with the text of a slot no older than ttlMs,
+    // refreshing it first with fill(Print &) when needed. The lock is held
+    // during both, use() should only copy. False when fill() failed.
+    template <typename Fill, typename Use>
+    bool get(size_t slot, uint32_t key, unsigned long ttlMs, Fill fill, Use use)
+    {
+        xSemaphoreTake(lock, portMAX_DELAY);
+        if (slot >= slots.size())
+        {
+            xSemaphoreGive(lock);
+            return false;
+        }
+        Slot &text = slots[slot];
+        uint32_t now = millis();
+        uint32_t generation = invalidations;
+        bool ok = true;
+        if (!text.valid || key != text.key || generation != text.generation || now - text.filled >= ttlMs)
+        {
+            misses++;
+            current = &text;
+            text.used = 0;
+            good = true;
+            ok = fill(*static_cast<Print *>(this)) && good;
+            current = nullptr;
+            text.valid = ok;
+            text.key = key;
+            text.generation = generation; // a change during fill() is seen next time
+            text.filled = now;
+        }
+        else
+        {
+            hits++;
+        }
+        if (ok)
+        {
+            use((const char *)text.buffer, text.used);
+        }
+        xSemaphoreGive(lock);
+        return ok;
+    }
+
+    // A value changed outside commit(), eg: a switch from the dashboard
+    void invalidate() { invalidations++; }
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *data, size_t len) override;
+    using Print::write;
+
+    size_t capacity() const; // bytes held by every slot
+    volatile uint32_t hits = 0;
+    volatile uint32_t misses = 0;
+
+private:
+    struct Slot
+    {
+        char *buffer;
+        size_t size;
+        size_t used;
+        bool valid;
+        uint32_t key;
+        uint32_t generation;
+        uint32_t filled;
+    };
+
+    std::vector<Slot> slots;
+    Slot *current = nullptr; // being filled
+    bool good = true;
+    volatile uint32_t invalidations = 0;
+    SemaphoreHandle_t lock;
+};
+
+#endif // ESPWEBC_CACHE_H
@@ -0,0 +1,77 @@
+#ifndef ESPWEBC_FORMAT_H
+#define ESPWEBC_FORMAT_H
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+namespace ESPWebCFormat
+{
+    static const uint8_t MAX_DECIMALS = 6;
+    static const size_t FIXED_SIZE = 24; // buffer for fixed(), any float
+
+    // Writes value with exactly decimals digits after the point, as a JSON
+    // number: integer arithmetic, no printf, rounded half away from zero.
+    // NaN and infinity have no JSON form and are written as null. Returns the
+    // length, out is not NUL-terminated.
+    inline size_t fixed(char *out, float value, uint8_t decimals)
+    {
+        static const uint32_t POW10[MAX_DECIMALS + 1] = {1, 10, 100, 1000, 10000, 100000, 1000000};
+
+        if (value != value || value == INFINITY || value == -INFINITY)
+        {
+            memcpy(out, "null", 4);
+            return 4;
+        }
+        if (decimals > MAX_DECIMALS)
+        {
+            decimals = MAX_DECIMALS;
+        }
+
+        uint32_t scale = POW10[decimals];
+        double scaled = fabs((double)value) * scale + 0.5;
+        if (scaled >= 4294967295.0)
+        {
+            // Out of the integer range, the decimals are noise there anyway
+            int len = snprintf(out, FIXED_SIZE, "%.9g", (double)value);
+            return len > 0 ? (size_t)len : 0;
+        }
+
+        uint32_t n = (uint32_t)scaled;
+        uint32_t whole = n / scale;
+        uint32_t fraction = n % scale;
+
+        char digits[10];
+        size_t count = 0;
+        do
+        {
+            digits[count++] = '0' + whole % 10;
+            whole /= 10;
+        } while (whole);
+
+        size_t len = 0;
+        if (value < 0 && n != 0)
+        {
+            out[len++] = '-';
+        }
+        while (count)
+        {
+            out[len++] = digits[--count];
+        }
+        if (decimals)
+        {
+            out[len++] = '.';
+            for (uint8_t i = decimals; i-- > 0;)
+            {
+                out[len + i] = '0' + fraction % 10;
+                fraction /= 10;
+            }
+            len += decimals;
+        }
+        return len;
+    }
+}
+
+#endif // ESPWEBC_FORMAT_H
@@ -0,0 +1,659 @@
+#include "ESPWebCHistory.h"
+#include <algorithm>
+
+static const uint8_t HISTORY_MAGIC[4] = {'E', 'W', 'H', '2'};
+static const size_t HISTORY_HEADER_LEN = 8; // magic and first timestamp, the series table follows
+
+ESPWebCHistory::ESPWebCHistory()
+    : budgetBytes(256 * 1024), segmentBytes(16 * 1024)
+{
+}
+
+bool ESPWebCHistory::begin(const char *directory, size_t budget, size_t segment)
+{
+    if (lock == nullptr)
+    {
+        lock = xSemaphoreCreateMutex();
+    }
+    dir = directory;
+    setBudget(budget, segment);
+
+    if (!LittleFS.exists(dir))
+    {
+        LittleFS.mkdir(dir);
+    }
+
+    File root = LittleFS.open(dir);
+    if (!root || !root.isDirectory())
+    {
+        #ifdef ENABLE_DEBUG
+        Serial.println("History directory not available");
+        #endif
+        return false;
+    }
+
+    segments.clear();
+    totalBytes = 0;
+    File entry = root.openNextFile();
+    while (entry)
+    {
+        String name = entry.name();
+        int slash = name.lastIndexOf('/');
+        if (slash >= 0)
+        {
+            name = name.substring(slash + 1);
+        }
+
+        uint8_t header[HISTORY_HEADER_LEN];
+        if (name.endsWith(".seg") && entry.read(header, sizeof(header)) == sizeof(header) &&
+            memcmp(header, HISTORY_MAGIC, sizeof(HISTORY_MAGIC)) == 0)
+        {
+            Segment seg;
+            seg.seq = strtoul(name.c_str(), nullptr, 16);
+            seg.firstTs = (uint32_t)header[4] | ((uint32_t)header[5] << 8) | ((uint32_t)header[6] << 16) | ((uint32_t)header[7] << 24);
+            seg.size = entry.size();
+            segments.push_back(seg);
+            totalBytes += seg.size;
+        }
+        else if (name.endsWith(".seg"))
+        {
+            // Older format or torn header, it cannot be read back
+            entry.close();
+            LittleFS.remove(dir + "/" + name);
+            entry = root.openNextFile();
+            continue;
+        }
+        entry.close();
+        entry = root.openNextFile();
+    }
+    root.close();
+
+    std::sort(segments.begin(), segments.end(), [](const Segment &a, const Segment &b)
+              { return a.seq < b.seq; });
+    if (!segments.empty())
+    {
+        lastTs = segments.back().firstTs;
+    }
+
+    // Delta state of the last segment is not known after a reboot, so always
+    // continue in a fresh segment.
+    segmentOpen = false;
+    started = true;
+    enforceBudget();
+
+    #ifdef ENABLE_DEBUG_INFO
+    Serial.printf("History: %u segments, %u bytes\n", (unsigned)segments.size(), (unsigned)totalBytes);
+    #endif
+    return true;
+}
+
+void ESPWebCHistory::setBudget(size_t budget, size_t segment)
+{
+    if (segment < ESPWEBC_HISTORY_PAGE)
+    {
+        segment = ESPWEBC_HISTORY_PAGE;
+    }
+    if (budget < segment * 2)
+    {
+        budget = segment * 2;
+    }
+    budgetBytes = budget;
+    segmentBytes = segment;
+}
+
+int ESPWebCHistory::addSeries(const char *id, uint8_t decimals)
+{
+    int existing = findSeries(id);
+    if (existing >= 0)
+    {
+        return existing;
+    }
+    if (series.size() >= 255)
+    {
+        return -1;
+    }
+    if (decimals > 6)
+    {
+        decimals = 6;
+    }
+
+    // The open segment's table does not have it, continue in a new one
+    if (lock != nullptr)
+    {
+        xSemaphoreTake(lock, portMAX_DELAY);
+        flushLocked();
+        segmentOpen = false;
+        series.push_back({id, decimals, 0});
+        xSemaphoreGive(lock);
+    }
+    else
+    {
+        series.push_back({id, decimals, 0});
+    }
+    return series.size() - 1;
+}
+
+int ESPWebCHistory::findSeries(const char *id) const
+{
+    for (size_t i = 0; i < series.size(); i++)
+    {
+        if (strcmp(series[i].id, id) == 0)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static const float HISTORY_POW10[] = {1.0f, 10.0f, 100.0f, 1000.0f, 10000.0f, 100000.0f, 1000000.0f};
+
+size_t ESPWebCHistory::putVarint(uint8_t *out, uint32_t v)
+{
+    size_t n = 0;
+    while (v >= 0x80)
+    {
+        out[n++] = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    out[n++] = (uint8_t)v;
+    return n;
+}
+
+float ESPWebCHistory::scaleDown(int32_t v, uint8_t decimals)
+{
+    return v / HISTORY_POW10[decimals];
+}
+
+String ESPWebCHistory::segmentPath(uint32_t seq) const
+{
+    char name[16];
+    snprintf(name, sizeof(name), "/%08x.seg", (unsigned)seq);
+    return dir + name;
+}
+
+void ESPWebCHistory::append(uint8_t seriesIndex, uint32_t ts, float value)
+{
+    if (!started || seriesIndex >= series.size() || value != value)
+    {
+        return;
+    }
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+
+    // Keep the log monotonic, a clock stepping back is stored as "no time passed".
+    if (ts < lastTs)
+    {
+        ts = lastTs;
+    }
+
+    // Rotate or flush before encoding, records are relative to the segment
+    // they end up in.
+    const size_t maxRecord = 15;
+    bool open = segmentOpen;
+    if (open && segments.back().size + pendingLen + maxRecord > segmentBytes)
+    {
+        flushLocked();
+        open = false;
+    }
+    else if (open && pendingLen + maxRecord > sizeof(pending))
+    {
+        flushLocked();
+        open = segmentOpen;
+    }
+    if (!open && !startSegment(ts))
+    {
+        xSemaphoreGive(lock);
+        return;
+    }
+
+    // Clamped, a float past the int32 range of the scaled value is not
+    // convertible
+    Series &s = series[seriesIndex];
+    double scaledValue = (double)value * HISTORY_POW10[s.decimals];
+    if (scaledValue > INT32_MAX)
+    {
+        scaledValue = INT32_MAX;
+    }
+    else if (scaledValue < -INT32_MAX)
+    {
+        scaledValue = -INT32_MAX;
+    }
+    int32_t scaled = (int32_t)lround(scaledValue);
+    int32_t delta = (int32_t)((uint32_t)scaled - (uint32_t)s.last);
+
+    uint8_t rec[maxRecord];
+    size_t len = putVarint(rec, seriesIndex);
+    len += putVarint(rec + len, ts - lastTs);
+    len += putVarint(rec + len, ((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31));
+
+    if (pendingLen == 0)
+    {
+        pendingSince = millis();
+    }
+    memcpy(pending + pendingLen, rec, len);
+    pendingLen += len;
+    s.last = scaled;
+    lastTs = ts;
+
+    xSemaphoreGive(lock);
+}
+
+// Writes the header of a new segment straight to flash, the series table
+// may be larger than the page buffer
+bool ESPWebCHistory::startSegment(uint32_t ts)
+{
+    Segment seg;
+    seg.seq = segments.empty() ? 0 : segments.back().seq + 1;
+    seg.firstTs = ts;
+    seg.size = 0;
+
+    File file = LittleFS.open(segmentPath(seg.seq), "w");
+    if (!file)
+    {
+        #ifdef ENABLE_DEBUG
+        Serial.println("History: failed to create segment");
+        #endif
+        return false;
+    }
+    uint8_t header[HISTORY_HEADER_LEN + 1];
+    memcpy(header, HISTORY_MAGIC, sizeof(HISTORY_MAGIC));
+    header[4] = ts & 0xFF;
+    header[5] = (ts >> 8) & 0xFF;
+    header[6] = (ts >> 16) & 0xFF;
+    header[7] = (ts >> 24) & 0xFF;
+    header[8] = series.size();
+    size_t expected = sizeof(header);
+    size_t written = file.write(header, sizeof(header));
+    for (auto &s : series)
+    {
+        uint8_t idLen = strnlen(s.id, 255);
+        uint8_t entry[2] = {s.decimals, idLen};
+        written += file.write(entry, sizeof(entry));
+        written += file.write((const uint8_t *)s.id, idLen);
+        expected += sizeof(entry) + idLen;
+        s.last = 0;
+    }
+    file.close();
+
+    seg.size = written;
+    segments.push_back(seg);
+    totalBytes += written;
+    pendingLen = 0;
+    lastTs = ts;
+    segmentOpen = written == expected;
+
+    enforceBudget();
+    return segmentOpen;
+}
+
+void ESPWebCHistory::enforceBudget()
+{
+    while (segments.size() > 1 && totalBytes + pendingLen > budgetBytes)
+    {
+        LittleFS.remove(segmentPath(segments.front().seq));
+        totalBytes -= segments.front().size;
+        segments.erase(segments.begin());
+    }
+}
+
+void ESPWebCHistory::flushLocked()
+{
+    if (pendingLen == 0 || segments.empty())
+    {
+        return;
+    }
+
+    File file = LittleFS.open(segmentPath(segments.back().seq), "a");
+    size_t written = 0;
+    if (file)
+    {
+        written = file.write(pending, pendingLen);
+        file.close();
+    }
+
+    if (written != pendingLen)
+    {
+        // The records after a failed write would decode against missing
+        // deltas, continue in a new segment instead.
+        #ifdef ENABLE_DEBUG
+        Serial.println("History: failed to append segment");
+        #endif
+        segmentOpen = false;
+    }
+
+    segments.back().size += written;
+    totalBytes += written;
+    pendingLen = 0;
+}
+
+void ESPWebCHistory::flush()
+{
+    if (!started)
+    {
+        return;
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    flushLocked();
+    xSemaphoreGive(lock);
+}
+
+void ESPWebCHistory::loop()
+{
+    if (pendingLen > 0 && millis() - pendingSince >= ESPWEBC_HISTORY_FLUSH_MS)
+    {
+        flush();
+    }
+}
+
+ESPWebCHistory::Cursor::Cursor(ESPWebCHistory &history, uint8_t seriesIndex, uint32_t from, uint32_t to)
+    : history(history), seriesIndex(seriesIndex), from(from), to(to)
+{
+    if (!history.started || seriesIndex >= history.series.size())
+    {
+        done = true;
+        return;
+    }
+
+    xSemaphoreTake(history.lock, portMAX_DELAY);
+    history.flushLocked();
+    const std::vector<Segment> &segs = history.segments;
+    for (size_t i = 0; i < segs.size(); i++)
+    {
+        uint32_t end = (i + 1 < segs.size()) ? segs[i + 1].firstTs : UINT32_MAX;
+        if (segs[i].firstTs <= to && end >= from)
+        {
+            seqs.push_back(segs[i].seq);
+        }
+    }
+    xSemaphoreGive(history.lock);
+
+}
+
+ESPWebCHistory::Cursor::~Cursor()
+{
+    if (file)
+    {
+        file.close();
+    }
+}
+
+bool ESPWebCHistory::Cursor::readByte(uint8_t &b)
+{
+    if (bufPos >= bufLen)
+    {
+        bufLen = file.read(buf, sizeof(buf));
+        bufPos = 0;
+        if (bufLen == 0)
+        {
+            return false;
+        }
+    }
+    b = buf[bufPos++];
+    return true;
+}
+
+bool ESPWebCHistory::Cursor::readVarint(uint32_t &v)
+{
+    v = 0;
+    for (uint8_t shift = 0; shift < 35; shift += 7)
+    {
+        uint8_t b;
+        if (!readByte(b))
+        {
+            return false;
+        }
+        v |= (uint32_t)(b & 0x7F) << shift;
+        if (!(b & 0x80))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ESPWebCHistory::Cursor::openNext()
+{
+    while (seqPos < seqs.size())
+    {
+        file = LittleFS.open(history.segmentPath(seqs[seqPos++]), "r");
+        if (!file)
+        {
+            continue;
+        }
+        bufLen = 0;
+        bufPos = 0;
+
+        if (!readHeader() || fileSeries < 0)
+        {
+            // Unreadable, or the series was not logged yet
+            file.close();
+            continue;
+        }
+        return true;
+    }
+    return false;
+}
+
+// Reads the segment header and finds the series in its table by id
+bool ESPWebCHistory::Cursor::readHeader()
+{
+    uint8_t header[HISTORY_HEADER_LEN + 1];
+    for (size_t i = 0; i < sizeof(header); i++)
+    {
+        if (!readByte(header[i]))
+        {
+            return false;
+        }
+    }
+    if (memcmp(header, HISTORY_MAGIC, sizeof(HISTORY_MAGIC)) != 0)
+    {
+        return false;
+    }
+    lastTs = (uint32_t)header[4] | ((uint32_t)header[5] << 8) | ((uint32_t)header[6] << 16) | ((uint32_t)header[7] << 24);
+
+    const char *id = history.series[seriesIndex].id;
+    size_t idLen = strlen(id);
+    fileSeries = -1;
+    for (uint8_t i = 0; i < header[8]; i++)
+    {
+        uint8_t decimals, len;
+        if (!readByte(decimals) || !readByte(len))
+        {
+            return false;
+        }
+        bool match = len == idLen;
+        for (uint8_t j = 0; j < len; j++)
+        {
+            uint8_t c;
+            if (!readByte(c))
+            {
+                return false;
+            }
+            match = match && c == (uint8_t)id[j];
+        }
+        if (match && decimals <= 6)
+        {
+            fileSeries = i;
+            fileDecimals = decimals;
+        }
+    }
+    lastValues.assign(header[8], 0);
+    return true;
+}
+
+bool ESPWebCHistory::Cursor::next(uint32_t &ts, float &value)
+{
+    while (!done)
+    {
+        if (!file && !openNext())
+        {
+            done = true;
+            break;
+        }
+
+        uint32_t idx, dt, zz;
+        if (!readVarint(idx) || !readVarint(dt) || !readVarint(zz) || idx >= lastValues.size())
+        {
+            // End of segment (or a torn tail after power loss), move on.
+            file.close();
+            continue;
+        }
+
+        lastTs += dt;
+        lastValues[idx] += (zz >> 1) ^ (~(zz & 1) + 1);
+
+        if (lastTs > to)
+        {
+            done = true;
+            break;
+        }
+        if ((int)idx == fileSeries && lastTs >= from)
+        {
+            ts = lastTs;
+            value = scaleDown((int32_t)lastValues[idx], fileDecimals);
+            return true;
+        }
+    }
+    return false;
+}
+
+static const ESPWebCRollup::Tier ROLLUP_TIERS[] = {ESPWEBC_ROLLUP_TIERS};
+static const size_t ROLLUP_TIER_COUNT = sizeof(ROLLUP_TIERS) / sizeof(ROLLUP_TIERS[0]);
+
+ESPWebCRollup::ESPWebCRollup()
+{
+    size_t total = 0;
+    for (size_t i = 0; i < ROLLUP_TIER_COUNT; i++)
+    {
+        states.push_back({total, 0, 0, false});
+        total += ROLLUP_TIERS[i].size;
+    }
+    buckets.assign(total, Bucket{0, 0, 0, 0});
+}
+
+size_t ESPWebCRollup::tierCount()
+{
+    return ROLLUP_TIER_COUNT;
+}
+
+const ESPWebCRollup::Tier &ESPWebCRollup::tier(size_t index)
+{
+    return ROLLUP_TIERS[index];
+}
+
+void ESPWebCRollup::add(uint32_t ts, float value)
+{
+    portENTER_CRITICAL(&mux);
+    for (size_t t = 0; t < ROLLUP_TIER_COUNT; t++)
+    {
+        const Tier &tier = ROLLUP_TIERS[t];
+        TierState &state = states[t];
+        uint32_t start = ts - ts % tier.width;
+        uint16_t slot = state.head;
+
+        if (start > state.headStart || !state.used)
+        {
+            // Move the head forward, clearing the buckets skipped over.
+            uint32_t steps = !state.used ? tier.size : (start - state.headStart) / tier.width;
+            if (steps > tier.size)
+            {
+                steps = tier.size;
+            }
+            for (uint32_t i = 0; i < steps; i++)
+            {
+                state.head = (state.head + 1) % tier.size;
+                buckets[state.offset + state.head].count = 0;
+            }
+            state.headStart = start;
+            state.used = true;
+            slot = state.head;
+        }
+        else if (start < state.headStart)
+        {
+            uint32_t back = (state.headStart - start) / tier.width;
+            if (back >= tier.size)
+            {
+                continue;
+            }
+            slot = (state.head + tier.size - back) % tier.size;
+        }
+
+        Bucket &b = buckets[state.offset + slot];
+        if (b.count == 0)
+        {
+            b.min = b.max = b.sum = value;
+            b.count = 1;
+        }
+        else
+        {
+            b.min = value < b.min ? value : b.min;
+            b.max = value > b.max ? value : b.max;
+            b.sum += value;
+            b.count++;
+        }
+    }
+    portEXIT_CRITICAL(&mux);
+}
+
+size_t ESPWebCRollup::read(size_t t, uint32_t from, uint32_t to, std::vector<Point> &out) const
+{
+    if (t >= ROLLUP_TIER_COUNT)
+    {
+        return 0;
+    }
+    const Tier &tier = ROLLUP_TIERS[t];
+    out.reserve(out.size() + tier.size);
+
+    portENTER_CRITICAL(&mux);
+    const TierState &state = states[t];
+    // Oldest to newest
+    if (!state.used)
+    {
+        portEXIT_CRITICAL(&mux);
+        return 0;
+    }
+    for (uint16_t i = tier.size; i > 0; i--)
+    {
+        uint32_t back = i - 1;
+        if (state.headStart < back * tier.width)
+        {
+            continue;
+        }
+        uint32_t start = state.headStart - back * tier.width;
+        const Bucket &b = buckets[state.offset + (state.head + tier.size - back) % tier.size];
+        if (b.count == 0 || start + tier.width <= from || start > to)
+        {
+            continue;
+        }
+        out.push_back({start, b});
+    }
+    portEXIT_CRITICAL(&mux);
+    return out.size();
+}
+
+int ESPWebCRollup::pickTier(uint32_t from, uint32_t to, uint32_t now, size_t points)
+{
+    if (points == 0 || to <= from)
+    {
+        return -1;
+    }
+    uint32_t want = (to - from + points - 1) / points;
+    int fallback = -1;
+    for (size_t t = 0; t < ROLLUP_TIER_COUNT; t++)
+    {
+        const Tier &tier = ROLLUP_TIERS[t];
+        if (tier.width < want)
+        {
+            continue;
+        }
+        if (fallback < 0)
+        {
+            fallback = t;
+        }
+        if ((uint64_t)tier.width * tier.size >= (uint64_t)(now > from ? now - from : 0))
+        {
+            return t;
+        }
+    }
+    return fallback >= 0 ? fallback : ROLLUP_TIER_COUNT - 1;
+}
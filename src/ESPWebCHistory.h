@@ -0,0 +1,186 @@
+#ifndef ESPWEBC_HISTORY_H
+#define ESPWEBC_HISTORY_H
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <vector>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+// Append-only sensor history stored as segment files on LittleFS.
+//
+// Segment file: "<dir>/<seq as 8 hex>.seg"
+//   header : 'E' 'W' 'H' '2' + uint32 first timestamp (little endian)
+//            + uint8 series count + per series: uint8 decimals | uint8 id length | id
+//   record : varint series | varint seconds since previous record | zigzag varint value delta
+// The series number of a record indexes the segment's own series table, so
+// reading matches series by id and survives addHistory() calls being
+// reordered or added in a firmware update.
+// Value deltas are taken against the previous value of the same series in the
+// same segment, values are stored as integers scaled by 10^decimals and
+// clamped to the int32 range.
+// Records are collected in a page-sized RAM buffer and appended in one write.
+
+#ifndef ESPWEBC_HISTORY_PAGE
+#define ESPWEBC_HISTORY_PAGE 256
+#endif
+
+#ifndef ESPWEBC_HISTORY_FLUSH_MS
+#define ESPWEBC_HISTORY_FLUSH_MS 60000
+#endif
+
+// Samples are only logged once time() is past this (2020-09-13), a clock
+// that was never set starts near 0 after every reboot
+#ifndef ESPWEBC_HISTORY_MIN_TIME
+#define ESPWEBC_HISTORY_MIN_TIME 1600000000UL
+#endif
+
+class ESPWebCHistory
+{
+public:
+    ESPWebCHistory();
+
+    bool begin(const char *dir = "/hist", size_t budgetBytes = 256 * 1024, size_t segmentBytes = 16 * 1024);
+    void setBudget(size_t budgetBytes, size_t segmentBytes);
+
+    int addSeries(const char *id, uint8_t decimals);
+    int findSeries(const char *id) const;
+    size_t seriesCount() const { return series.size(); }
+    uint8_t seriesDecimals(uint8_t index) const { return series[index].decimals; }
+    const char *seriesId(uint8_t index) const { return series[index].id; }
+
+    void append(uint8_t seriesIndex, uint32_t ts, float value);
+    void loop();
+    void flush();
+
+    size_t usedBytes() const { return totalBytes + pendingLen; }
+    size_t segmentCount() const { return segments.size(); }
+
+    // Streams records of one series in [from, to] straight out of the segment
+    // files, holding only a small read buffer in RAM.
+    class Cursor
+    {
+    public:
+        Cursor(ESPWebCHistory &history, uint8_t seriesIndex, uint32_t from, uint32_t to);
+        ~Cursor();
+        bool next(uint32_t &ts, float &value);
+
+    private:
+        bool openNext();
+        bool readHeader();
+        bool readByte(uint8_t &b);
+        bool readVarint(uint32_t &v);
+
+        ESPWebCHistory &history;
+        uint8_t seriesIndex;
+        uint32_t from;
+        uint32_t to;
+        std::vector<uint32_t> seqs;
+        size_t seqPos = 0;
+        File file;
+        uint8_t buf[128];
+        size_t bufLen = 0;
+        size_t bufPos = 0;
+        uint32_t lastTs = 0;
+        std::vector<uint32_t> lastValues; // per series of the segment
+        int fileSeries = -1;              // seriesIndex in the segment's table
+        uint8_t fileDecimals = 0;
+        bool done = false;
+    };
+
+private:
+    struct Series
+    {
+        const char *id;
+        uint8_t decimals;
+        int32_t last;
+    };
+
+    struct Segment
+    {
+        uint32_t seq;
+        uint32_t firstTs;
+        size_t size;
+    };
+
+    String segmentPath(uint32_t seq) const;
+    bool startSegment(uint32_t ts);
+    void flushLocked();
+    void enforceBudget();
+    static size_t putVarint(uint8_t *out, uint32_t v);
+    static float scaleDown(int32_t v, uint8_t decimals);
+
+    String dir;
+    size_t budgetBytes;
+    size_t segmentBytes;
+    size_t totalBytes = 0;
+    bool started = false;
+
+    std::vector<Series> series;
+    std::vector<Segment> segments;
+    uint32_t lastTs = 0;
+    bool segmentOpen = false;
+
+    uint8_t pending[ESPWEBC_HISTORY_PAGE];
+    size_t pendingLen = 0;
+    unsigned long pendingSince = 0;
+
+    SemaphoreHandle_t lock = nullptr;
+};
+
+// Multi-resolution min/max/avg/count rollups of one series, kept in RAM.
+// Every tier is a ring of fixed-width buckets, so adding a sample is O(1)
+// per tier and a long range can be served from the coarsest tier that fits.
+
+#ifndef ESPWEBC_ROLLUP_TIERS
+// {bucket width in seconds, bucket count}: 1 min of 1 s, 1 h of 1 min, 1 day of 15 min, 7 days of 2 h
+#define ESPWEBC_ROLLUP_TIERS {1, 60}, {60, 60}, {900, 96}, {7200, 84}
+#endif
+
+class ESPWebCRollup
+{
+public:
+    struct Tier
+    {
+        uint32_t width;
+        uint16_t size;
+    };
+
+    struct Bucket
+    {
+        float min;
+        float max;
+        float sum;
+        uint32_t count;
+    };
+
+    struct Point
+    {
+        uint32_t start;
+        Bucket bucket;
+    };
+
+    ESPWebCRollup();
+    void add(uint32_t ts, float value);
+    size_t read(size_t tier, uint32_t from, uint32_t to, std::vector<Point> &out) const;
+
+    static size_t tierCount();
+    static const Tier &tier(size_t index);
+    static int pickTier(uint32_t from, uint32_t to, uint32_t now, size_t points);
+
+private:
+    struct TierState
+    {
+        size_t offset;
+        uint16_t head;
+        uint32_t headStart;
+        bool used;
+    };
+
+    std::vector<Bucket> buckets;
+    std::vector<TierState> states;
+    mutable portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+};
+
+#endif // ESPWEBC_HISTORY_H
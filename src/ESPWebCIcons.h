@@ -0,0 +1,176 @@
+// Generated by extras/icon_sprite.py, do not edit.
+#ifndef ESPWEBC_ICONS_H
+#define ESPWEBC_ICONS_H
+
+#include "ESPWebCAssets.h"
+
+// 11 icons, 6786 bytes, 2597 gzipped
+static const uint8_t ESPWEBC_ICON_DATA[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x59, 0xcb, 0x72, 0xdb, 0x3a,
+    0x12, 0xdd, 0xeb, 0x2b, 0x58, 0x5e, 0xcd, 0x2c, 0x60, 0x13, 0x4f, 0x02, 0x53, 0x49, 0x16, 0xb3,
+    0xcf, 0x47, 0x28, 0x8e, 0x62, 0xa9, 0x86, 0x91, 0x4d, 0x19, 0xa1, 0x73, 0xfd, 0xf5, 0x73, 0xce,
+    0x01, 0x29, 0xdb, 0xb9, 0x4e, 0x5c, 0x95, 0x49, 0x4d, 0x95, 0xc5, 0x17, 0x1a, 0xdd, 0x8d, 0x7e,
+    0x77, 0xfb, 0xdd, 0xfd, 0x7c, 0xd3, 0x7d, 0xff, 0x3a, 0x1e, 0xef, 0xdf, 0x5f, 0xec, 0x6b, 0xbd,
+    0xfb, 0xd7, 0xd5, 0xd5, 0xc3, 0xc3, 0xc3, 0xe5, 0x83, 0xbf, 0xbc, 0x3d, 0xdd, 0x5c, 0xb9, 0xbe,
+    0xef, 0xaf, 0x00, 0x71, 0xf1, 0xe1, 0xdd, 0xfd, 0x5f, 0x5f, 0x3f, 0xdd, 0x8e, 0xdd, 0xe1, 0xf3,
+    0xfb, 0x8b, 0xd3, 0xee, 0xe6, 0xdb, 0xb8, 0x3d, 0x99, 0xdd, 0x71, 0xde, 0x8d, 0xb7, 0x77, 0xbb,
+    0x8b, 0x6e, 0x3e, 0xec, 0x1e, 0xfe, 0x7d, 0xfb, 0xfd, 0xfd, 0x45, 0xdf, 0xf5, 0x9d, 0x1d, 0x8a,
+    0xd3, 0x05, 0xbb, 0xee, 0xb6, 0x75, 0xdf, 0xd5, 0xd3, 0xf6, 0x78, 0xff, 0xe5, 0xf6, 0xf4, 0xf5,
+    0xfd, 0xc5, 0xd7, 0x6d, 0x3d, 0x1d, 0xbe, 0xff, 0xc3, 0x76, 0x04, 0x34, 0xbc, 0xd9, 0xe8, 0xd3,
+    0x3f, 0x2f, 0x3a, 0xa0, 0xfd, 0x68, 0x53, 0x0a, 0x9d, 0x77, 0xf3, 0x90, 0xf2, 0x64, 0xbc, 0xeb,
+    0x8c, 0x4f, 0x9d, 0x49, 0x05, 0xbf, 0x34, 0x19, 0x97, 0x72, 0x67, 0x5c, 0x8f, 0x2f, 0xc1, 0xe1,
+    0xe2, 0x3d, 0x60, 0xa2, 0xc5, 0x9b, 0xef, 0x4c, 0xc6, 0x2f, 0x0d, 0xd5, 0xe4, 0x74, 0x19, 0xf1,
+    0x25, 0x5f, 0xc6, 0x6a, 0x6c, 0xef, 0xf8, 0xe2, 0xc2, 0x65, 0xdc, 0x1b, 0x8b, 0xbf, 0x09, 0x0b,
+    0x22, 0xaa, 0x05, 0x7e, 0x5f, 0x36, 0x34, 0x78, 0xe0, 0x48, 0xc3, 0x64, 0x6c, 0xcc, 0x9d, 0x25,
+    0x6d, 0x52, 0x11, 0x11, 0x3f, 0x74, 0xbe, 0x17, 0x1f, 0x29, 0xcd, 0x86, 0xbc, 0x11, 0x89, 0xef,
+    0x8a, 0xd0, 0x03, 0x57, 0x75, 0xa2, 0x84, 0xf7, 0xbd, 0x0d, 0x83, 0x9b, 0xb0, 0xd6, 0x77, 0xfa,
+    0x86, 0x4f, 0x95, 0x60, 0x7c, 0x79, 0x6c, 0xc7, 0xb3, 0x7d, 0xf6, 0xb3, 0xb5, 0xb3, 0xf5, 0x24,
+    0xda, 0x63, 0xd1, 0xfa, 0x4d, 0x35, 0xbe, 0xb3, 0xc4, 0x64, 0x22, 0x77, 0x55, 0x53, 0xba, 0x41,
+    0x67, 0x08, 0x9d, 0x13, 0xfb, 0x44, 0x6b, 0x84, 0xd7, 0x9c, 0x89, 0x55, 0x73, 0xe6, 0x40, 0x1c,
+    0x41, 0x3e, 0x80, 0xc3, 0x87, 0x1c, 0x26, 0x5b, 0x20, 0x11, 0x1b, 0x5d, 0x17, 0x7a, 0x88, 0xc8,
+    0xdb, 0x61, 0x82, 0xc8, 0x62, 0xe7, 0x09, 0xcf, 0xad, 0x81, 0x12, 0x24, 0x89, 0x10, 0x88, 0xc3,
+    0x5b, 0x3c, 0xc6, 0x5e, 0xe8, 0xf4, 0x15, 0xbb, 0xcb, 0xde, 0xee, 0xed, 0xe4, 0xa8, 0x27, 0xbc,
+    0x96, 0xb6, 0xec, 0xce, 0x7b, 0xb4, 0x05, 0x68, 0x84, 0x05, 0x78, 0x89, 0x16, 0xd0, 0xe0, 0x21,
+    0x45, 0x51, 0x25, 0xd1, 0x18, 0xb8, 0xd7, 0xf6, 0x3a, 0xa6, 0x8d, 0xda, 0xa1, 0x13, 0x63, 0xf3,
+    0xe3, 0xe6, 0x63, 0x33, 0x14, 0xeb, 0xfa, 0x19, 0x4a, 0xc9, 0x92, 0x6b, 0xa2, 0x7e, 0x71, 0x08,
+    0x6b, 0x7d, 0xe5, 0x85, 0x6f, 0xeb, 0xf9, 0xb1, 0xd6, 0x6b, 0xa5, 0x0b, 0xd0, 0x35, 0xa0, 0xf0,
+    0x38, 0x2f, 0x1b, 0xb1, 0xd6, 0x3e, 0xd4, 0xb6, 0xde, 0x34, 0xa1, 0x1d, 0x0b, 0x96, 0xba, 0xa0,
+    0x7d, 0xbc, 0xb8, 0xfa, 0xf0, 0xee, 0xaa, 0x59, 0xf3, 0xab, 0x56, 0x3d, 0x1e, 0x6e, 0xf6, 0xf5,
+    0xd3, 0xb7, 0xf1, 0xd3, 0x8f, 0x66, 0xdd, 0xbb, 0xf0, 0x5b, 0x66, 0x3d, 0xc0, 0x8c, 0x4b, 0xea,
+    0x17, 0xb3, 0x79, 0xd2, 0x5a, 0x7d, 0xae, 0xcb, 0xb3, 0xbd, 0x98, 0xd5, 0x60, 0x00, 0x4f, 0x35,
+    0x41, 0x86, 0x83, 0xa5, 0x39, 0xa7, 0xce, 0xc5, 0x17, 0x46, 0xf0, 0x02, 0xfa, 0x6c, 0x67, 0x75,
+    0x5d, 0x9b, 0x22, 0x99, 0x29, 0x22, 0x67, 0x53, 0xcd, 0x03, 0x71, 0x55, 0xea, 0x0b, 0x24, 0xfb,
+    0xc7, 0x8f, 0xb9, 0xac, 0x6c, 0x0d, 0x74, 0xb5, 0x20, 0xc5, 0x04, 0x60, 0xe4, 0x51, 0xad, 0xcc,
+    0xcf, 0xc1, 0x27, 0x1c, 0xee, 0x3e, 0xad, 0xc8, 0x97, 0xe7, 0x85, 0x7f, 0x02, 0x18, 0x42, 0x14,
+    0xf9, 0x95, 0x36, 0x09, 0x11, 0xc0, 0xc2, 0x66, 0x6a, 0x1f, 0x3b, 0x3a, 0xae, 0xcd, 0xfd, 0x64,
+    0xa5, 0x3d, 0x38, 0x93, 0x4c, 0xce, 0xd7, 0xf5, 0x61, 0xb2, 0x8e, 0x10, 0x11, 0x96, 0x12, 0x2c,
+    0x0d, 0x34, 0xef, 0x9d, 0xcb, 0x74, 0x23, 0x1b, 0xa2, 0xbe, 0xe1, 0x13, 0x77, 0xaf, 0x9b, 0xd7,
+    0xbd, 0xd8, 0x0a, 0xdc, 0x43, 0x21, 0x05, 0x10, 0x80, 0x87, 0x51, 0x45, 0xab, 0xa8, 0x23, 0xd9,
+    0xe8, 0xc1, 0xa0, 0x63, 0x38, 0x09, 0x0c, 0x0c, 0x08, 0x25, 0x83, 0xd8, 0xcb, 0x30, 0xa0, 0x28,
+    0xc9, 0x94, 0xd8, 0x98, 0x26, 0x2c, 0x44, 0x33, 0x35, 0x0f, 0xa2, 0x31, 0x99, 0xec, 0x88, 0xc7,
+    0xf3, 0x03, 0x00, 0x53, 0x98, 0x9c, 0xfc, 0xa3, 0x5b, 0xde, 0xb0, 0x16, 0x19, 0x27, 0x88, 0xce,
+    0x92, 0x5b, 0x03, 0x69, 0x34, 0x5b, 0xd3, 0xd1, 0xe5, 0x63, 0x96, 0x34, 0xa8, 0xbf, 0x41, 0x72,
+    0xa7, 0x06, 0x1d, 0xd7, 0x40, 0x2f, 0xe1, 0x3e, 0xf4, 0x08, 0x3c, 0x24, 0x90, 0x74, 0xe7, 0x0d,
+    0x9f, 0x87, 0x7e, 0xe2, 0x6e, 0xae, 0x73, 0x97, 0x23, 0x83, 0x44, 0x34, 0x58, 0xe0, 0xa5, 0x11,
+    0xd2, 0xc2, 0x75, 0x24, 0x57, 0xc4, 0x40, 0xe6, 0x82, 0x17, 0x67, 0x60, 0x8c, 0xec, 0xba, 0xc6,
+    0xb5, 0xd8, 0xa4, 0x17, 0x0e, 0x1d, 0x4e, 0x63, 0x42, 0x17, 0x79, 0x22, 0x46, 0x21, 0xc5, 0x17,
+    0x89, 0xa0, 0x49, 0x40, 0x72, 0xc9, 0x0c, 0x80, 0x10, 0x99, 0x5c, 0x86, 0x0f, 0x4e, 0xd1, 0xae,
+    0x94, 0x4e, 0x3e, 0x6f, 0x33, 0x83, 0xa6, 0xb5, 0x70, 0xb4, 0xe0, 0xaa, 0x45, 0x34, 0xcb, 0xa5,
+    0x5a, 0xc5, 0x50, 0x0f, 0x7b, 0xd8, 0x2c, 0xcf, 0x86, 0x2f, 0x5a, 0x36, 0x5c, 0xb7, 0xf4, 0x3b,
+    0xc0, 0xb7, 0x50, 0x23, 0x1c, 0x3f, 0xf5, 0xc1, 0xfb, 0xdb, 0xf1, 0xf0, 0xd9, 0x5c, 0x1f, 0x4e,
+    0xd7, 0xe3, 0xce, 0x5c, 0xef, 0x77, 0xd7, 0xff, 0xf9, 0xd1, 0x09, 0xe1, 0x56, 0xbf, 0x97, 0x5b,
+    0x10, 0x16, 0xbb, 0xdc, 0x53, 0xa5, 0xb2, 0x36, 0xa8, 0x38, 0x8d, 0xa6, 0xd8, 0xae, 0x40, 0xd8,
+    0xb6, 0x74, 0xb6, 0x49, 0xd2, 0x22, 0xf8, 0x52, 0xa3, 0xb6, 0x8c, 0x26, 0x20, 0x9a, 0xe1, 0x32,
+    0x8c, 0xb0, 0x76, 0x38, 0x9f, 0x4b, 0x3f, 0x03, 0x04, 0x16, 0x23, 0x34, 0x0d, 0xb1, 0x7e, 0x21,
+    0xd1, 0x06, 0xa0, 0x06, 0xbd, 0xc4, 0xd1, 0x27, 0xe5, 0x33, 0x64, 0x87, 0xc2, 0x4d, 0x5d, 0xdb,
+    0x3b, 0x01, 0x40, 0x6e, 0x0e, 0x34, 0x11, 0xa1, 0x12, 0xbf, 0xc9, 0xd2, 0x98, 0xf9, 0x17, 0x98,
+    0x33, 0x78, 0xde, 0x14, 0x64, 0xd1, 0xae, 0x2f, 0x8b, 0x45, 0xfb, 0x2c, 0x9d, 0xb9, 0xa1, 0xc5,
+    0x92, 0x41, 0x91, 0x40, 0x1f, 0x05, 0xb0, 0x3e, 0xe3, 0x71, 0xb3, 0x42, 0x2d, 0x40, 0xdc, 0xde,
+    0x76, 0x3f, 0x3d, 0x3d, 0x07, 0x38, 0x6f, 0xac, 0xcf, 0xd0, 0xbd, 0xa0, 0xf3, 0xc4, 0xc0, 0x1b,
+    0x5a, 0xdc, 0x7d, 0xbf, 0xdb, 0x1e, 0x3f, 0x9b, 0xed, 0xe9, 0x74, 0xfb, 0x70, 0x6f, 0xb6, 0x63,
+    0xfd, 0x83, 0xaa, 0x44, 0x42, 0x2a, 0x71, 0x34, 0x9e, 0x3e, 0x8e, 0xcb, 0x78, 0x7e, 0xb0, 0xf0,
+    0x2c, 0xfc, 0x26, 0x38, 0x86, 0xb7, 0x70, 0x24, 0xbc, 0x4c, 0x9e, 0x62, 0x43, 0x12, 0xc7, 0x2d,
+    0x96, 0x19, 0xbe, 0xa7, 0x4c, 0xc3, 0x22, 0xa2, 0xe9, 0x72, 0x55, 0xe4, 0x5e, 0x4b, 0x48, 0xfc,
+    0xa4, 0x19, 0xa1, 0x22, 0xaa, 0x54, 0xfb, 0x90, 0x87, 0x53, 0x59, 0x71, 0x37, 0xb2, 0x24, 0x66,
+    0x5e, 0x90, 0x35, 0xa4, 0xeb, 0x99, 0x6e, 0x49, 0x95, 0x05, 0x83, 0xb6, 0xc3, 0x82, 0x84, 0x0d,
+    0xf7, 0x85, 0x80, 0x93, 0x6b, 0x2f, 0x36, 0x24, 0x53, 0x98, 0x1b, 0x4f, 0x81, 0xf9, 0xba, 0x8b,
+    0x85, 0x1c, 0x63, 0x27, 0x2b, 0x1f, 0x1b, 0xce, 0xb8, 0x37, 0xe3, 0x0b, 0xba, 0x7a, 0x38, 0xd3,
+    0x35, 0x8b, 0x59, 0x2d, 0x47, 0xc1, 0xbb, 0x4e, 0x81, 0x60, 0x81, 0x88, 0x13, 0x58, 0x93, 0x89,
+    0x11, 0x9c, 0xbf, 0x91, 0x72, 0x34, 0x39, 0x50, 0xae, 0x62, 0x63, 0xcf, 0x8f, 0x3a, 0x77, 0x63,
+    0x74, 0x22, 0xb8, 0xc4, 0xa6, 0x73, 0x3c, 0xd1, 0x19, 0x5f, 0x48, 0xfc, 0xcc, 0x82, 0x38, 0xf0,
+    0x56, 0x75, 0x92, 0x64, 0x45, 0x04, 0x22, 0x87, 0xab, 0x90, 0xeb, 0xcc, 0x8d, 0xb7, 0xda, 0xd8,
+    0x3c, 0x2b, 0x22, 0xb8, 0x46, 0x2b, 0x16, 0x65, 0x37, 0x13, 0x5b, 0xbc, 0x8d, 0x2f, 0x04, 0xf5,
+    0xb8, 0xf9, 0xb5, 0xb1, 0x7d, 0xd9, 0x1e, 0x7f, 0x34, 0x2f, 0x55, 0x5b, 0xbf, 0x63, 0x5e, 0x21,
+    0x43, 0x0f, 0x39, 0x4d, 0x0c, 0xe0, 0x60, 0xa1, 0xe5, 0x89, 0xa1, 0x15, 0x64, 0x2d, 0x61, 0xe3,
+    0x79, 0x34, 0x8c, 0x6f, 0xd6, 0xf6, 0x62, 0x53, 0xc1, 0xbe, 0x85, 0xf8, 0xd8, 0xd2, 0x32, 0x9f,
+    0x09, 0x8d, 0xe0, 0x81, 0x2a, 0x04, 0xe8, 0x67, 0xd8, 0xc5, 0xb0, 0x26, 0x0d, 0x9f, 0x19, 0x31,
+    0x5a, 0xde, 0xf4, 0x19, 0x05, 0x8e, 0x63, 0x35, 0x2b, 0x95, 0xe1, 0x93, 0xcf, 0xf4, 0x60, 0x44,
+    0xa6, 0xd9, 0x2b, 0xfa, 0xb0, 0x28, 0x02, 0x06, 0x25, 0x05, 0x51, 0x13, 0x76, 0xd3, 0x2a, 0x46,
+    0x51, 0x25, 0x51, 0x71, 0xb4, 0x32, 0x44, 0x48, 0x31, 0x4b, 0xd0, 0xaa, 0x23, 0x10, 0x70, 0x6c,
+    0xcc, 0x84, 0x95, 0x2b, 0x24, 0x69, 0x22, 0x25, 0xce, 0x33, 0x4c, 0x3d, 0xef, 0x1b, 0x17, 0x84,
+    0x0d, 0xdf, 0x99, 0x50, 0x7d, 0x22, 0x3f, 0xae, 0xbc, 0xcd, 0xed, 0x70, 0x38, 0x82, 0x18, 0xaf,
+    0x3a, 0xc5, 0x9e, 0xc7, 0xd2, 0xa9, 0xda, 0x39, 0x6b, 0x3b, 0xb6, 0x24, 0xb1, 0x70, 0xe2, 0xa7,
+    0x46, 0xfe, 0x2c, 0xaf, 0xfa, 0x24, 0xc5, 0x71, 0x95, 0xf0, 0x22, 0xe0, 0x27, 0xe1, 0xaf, 0xc9,
+    0x5b, 0x47, 0x5a, 0xe5, 0x13, 0xde, 0x88, 0x47, 0x37, 0xa7, 0xc3, 0x9d, 0x99, 0x77, 0xa7, 0x7a,
+    0xb8, 0xde, 0x8e, 0x3f, 0x18, 0x8b, 0xcf, 0xbf, 0x67, 0x2b, 0xdc, 0xe7, 0x72, 0x46, 0xfd, 0x5a,
+    0x54, 0x2c, 0xd0, 0xd7, 0x99, 0x5e, 0x12, 0x34, 0xa8, 0x7e, 0x85, 0xba, 0x2d, 0x4e, 0x2e, 0xc8,
+    0xea, 0x36, 0x03, 0xba, 0x12, 0x22, 0xe5, 0xb9, 0x6d, 0x09, 0xca, 0x47, 0x80, 0xd7, 0xda, 0x9e,
+    0x1f, 0x05, 0xdb, 0x76, 0xd7, 0x86, 0xec, 0x51, 0x84, 0x72, 0xdf, 0xff, 0x7f, 0x08, 0xa1, 0x3e,
+    0x77, 0x6f, 0x51, 0xda, 0xfc, 0xcf, 0xa4, 0x7e, 0xad, 0xad, 0x3d, 0x73, 0xc7, 0xdd, 0xed, 0xe1,
+    0x58, 0x77, 0xa7, 0x3f, 0xd5, 0x5f, 0x26, 0x06, 0x42, 0x64, 0x75, 0xb8, 0x9a, 0x6f, 0xae, 0xa6,
+    0x6a, 0x45, 0x06, 0xb5, 0xd6, 0xc5, 0x97, 0x08, 0x4c, 0x91, 0xc7, 0x87, 0x20, 0x10, 0xdc, 0xd0,
+    0x61, 0xba, 0x9e, 0x62, 0xb5, 0x2c, 0xa3, 0x58, 0x23, 0xe2, 0xbe, 0xba, 0x6a, 0x2e, 0xb2, 0x6a,
+    0x95, 0x88, 0x45, 0x29, 0x3a, 0x78, 0xf9, 0xd2, 0x30, 0x8c, 0x94, 0x23, 0x11, 0x4d, 0xb4, 0x79,
+    0x60, 0x41, 0x69, 0xca, 0xfb, 0x7e, 0xb0, 0x08, 0x86, 0xdc, 0xed, 0x8b, 0x0a, 0xee, 0xb5, 0x60,
+    0x67, 0xd9, 0x3c, 0xe2, 0x5c, 0x1e, 0x15, 0x97, 0x8a, 0x58, 0x15, 0x7a, 0x25, 0xcc, 0xce, 0xd2,
+    0xb1, 0x54, 0x18, 0x67, 0x75, 0x02, 0x90, 0xa2, 0xef, 0x57, 0x5d, 0xd4, 0x45, 0x37, 0x7b, 0x14,
+    0x5d, 0x73, 0x62, 0x19, 0x88, 0x26, 0x97, 0xbd, 0x73, 0x56, 0x31, 0x9e, 0x41, 0x07, 0x24, 0x36,
+    0xe7, 0x7a, 0xb2, 0xa8, 0xf2, 0xc6, 0x8f, 0xcf, 0x33, 0x22, 0x86, 0x36, 0x8a, 0x79, 0x45, 0xf6,
+    0xa1, 0x2b, 0x6a, 0x8c, 0x51, 0xd2, 0x90, 0xc1, 0xb7, 0x24, 0x55, 0x92, 0xf6, 0xc7, 0xe1, 0x67,
+    0x08, 0x1e, 0x9b, 0xd0, 0xa1, 0x83, 0x89, 0xb2, 0xc3, 0x63, 0xb6, 0xe7, 0x70, 0x3a, 0x3c, 0x55,
+    0x84, 0x33, 0x6a, 0xac, 0x9e, 0x82, 0x81, 0x04, 0x70, 0x99, 0x50, 0x72, 0x52, 0xd1, 0x5e, 0x69,
+    0x14, 0xd5, 0xab, 0xb3, 0xac, 0x42, 0x1d, 0xea, 0x6c, 0x35, 0x40, 0x96, 0xd2, 0x45, 0xb5, 0x8a,
+    0xf2, 0x09, 0x0a, 0x41, 0x6c, 0x9a, 0x4a, 0x90, 0xae, 0x39, 0x2c, 0x20, 0xea, 0xa4, 0xa6, 0x07,
+    0xa4, 0x36, 0xc0, 0x2c, 0x09, 0x22, 0x92, 0xa4, 0x66, 0xc9, 0xce, 0x21, 0x68, 0x14, 0x95, 0x63,
+    0x30, 0x05, 0x7e, 0x65, 0xa0, 0x51, 0x97, 0xd2, 0x8b, 0x77, 0xab, 0x9a, 0xad, 0x67, 0xe7, 0x4d,
+    0x75, 0xb1, 0x24, 0xd7, 0xfe, 0xb0, 0x76, 0xc0, 0x4d, 0x1e, 0x64, 0x7f, 0xa4, 0x9d, 0x74, 0xd4,
+    0x33, 0x95, 0x9c, 0x16, 0x5d, 0x47, 0x96, 0xdd, 0xb6, 0x6f, 0x20, 0x6c, 0x4d, 0x18, 0x55, 0x55,
+    0x44, 0x0d, 0xa8, 0x9b, 0xa6, 0x41, 0x76, 0xc9, 0x64, 0xe9, 0xe3, 0x1c, 0xc3, 0x20, 0x60, 0x1c,
+    0x82, 0xa0, 0x16, 0x45, 0x34, 0x0a, 0x17, 0x08, 0x6e, 0x60, 0x57, 0xe3, 0xf2, 0x0c, 0x02, 0x12,
+    0x32, 0x29, 0xed, 0xbd, 0x5b, 0xba, 0x9c, 0xd7, 0x57, 0x1c, 0x14, 0xfe, 0x6c, 0x65, 0x73, 0x5e,
+    0xfa, 0xb5, 0xb3, 0x1d, 0x8e, 0x5f, 0x0e, 0xc7, 0x43, 0xfd, 0xeb, 0x8f, 0x55, 0x68, 0x11, 0xad,
+    0x5a, 0xc8, 0x72, 0x09, 0x2a, 0x02, 0xfa, 0x9e, 0x24, 0xe4, 0x36, 0xc4, 0xe1, 0x25, 0x78, 0x89,
+    0x3a, 0x0c, 0x14, 0x7b, 0x4a, 0x34, 0x35, 0xdb, 0x6c, 0xd4, 0x65, 0xfa, 0x43, 0x64, 0x7d, 0x1b,
+    0x3c, 0xc5, 0x17, 0x91, 0x03, 0x2d, 0x3b, 0x1d, 0x5c, 0x7e, 0x2c, 0x74, 0xea, 0x6b, 0x75, 0xd4,
+    0x2b, 0xc5, 0xcd, 0xdf, 0xeb, 0x8f, 0xba, 0x60, 0x01, 0x6e, 0xfa, 0x2f, 0x2e, 0xd4, 0x0b, 0x87,
+    0x0c, 0xb0, 0x1b, 0x4d, 0x89, 0xa0, 0x09, 0x96, 0x41, 0xb0, 0x5c, 0x4f, 0xe3, 0x72, 0xe8, 0x9d,
+    0x52, 0x64, 0x8f, 0x43, 0x99, 0xc0, 0x10, 0x59, 0x54, 0xb1, 0x69, 0xb5, 0xe8, 0xf7, 0x10, 0xe8,
+    0x3c, 0xcb, 0x1f, 0xe7, 0x15, 0xee, 0x9e, 0x46, 0x40, 0x66, 0x9d, 0x01, 0x99, 0x65, 0x08, 0x24,
+    0x99, 0x42, 0x4f, 0x6f, 0x17, 0xa2, 0x7f, 0xaf, 0x13, 0xab, 0xae, 0xa3, 0xf5, 0x9c, 0x51, 0xd1,
+    0x76, 0x03, 0x1f, 0xc8, 0x24, 0x5a, 0x5b, 0x9e, 0xc0, 0x34, 0x56, 0x0d, 0x79, 0x35, 0x89, 0x67,
+    0xcc, 0xc4, 0x3e, 0x50, 0x6e, 0x56, 0x55, 0x30, 0x1d, 0x1a, 0xcf, 0x00, 0xcd, 0x6a, 0x58, 0x59,
+    0xad, 0xe2, 0xce, 0x98, 0x5e, 0x7e, 0x3e, 0x5d, 0x98, 0x87, 0x09, 0x1e, 0x45, 0xc5, 0xb9, 0x81,
+    0xf3, 0x20, 0xea, 0x2e, 0x64, 0x15, 0x59, 0x8c, 0x2e, 0x4d, 0x73, 0x4e, 0x21, 0x4f, 0x1d, 0x85,
+    0xce, 0x11, 0xb1, 0x36, 0xd2, 0xcc, 0xa9, 0xb7, 0xd6, 0x39, 0xb5, 0xc3, 0xbc, 0xd0, 0xc3, 0x1b,
+    0xa6, 0x79, 0xb7, 0x3b, 0x5e, 0x1f, 0xc6, 0x3f, 0x65, 0x98, 0x3e, 0xe1, 0x80, 0x23, 0xbb, 0x3e,
+    0x8b, 0xba, 0x81, 0x63, 0x2b, 0x1f, 0x97, 0xfe, 0xcd, 0x72, 0x08, 0x35, 0xb0, 0x64, 0x99, 0x59,
+    0x8e, 0xed, 0xf1, 0xf2, 0xf8, 0x31, 0x43, 0x7c, 0xc5, 0xc9, 0xa6, 0x1c, 0xe5, 0x82, 0x1b, 0x3b,
+    0x64, 0x61, 0x86, 0x2c, 0x61, 0x98, 0x91, 0xe5, 0x2b, 0x2e, 0x93, 0xe1, 0xbb, 0xfe, 0x5a, 0xb8,
+    0x11, 0x30, 0x6f, 0x93, 0x6d, 0x49, 0xab, 0x1b, 0x46, 0x02, 0x13, 0x96, 0x51, 0x0b, 0x9d, 0x21,
+    0x09, 0xf8, 0x36, 0x01, 0x1b, 0x03, 0xe3, 0x10, 0x2e, 0xa3, 0xe1, 0x27, 0x5e, 0xf6, 0x7c, 0x9d,
+    0xf1, 0xa3, 0xd1, 0xd8, 0xa8, 0xf9, 0x93, 0x1c, 0xca, 0x77, 0x4b, 0xc6, 0x19, 0xe9, 0x39, 0x72,
+    0x9f, 0x91, 0xb0, 0x1d, 0xb7, 0x5b, 0x19, 0x70, 0x9c, 0x20, 0x20, 0x55, 0x62, 0xb8, 0x6e, 0x26,
+    0x05, 0x71, 0x9e, 0xd2, 0xe7, 0xd1, 0x69, 0x08, 0xe8, 0xd1, 0xaa, 0xb4, 0x1a, 0x5f, 0xa8, 0xec,
+    0x1b, 0x5a, 0x98, 0xbe, 0xed, 0xee, 0xeb, 0xe1, 0xf6, 0xf8, 0xc7, 0x46, 0x62, 0x3d, 0xeb, 0x26,
+    0xf8, 0x80, 0x6b, 0xad, 0xad, 0x55, 0xb9, 0xfa, 0x94, 0xd0, 0x2c, 0x4e, 0xef, 0xd4, 0x7f, 0x2d,
+    0x21, 0x01, 0x36, 0xc4, 0xea, 0x1b, 0x9b, 0xe6, 0xb6, 0xc5, 0xd2, 0x8b, 0xba, 0x56, 0x4d, 0x00,
+    0x9a, 0x1f, 0x6d, 0x33, 0x42, 0xee, 0xae, 0x0d, 0x99, 0x62, 0x65, 0xdf, 0xe5, 0x25, 0x12, 0x31,
+    0x81, 0x2f, 0x4d, 0x2d, 0xf2, 0x28, 0xe5, 0x30, 0x24, 0x15, 0x93, 0xe7, 0xb2, 0x3d, 0x2a, 0xb7,
+    0x05, 0xcd, 0x66, 0x19, 0x05, 0x3c, 0xc3, 0xb5, 0x51, 0xf2, 0x65, 0x2a, 0xca, 0x5c, 0x4d, 0xea,
+    0xbc, 0xf5, 0xd4, 0xf2, 0xca, 0xd0, 0x78, 0xf7, 0x6d, 0xa4, 0x97, 0x1b, 0x91, 0x95, 0xff, 0xd8,
+    0xdc, 0x51, 0x69, 0x80, 0x23, 0x12, 0xd0, 0x66, 0xb6, 0xc7, 0xfe, 0x39, 0x70, 0xc4, 0xc7, 0xb1,
+    0x33, 0x63, 0x1c, 0x19, 0xb1, 0x1a, 0x96, 0x66, 0x8e, 0xee, 0x0a, 0x27, 0x38, 0xcc, 0x2c, 0xa9,
+    0xa2, 0x19, 0x1a, 0x52, 0xeb, 0x0e, 0x8d, 0xc6, 0xa7, 0x43, 0xa8, 0x6d, 0x58, 0x85, 0x54, 0x89,
+    0xb0, 0x1a, 0xdb, 0x50, 0x9b, 0xee, 0x0c, 0x0f, 0xf6, 0x4b, 0xfb, 0xc4, 0x6c, 0x0b, 0x3f, 0x6f,
+    0x13, 0x43, 0xc9, 0x97, 0xad, 0xa9, 0x4d, 0xe7, 0xce, 0x30, 0x76, 0x99, 0xf6, 0xc3, 0x4c, 0xd2,
+    0x80, 0x34, 0x9e, 0x8b, 0x6d, 0xde, 0xa4, 0x5b, 0x86, 0x44, 0x19, 0x4c, 0x59, 0xfd, 0x07, 0xde,
+    0xa7, 0xdc, 0x1a, 0x2b, 0x8d, 0x94, 0x2b, 0x9d, 0x1e, 0x76, 0x5a, 0x99, 0xba, 0x80, 0x54, 0x93,
+    0x61, 0x92, 0x88, 0xf9, 0xcd, 0xd1, 0x00, 0x2c, 0x63, 0x7b, 0xbc, 0x19, 0x77, 0x66, 0xf7, 0xfd,
+    0x7a, 0xdc, 0xc2, 0x52, 0x5e, 0x31, 0xad, 0xdf, 0xfe, 0x27, 0x82, 0x6c, 0x32, 0x59, 0xd4, 0xa2,
+    0xb2, 0x93, 0xd0, 0x26, 0xae, 0xce, 0x3f, 0x9f, 0xb2, 0x2e, 0xc5, 0xf2, 0x4f, 0x26, 0xea, 0x9e,
+    0xf5, 0x48, 0xdb, 0xce, 0x76, 0xf6, 0xfc, 0xf1, 0xf9, 0xa0, 0xbf, 0xbc, 0x3a, 0xe7, 0xf7, 0x0a,
+    0xf1, 0x3d, 0x1c, 0x3f, 0x22, 0xb0, 0x68, 0x86, 0x53, 0xc8, 0x84, 0xa3, 0x42, 0x3a, 0xdb, 0x22,
+    0x2c, 0x23, 0x31, 0x79, 0xb4, 0x7b, 0x15, 0x3d, 0x8c, 0xcc, 0xad, 0x55, 0xc7, 0x93, 0xa2, 0x8b,
+    0x82, 0x08, 0x3f, 0xd9, 0x51, 0x7d, 0x7b, 0x6c, 0x76, 0xd6, 0x37, 0x15, 0x25, 0x05, 0x58, 0x58,
+    0x1f, 0xd9, 0xc8, 0x8a, 0xbe, 0xe4, 0x83, 0xa9, 0x52, 0x46, 0xa4, 0x61, 0x7b, 0x6a, 0x8c, 0x70,
+    0x1e, 0x1f, 0xd0, 0xc0, 0x0f, 0xaa, 0x6e, 0x58, 0xfa, 0xd2, 0x3e, 0x12, 0x67, 0x95, 0xd4, 0x59,
+    0x6a, 0x13, 0x0a, 0x4d, 0x11, 0xdb, 0xbf, 0x4e, 0x38, 0x80, 0xf4, 0x72, 0x11, 0x8e, 0xdd, 0x59,
+    0xb6, 0x99, 0x96, 0x51, 0xf4, 0xd5, 0x72, 0xee, 0xae, 0x7f, 0x99, 0x24, 0xfd, 0x5f, 0xa4, 0x21,
+    0x02, 0x1e, 0x11, 0x10, 0x7e, 0x0e, 0x4c, 0x2c, 0xe7, 0x8d, 0xa1, 0xb0, 0x08, 0xb3, 0xb9, 0x95,
+    0x62, 0x59, 0xe3, 0xf7, 0x50, 0x5e, 0x1a, 0x06, 0xff, 0xb5, 0xf4, 0xe1, 0xbf, 0x8b, 0x78, 0x4a,
+    0x1e, 0x82, 0x1a, 0x00, 0x00,
+};
+
+static const ESPWebCAsset ESPWEBC_ICON_SPRITE = {"/icons.svg", "image/svg+xml", ESPWEBC_ICON_DATA, sizeof(ESPWEBC_ICON_DATA), "\"660870962520e32f\""};
+
+#endif // ESPWEBC_ICONS_H
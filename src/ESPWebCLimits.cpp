@@ -0,0 +1,119 @@
+#include "ESPWebCLimits.h"
+
+ESPWebCLimits::ESPWebCLimits() : lock(xSemaphoreCreateMutex())
+{
+    memset(buckets, 0, sizeof(buckets));
+}
+
+ESPWebCLimits::Verdict ESPWebCLimits::admit(uint32_t ip, Class cls, uint32_t &retryAfter)
+{
+    retryAfter = 1;
+
+    // Checked first and without the lock, it is the cheapest way out
+    if (minFreeHeap > 0 && ESP.getFreeHeap() < minFreeHeap)
+    {
+        rejectedHeap++;
+        retryAfter = 5;
+        return LOW_HEAP;
+    }
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    Verdict verdict = ADMIT;
+    if (maxRequests > 0 && active >= maxRequests)
+    {
+        rejectedBusy++;
+        verdict = BUSY;
+    }
+    else if (cls == RATED && !take(ip, retryAfter))
+    {
+        rejectedRate++;
+        verdict = RATE;
+    }
+    else
+    {
+        active++;
+    }
+    xSemaphoreGive(lock);
+    return verdict;
+}
+
+void ESPWebCLimits::release()
+{
+    xSemaphoreTake(lock, portMAX_DELAY);
+    if (active > 0)
+    {
+        active--;
+    }
+    xSemaphoreGive(lock);
+}
+
+bool ESPWebCLimits::allowRate(uint32_t ip)
+{
+    uint32_t retryAfter;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    bool allowed = take(ip, retryAfter);
+    if (!allowed)
+    {
+        rejectedRate++;
+    }
+    xSemaphoreGive(lock);
+    return allowed;
+}
+
+bool ESPWebCLimits::allowClient(size_t connected)
+{
+    if ((maxClients > 0 && connected > maxClients) || (minFreeHeap > 0 && ESP.getFreeHeap() < minFreeHeap))
+    {
+        rejectedClients++;
+        return false;
+    }
+    return true;
+}
+
+// Takes one token from the bucket of ip. Unknown clients replace the bucket
+// used least recently and start full.
+bool ESPWebCLimits::take(uint32_t ip, uint32_t &retryAfter)
+{
+    if (ratePerSec <= 0)
+    {
+        return true;
+    }
+
+    uint32_t now = millis();
+    Bucket *bucket = &buckets[0];
+    for (size_t i = 0; i < ESPWEBC_RATE_CLIENTS; i++)
+    {
+        if (buckets[i].ip == ip)
+        {
+            bucket = &buckets[i];
+            break;
+        }
+        if (now - buckets[i].last > now - bucket->last)
+        {
+            bucket = &buckets[i];
+        }
+    }
+
+    if (bucket->ip != ip)
+    {
+        bucket->ip = ip;
+        bucket->tokens = rateBurst;
+    }
+    else
+    {
+        bucket->tokens += (now - bucket->last) * ratePerSec / 1000.0f;
+        if (bucket->tokens > rateBurst)
+        {
+            bucket->tokens = rateBurst;
+        }
+    }
+    bucket->last = now;
+
+    if (bucket->tokens < 1.0f)
+    {
+        retryAfter = (uint32_t)((1.0f - bucket->tokens) / ratePerSec) + 1;
+        return false;
+    }
+    bucket->tokens -= 1.0f;
+    return true;
+}
@@ -0,0 +1,94 @@
+#ifndef ESPWEBC_LIMITS_H
+#define ESPWEBC_LIMITS_H
+
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+// Admission control for the web server. A request is refused before any
+// work is done when the heap is low, when too many requests are in flight,
+// or, for the polled and action routes, when its client IP ran out of
+// tokens. Every limit is disabled by setting it to 0.
+
+#ifndef ESPWEBC_MAX_REQUESTS
+#define ESPWEBC_MAX_REQUESTS 8 // concurrent HTTP requests
+#endif
+
+#ifndef ESPWEBC_MAX_WS_CLIENTS
+#define ESPWEBC_MAX_WS_CLIENTS 4 // WebSocket clients, and separately SSE clients
+#endif
+
+#ifndef ESPWEBC_MIN_FREE_HEAP
+#define ESPWEBC_MIN_FREE_HEAP 16384 // below this, non-essential requests get 503
+#endif
+
+#ifndef ESPWEBC_RATE_PER_SEC
+#define ESPWEBC_RATE_PER_SEC 10 // tokens per second per client IP
+#endif
+
+#ifndef ESPWEBC_RATE_BURST
+#define ESPWEBC_RATE_BURST 20
+#endif
+
+#ifndef ESPWEBC_RATE_CLIENTS
+#define ESPWEBC_RATE_CLIENTS 8 // client IPs tracked, the least recent is replaced
+#endif
+
+class ESPWebCLimits
+{
+public:
+    enum Class
+    {
+        PAGE,  // heap and concurrency limits
+        RATED  // also the per-IP token bucket: /allReadings, widget actions, /batch
+    };
+
+    enum Verdict
+    {
+        ADMIT,
+        BUSY,     // 503, too many requests in flight
+        LOW_HEAP, // 503
+        RATE      // 429
+    };
+
+    ESPWebCLimits();
+
+    // On ADMIT the request counts as in flight until release() is called.
+    // retryAfter is set to the seconds the client should wait otherwise.
+    Verdict admit(uint32_t ip, Class cls, uint32_t &retryAfter);
+    void release();
+
+    // Token bucket alone, for actions sent over the WebSocket
+    bool allowRate(uint32_t ip);
+
+    // New WebSocket or SSE client, connected includes the new one
+    bool allowClient(size_t connected);
+
+    uint16_t maxRequests = ESPWEBC_MAX_REQUESTS;
+    uint16_t maxClients = ESPWEBC_MAX_WS_CLIENTS;
+    uint32_t minFreeHeap = ESPWEBC_MIN_FREE_HEAP;
+    float ratePerSec = ESPWEBC_RATE_PER_SEC;
+    float rateBurst = ESPWEBC_RATE_BURST;
+
+    size_t inFlight() const { return active; }
+    uint32_t rejectedBusy = 0;
+    uint32_t rejectedHeap = 0;
+    uint32_t rejectedRate = 0;
+    uint32_t rejectedClients = 0;
+
+private:
+    struct Bucket
+    {
+        uint32_t ip;
+        uint32_t last; // millis() of the last refill
+        float tokens;
+    };
+
+    bool take(uint32_t ip, uint32_t &retryAfter);
+
+    Bucket buckets[ESPWEBC_RATE_CLIENTS];
+    size_t active = 0;
+    SemaphoreHandle_t lock;
+};
+
+#endif // ESPWEBC_LIMITS_H
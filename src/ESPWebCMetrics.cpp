@@ -0,0 +1,118 @@
+#include "ESPWebCMetrics.h"
+
+// Upper bounds of the latency buckets in microseconds, the last one is +Inf.
+static const uint32_t METRICS_BOUNDS_US[ESPWEBC_METRICS_BUCKETS - 1] = {1000, 5000, 10000, 50000, 100000, 500000, 1000000};
+
+int ESPWebCMetrics::addRoute(const char *name)
+{
+    for (size_t i = 0; i < routes.size(); i++)
+    {
+        if (strcmp(routes[i].name, name) == 0)
+        {
+            return i;
+        }
+    }
+    Route route = {};
+    route.name = name;
+    routes.push_back(route);
+    return routes.size() - 1;
+}
+
+void ESPWebCMetrics::record(int route, uint32_t micros)
+{
+    if (route < 0 || (size_t)route >= routes.size())
+    {
+        return;
+    }
+    size_t bucket = 0;
+    while (bucket < ESPWEBC_METRICS_BUCKETS - 1 && micros > METRICS_BOUNDS_US[bucket])
+    {
+        bucket++;
+    }
+    portENTER_CRITICAL(&mux);
+    Route &r = routes[route];
+    r.buckets[bucket]++;
+    r.count++;
+    r.sumUs += micros;
+    portEXIT_CRITICAL(&mux);
+}
+
+void ESPWebCMetrics::writeRoutes(Print &out) const
+{
+    // Copied under the lock, printing may allocate
+    std::vector<Route> copy(routes.size());
+    portENTER_CRITICAL(&mux);
+    for (size_t i = 0; i < routes.size(); i++)
+    {
+        copy[i] = routes[i];
+    }
+    portEXIT_CRITICAL(&mux);
+
+    out.print("# HELP espwebc_http_requests_total Requests handled per route.\n");
+    out.print("# TYPE espwebc_http_requests_total counter\n");
+    for (const Route &r : copy)
+    {
+        out.print("espwebc_http_requests_total{route=");
+        writeLabel(out, r.name);
+        out.printf("} %u\n", (unsigned)r.count);
+    }
+
+    out.print("# HELP espwebc_http_handler_seconds Time spent in the request handler.\n");
+    out.print("# TYPE espwebc_http_handler_seconds histogram\n");
+    for (const Route &r : copy)
+    {
+        uint32_t cumulative = 0;
+        for (size_t b = 0; b < ESPWEBC_METRICS_BUCKETS; b++)
+        {
+            cumulative += r.buckets[b];
+            out.print("espwebc_http_handler_seconds_bucket{route=");
+            writeLabel(out, r.name);
+            if (b < ESPWEBC_METRICS_BUCKETS - 1)
+            {
+                out.printf(",le=\"%g\"} %u\n", METRICS_BOUNDS_US[b] / 1e6, (unsigned)cumulative);
+            }
+            else
+            {
+                out.printf(",le=\"+Inf\"} %u\n", (unsigned)cumulative);
+            }
+        }
+        out.print("espwebc_http_handler_seconds_sum{route=");
+        writeLabel(out, r.name);
+        out.printf("} %.6f\n", r.sumUs / 1e6);
+        out.print("espwebc_http_handler_seconds_count{route=");
+        writeLabel(out, r.name);
+        out.printf("} %u\n", (unsigned)r.count);
+    }
+}
+
+void ESPWebCMetrics::writeGauge(Print &out, const char *name, const char *help, double value)
+{
+    out.printf("# HELP %s %s\n# TYPE %s gauge\n%s %.10g\n", name, help, name, name, value);
+}
+
+void ESPWebCMetrics::writeCounter(Print &out, const char *name, const char *help, double value)
+{
+    out.printf("# HELP %s %s\n# TYPE %s counter\n%s %.10g\n", name, help, name, name, value);
+}
+
+void ESPWebCMetrics::writeLabel(Print &out, const char *value)
+{
+    out.print('"');
+    for (const char *c = value; *c; c++)
+    {
+        if (*c == '\\' || *c == '"')
+        {
+            out.print('\\');
+            out.print(*c);
+        }
+        else if (*c == '\n')
+        {
+            out.print("\\n");
+        }
+        else
+        {
+            out.print(*c);
+        }
+    }
+    out.print('"');
+}
@@ -0,0 +1,47 @@
+#ifndef ESPWEBC_METRICS_H
+#define ESPWEBC_METRICS_H
+
+#include <Arduino.h>
+#include <atomic>
+#include <vector>
+
+// Per-route request counters and latency histograms plus a few library
+// counters, written out in Prometheus text format on /metrics.
+// Recording is a handful of integer updates, everything else is computed
+// only when the endpoint is scraped. Requests are recorded from the web
+// server task and counters bumped from the loop as well, so both are
+// lock-free or guarded by a spinlock.
+
+#define ESPWEBC_METRICS_BUCKETS 8
+
+class ESPWebCMetrics
+{
+public:
+    int addRoute(const char *name);
+    void record(int route, uint32_t micros);
+
+    void writeRoutes(Print &out) const;
+    static void writeGauge(Print &out, const char *name, const char *help, double value);
+    static void writeCounter(Print &out, const char *name, const char *help, double value);
+    static void writeLabel(Print &out, const char *value); // quoted, backslash, quote and newline escaped
+
+    std::atomic<uint32_t> wsSent{0};
+    std::atomic<uint32_t> wsReceived{0};
+    std::atomic<uint32_t> mqttPublished{0};
+    std::atomic<uint32_t> mqttReceived{0};
+    std::atomic<uint32_t> mqttReconnects{0};
+
+private:
+    struct Route
+    {
+        const char *name;
+        uint32_t count;
+        uint64_t sumUs;
+        uint32_t buckets[ESPWEBC_METRICS_BUCKETS];
+    };
+
+    std::vector<Route> routes; // only grows during setup
+    mutable portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+};
+
+#endif // ESPWEBC_METRICS_H
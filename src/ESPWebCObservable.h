@@ -0,0 +1,136 @@
+#ifndef ESPWEBC_OBSERVABLE_H
+#define ESPWEBC_OBSERVABLE_H
+
+#include <Arduino.h>
+#include <vector>
+
+// Change tracking for widget values. A widget registered with an
+// Observable<T> instead of a raw pointer sets its bit in the dashboard's
+// dirty set when a different value is assigned, so the WebSocket push sends
+// only what changed instead of reading and comparing every widget.
+//
+//   Observable<float> temperature;
+//   webConnect.addSensor("temp", "Temperature", "", "fa fa-thermometer", &temperature, "C");
+//   temperature = dht.readTemperature(); // marks "temp" changed if the value differs
+
+// Bitset of element indices, set from any task. The words are only resized
+// while widgets are registered.
+class ESPWebCDirtySet
+{
+public:
+    void resize(size_t count) { bits.resize((count + 31) / 32, 0); }
+
+    // A second set receiving every set(), for another consumer of the changes
+    void mirrorTo(ESPWebCDirtySet *other) { mirror = other; }
+
+    void set(size_t index)
+    {
+        if (index / 32 < bits.size())
+        {
+            __atomic_fetch_or(&bits[index / 32], 1UL << (index % 32), __ATOMIC_RELAXED);
+        }
+        if (mirror)
+        {
+            mirror->set(index);
+        }
+    }
+
+    // Clears the set, ORing its bits into out (resized to match)
+    void take(std::vector<uint32_t> &out)
+    {
+        out.resize(bits.size(), 0);
+        for (size_t i = 0; i < bits.size(); i++)
+        {
+            out[i] |= __atomic_exchange_n(&bits[i], 0, __ATOMIC_RELAXED);
+        }
+    }
+
+    // Clears the set, ORing its bits into other
+    void moveTo(ESPWebCDirtySet &other)
+    {
+        for (size_t i = 0; i < bits.size() && i < other.bits.size(); i++)
+        {
+            uint32_t word = __atomic_exchange_n(&bits[i], 0, __ATOMIC_RELAXED);
+            if (word)
+            {
+                __atomic_fetch_or(&other.bits[i], word, __ATOMIC_RELAXED);
+            }
+        }
+    }
+
+private:
+    std::vector<uint32_t> bits;
+    ESPWebCDirtySet *mirror = nullptr;
+};
+
+// Binding to a widget, set by ESPWebConnect when the value is registered
+class ESPWebCObservableBase
+{
+public:
+    // For changes made through get(), eg: a String edited in place
+    void touch()
+    {
+        if (dirty)
+        {
+            dirty->set(index);
+        }
+    }
+
+protected:
+    ESPWebCObservableBase() = default;
+    ESPWebCObservableBase(const ESPWebCObservableBase &) = delete; // bound by address
+    ESPWebCObservableBase &operator=(const ESPWebCObservableBase &) = delete;
+
+private:
+    ESPWebCDirtySet *dirty = nullptr;
+    size_t index = 0;
+    friend class ESPWebConnect;
+};
+
+template <typename T>
+class ESPWebCObservable : public ESPWebCObservableBase
+{
+public:
+    ESPWebCObservable() : value() {}
+    ESPWebCObservable(const T &initial) : value(initial) {}
+
+    ESPWebCObservable &operator=(const T &v)
+    {
+        if (!(value == v))
+        {
+            value = v;
+            touch();
+        }
+        return *this;
+    }
+
+    operator const T &() const { return value; }
+    const T &get() const { return value; }
+    T &get() { return value; } // call touch() after changing it
+
+    ESPWebCObservable &operator+=(const T &v) { return *this = value + v; }
+    ESPWebCObservable &operator-=(const T &v) { return *this = value - v; }
+    ESPWebCObservable &operator++() { return *this = value + 1; }
+    ESPWebCObservable &operator--() { return *this = value - 1; }
+    T operator++(int)
+    {
+        T old = value;
+        *this = value + 1;
+        return old;
+    }
+    T operator--(int)
+    {
+        T old = value;
+        *this = value - 1;
+        return old;
+    }
+
+private:
+    T value;
+    friend class ESPWebConnect;
+};
+
+template <typename T>
+using Observable = ESPWebCObservable<T>;
+
+#endif // ESPWEBC_OBSERVABLE_H
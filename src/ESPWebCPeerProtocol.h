@@ -0,0 +1,274 @@
+#ifndef ESPWEBC_PEER_PROTOCOL_H
+#define ESPWEBC_PEER_PROTOCOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "ESPWebCSha256.h"
+
+// UDP packets exchanged between ESPWebConnect nodes. This header has no
+// Arduino dependency so host tools (extras/peer_sim.cpp) share it.
+//
+// Every packet: 'E' 'P' version type | str node
+//   ANNOUNCE        : u8 flags | u32 widgets version      (multicast, periodic)
+//   WIDGETS_REQUEST : -                                    (aggregator -> node)
+//   WIDGETS         : u32 version | u8 count | count x (str id | str name | str unit | str icon | u8 value type)
+//   READINGS        : u8 count | count x (str id | u8 value type | value)
+// str is a u8 length and the bytes, no terminator. Numbers are little
+// endian, a value is i32, f32, u8 (bool) or str depending on its type.
+// Replies go to the source address and port of the packet they answer.
+//
+// With a site key, the type has the SIGNED bit and the packet ends with the
+// first TAG_SIZE bytes of HMAC-SHA256(key, packet before the tag). Nodes
+// with a key drop packets without a valid tag, nodes without one drop
+// signed packets. The tag authenticates, it does not hide the readings nor
+// stop a captured packet from being sent again.
+
+namespace ESPWebCPeer
+{
+    static const uint8_t VERSION = 1;
+    static const uint8_t GROUP[4] = {239, 255, 87, 67};
+    static const uint16_t PORT = 4210;
+    static const size_t MAX_PACKET = 1400; // stays in one Wi-Fi frame
+    static const uint8_t SIGNED = 0x80;    // type bit of packets with a tag
+    static const size_t TAG_SIZE = 16;
+
+    enum Type
+    {
+        ANNOUNCE = 1,
+        WIDGETS_REQUEST = 2,
+        WIDGETS = 3,
+        READINGS = 4
+    };
+
+    enum ValueType
+    {
+        INT = 0,
+        FLOAT = 1,
+        BOOL = 2,
+        TEXT = 3
+    };
+
+    enum Flags
+    {
+        AGGREGATOR = 1
+    };
+
+    // Bounded writer, ok() turns false instead of writing past the end
+    class Writer
+    {
+    public:
+        Writer(uint8_t *buffer, size_t capacity) : buffer(buffer), capacity(capacity), used(0), good(true) {}
+
+        void header(Type type, const char *node)
+        {
+            u8('E');
+            u8('P');
+            u8(VERSION);
+            u8(type);
+            str(node);
+        }
+
+        void u8(uint8_t v)
+        {
+            if (used + 1 > capacity)
+            {
+                good = false;
+                return;
+            }
+            buffer[used++] = v;
+        }
+
+        void u32(uint32_t v)
+        {
+            for (int i = 0; i < 4; i++)
+            {
+                u8((v >> (8 * i)) & 0xFF);
+            }
+        }
+
+        void i32(int32_t v) { u32((uint32_t)v); }
+
+        void f32(float v)
+        {
+            uint32_t bits;
+            memcpy(&bits, &v, sizeof(bits));
+            u32(bits);
+        }
+
+        void str(const char *s, size_t len)
+        {
+            if (len > 255)
+            {
+                len = 255;
+            }
+            u8((uint8_t)len);
+            if (used + len > capacity)
+            {
+                good = false;
+                return;
+            }
+            memcpy(buffer + used, s, len);
+            used += len;
+        }
+
+        void str(const char *s) { str(s ? s : "", s ? strlen(s) : 0); }
+
+        // Undo a partly written entry that did not fit
+        void rewind(size_t length)
+        {
+            used = length;
+            good = true;
+        }
+
+        void patch(size_t offset, uint8_t v) { buffer[offset] = v; }
+
+        bool ok() const { return good; }
+        size_t length() const { return used; }
+        const uint8_t *data() const { return buffer; }
+
+    private:
+        uint8_t *buffer;
+        size_t capacity;
+        size_t used;
+        bool good;
+    };
+
+    // The site key, the hash of a shared secret
+    class Key
+    {
+    public:
+        Key() : set(false) {}
+
+        // nullptr or "" clears it
+        void assign(const char *secret)
+        {
+            set = secret && *secret;
+            if (set)
+            {
+                ESPWebCSha256::hash(secret, strlen(secret), bytes);
+            }
+        }
+
+        bool enabled() const { return set; }
+
+        // Marks and tags a packet written to buffer (room for TAG_SIZE more
+        // bytes), returns the length to send
+        size_t sign(uint8_t *packet, size_t length) const
+        {
+            if (!set || length < 4)
+            {
+                return length;
+            }
+            packet[3] |= SIGNED;
+            uint8_t mac[ESPWebCSha256::SIZE];
+            ESPWebCSha256::hmac(bytes, sizeof(bytes), packet, length, mac);
+            memcpy(packet + length, mac, TAG_SIZE);
+            return length + TAG_SIZE;
+        }
+
+        // Checks a received packet and strips its tag and SIGNED bit, false
+        // if it is to be dropped
+        bool open(uint8_t *packet, size_t &length) const
+        {
+            bool tagged = length >= 4 && (packet[3] & SIGNED);
+            if (!set || !tagged)
+            {
+                return !set && !tagged;
+            }
+            if (length < 4 + TAG_SIZE)
+            {
+                return false;
+            }
+            length -= TAG_SIZE;
+            uint8_t mac[ESPWebCSha256::SIZE];
+            ESPWebCSha256::hmac(bytes, sizeof(bytes), packet, length, mac);
+            uint8_t diff = 0;
+            for (size_t i = 0; i < TAG_SIZE; i++)
+            {
+                diff |= mac[i] ^ packet[length + i];
+            }
+            packet[3] &= ~SIGNED;
+            return diff == 0;
+        }
+
+    private:
+        uint8_t bytes[ESPWebCSha256::SIZE];
+        bool set;
+    };
+
+    class Reader
+    {
+    public:
+        Reader(const uint8_t *data, size_t length) : data(data), size(length), pos(0), good(true) {}
+
+        // Checks magic and version, returns the type or 0
+        uint8_t header(const char *&node, uint8_t &nodeLen)
+        {
+            node = "";
+            nodeLen = 0;
+            if (u8() != 'E' || u8() != 'P' || u8() != VERSION)
+            {
+                good = false;
+                return 0;
+            }
+            uint8_t type = u8();
+            str(node, nodeLen);
+            return good ? type : 0;
+        }
+
+        uint8_t u8()
+        {
+            if (pos + 1 > size)
+            {
+                good = false;
+                return 0;
+            }
+            return data[pos++];
+        }
+
+        uint32_t u32()
+        {
+            uint32_t v = 0;
+            for (int i = 0; i < 4; i++)
+            {
+                v |= (uint32_t)u8() << (8 * i);
+            }
+            return v;
+        }
+
+        int32_t i32() { return (int32_t)u32(); }
+
+        float f32()
+        {
+            uint32_t bits = u32();
+            float v;
+            memcpy(&v, &bits, sizeof(v));
+            return v;
+        }
+
+        // Points into the packet, not NUL-terminated
+        void str(const char *&s, uint8_t &len)
+        {
+            len = u8();
+            if (pos + len > size)
+            {
+                good = false;
+                len = 0;
+            }
+            s = (const char *)data + pos;
+            pos += len;
+        }
+
+        bool ok() const { return good; }
+        size_t offset() const { return pos; }
+
+    private:
+        const uint8_t *data;
+        size_t size;
+        size_t pos;
+        bool good;
+    };
+}
+
+#endif // ESPWEBC_PEER_PROTOCOL_H
@@ -0,0 +1,295 @@
+#include "ESPWebCPeers.h"
+#include <ArduinoJson.h>
+
+using namespace ESPWebCPeer;
+
+ESPWebCPeers::ESPWebCPeers() : lock(xSemaphoreCreateMutex())
+{
+}
+
+// Node names end up in widget ids, keep them to [a-z0-9-]
+void ESPWebCPeers::configure(const char *nodeName, bool aggregator)
+{
+    size_t len = 0;
+    for (const char *s = nodeName; s && *s && len < sizeof(name) - 1; s++)
+    {
+        char c = (*s >= 'A' && *s <= 'Z') ? *s + 32 : *s;
+        name[len++] = ((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9')) ? c : '-';
+    }
+    name[len] = 0;
+    isAggregator = aggregator;
+}
+
+bool ESPWebCPeers::begin()
+{
+    if (!udp.beginMulticast(IPAddress(GROUP[0], GROUP[1], GROUP[2], GROUP[3]), PORT))
+    {
+        return false;
+    }
+    running = true;
+    lastAnnounce = millis() - ESPWEBC_PEER_ANNOUNCE_MS; // announce right away
+#ifdef ENABLE_DEBUG
+    Serial.printf("Peers: %s started as %s%s\n", name, isAggregator ? "aggregator" : "node", key.enabled() ? ", signed" : "");
+#endif
+    return true;
+}
+
+void ESPWebCPeers::stop()
+{
+    udp.stop();
+    running = false;
+    haveAggregator = false;
+}
+
+void ESPWebCPeers::onEncode(Encoder widgets, Encoder readings)
+{
+    widgetsEncoder = widgets;
+    readingsEncoder = readings;
+}
+
+void ESPWebCPeers::loop(uint32_t widgetsVersion, unsigned long readingsInterval)
+{
+    if (!running)
+    {
+        return;
+    }
+
+    uint32_t now = millis();
+    receive(now);
+
+    if (now - lastAnnounce >= ESPWEBC_PEER_ANNOUNCE_MS || widgetsVersion != announcedVersion)
+    {
+        lastAnnounce = now;
+        sendAnnounce(widgetsVersion);
+        if (isAggregator)
+        {
+            expire(now);
+        }
+    }
+
+    if (haveAggregator && now - aggregatorSeen > ESPWEBC_PEER_TIMEOUT_MS)
+    {
+        haveAggregator = false;
+    }
+    if (haveAggregator && now - lastReadings >= readingsInterval)
+    {
+        lastReadings = now;
+        send(aggregatorIp, aggregatorPort, READINGS, &readingsEncoder);
+    }
+}
+
+void ESPWebCPeers::receive(uint32_t now)
+{
+    // A few packets per loop, the rest waits in the socket
+    for (int n = 0; n < 8 && udp.parsePacket() > 0; n++)
+    {
+        int received = udp.read(packet, sizeof(packet));
+        size_t len = received > 0 ? received : 0;
+        if (!key.open(packet, len))
+        {
+            packetsDropped++;
+            continue;
+        }
+        Reader in(packet, len);
+        const char *node;
+        uint8_t nodeLen;
+        uint8_t type = in.header(node, nodeLen);
+        if (type == 0)
+        {
+            packetsDropped++;
+            continue;
+        }
+        if (nodeLen == strlen(name) && memcmp(node, name, nodeLen) == 0)
+        {
+            continue; // our own multicast
+        }
+        packetsReceived++;
+
+        if (type == ANNOUNCE)
+        {
+            uint8_t flags = in.u8();
+            uint32_t version = in.u32();
+            if (!in.ok())
+            {
+                packetsDropped++;
+            }
+            else if ((flags & AGGREGATOR) && !isAggregator)
+            {
+                aggregatorIp = udp.remoteIP();
+                aggregatorPort = udp.remotePort();
+                aggregatorSeen = now;
+                haveAggregator = true;
+            }
+            else if (isAggregator)
+            {
+                xSemaphoreTake(lock, portMAX_DELAY);
+                Peer *peer = findPeer(node, nodeLen, true);
+                bool stale = false;
+                if (peer)
+                {
+                    peer->ip = udp.remoteIP();
+                    peer->port = udp.remotePort();
+                    peer->lastSeen = now;
+                    peer->widgetsVersion = version;
+                    stale = peer->widgets.empty() || peer->widgetsReceived != version;
+                }
+                xSemaphoreGive(lock);
+
+                if (!peer)
+                {
+                    packetsDropped++;
+                }
+                else if (stale)
+                {
+                    send(udp.remoteIP(), udp.remotePort(), WIDGETS_REQUEST, nullptr);
+                }
+            }
+        }
+        else if (type == WIDGETS_REQUEST)
+        {
+            send(udp.remoteIP(), udp.remotePort(), WIDGETS, &widgetsEncoder);
+        }
+        else if (type == WIDGETS && isAggregator)
+        {
+            uint32_t version = in.u32();
+            xSemaphoreTake(lock, portMAX_DELAY);
+            Peer *peer = in.ok() ? findPeer(node, nodeLen, false) : nullptr;
+            if (peer)
+            {
+                peer->widgets.assign(packet + in.offset(), packet + len);
+                peer->widgetsReceived = version;
+                peersVersion++;
+            }
+            xSemaphoreGive(lock);
+            if (!peer)
+            {
+                packetsDropped++;
+            }
+        }
+        else if (type == READINGS && isAggregator)
+        {
+            // Readings can come before the next announce of a node that was
+            // already running, the widgets are asked for right away then
+            xSemaphoreTake(lock, portMAX_DELAY);
+            Peer *peer = findPeer(node, nodeLen, true);
+            bool unknown = false;
+            if (peer)
+            {
+                peer->ip = udp.remoteIP();
+                peer->port = udp.remotePort();
+                peer->lastSeen = now;
+                peer->readings.assign(packet + in.offset(), packet + len);
+                unknown = peer->widgets.empty();
+                updateCapacity();
+            }
+            xSemaphoreGive(lock);
+
+            if (!peer)
+            {
+                packetsDropped++;
+            }
+            else if (unknown)
+            {
+                send(udp.remoteIP(), udp.remotePort(), WIDGETS_REQUEST, nullptr);
+            }
+        }
+        else
+        {
+            packetsDropped++;
+        }
+    }
+}
+
+void ESPWebCPeers::send(IPAddress ip, uint16_t port, Type type, const Encoder *entries)
+{
+    Writer out(packet, sizeof(packet) - TAG_SIZE);
+    out.header(type, name);
+    if (type == WIDGETS)
+    {
+        out.u32(announcedVersion);
+    }
+    if (entries && *entries)
+    {
+        (*entries)(out);
+    }
+
+    udp.beginPacket(ip, port);
+    udp.write(packet, key.sign(packet, out.length()));
+    udp.endPacket();
+    packetsSent++;
+}
+
+void ESPWebCPeers::sendAnnounce(uint32_t widgetsVersion)
+{
+    announcedVersion = widgetsVersion;
+    Writer out(packet, sizeof(packet) - TAG_SIZE);
+    out.header(ANNOUNCE, name);
+    out.u8(isAggregator ? AGGREGATOR : 0);
+    out.u32(widgetsVersion);
+
+    udp.beginMulticastPacket();
+    udp.write(packet, key.sign(packet, out.length()));
+    udp.endPacket();
+    packetsSent++;
+}
+
+// Called with the lock held
+ESPWebCPeers::Peer *ESPWebCPeers::findPeer(const char *node, uint8_t len, bool create)
+{
+    for (Peer &peer : peers)
+    {
+        if (strlen(peer.name) == len && memcmp(peer.name, node, len) == 0)
+        {
+            return &peer;
+        }
+    }
+    if (!create || peers.size() >= ESPWEBC_PEER_MAX || len == 0 || len >= sizeof(Peer::name))
+    {
+        return nullptr;
+    }
+
+    peers.push_back(Peer());
+    Peer &peer = peers.back();
+    memcpy(peer.name, node, len);
+    peer.name[len] = 0;
+    peer.widgetsReceived = 0;
+    peersVersion++;
+    return &peer;
+}
+
+void ESPWebCPeers::expire(uint32_t now)
+{
+    xSemaphoreTake(lock, portMAX_DELAY);
+    size_t before = peers.size();
+    for (size_t i = peers.size(); i-- > 0;)
+    {
+        if (now - peers[i].lastSeen > ESPWEBC_PEER_TIMEOUT_MS)
+        {
+#ifdef ENABLE_DEBUG
+            Serial.printf("Peers: %s left\n", peers[i].name);
+#endif
+            peers.erase(peers.begin() + i);
+        }
+    }
+    if (peers.size() != before)
+    {
+        peersVersion++;
+        updateCapacity();
+    }
+    xSemaphoreGive(lock);
+}
+
+// Called with the lock held. Keys ("<node>_<id>-val") and text values are
+// copied into the document, the first byte of a READINGS body is its count.
+void ESPWebCPeers::updateCapacity()
+{
+    size_t total = 0;
+    for (const Peer &peer : peers)
+    {
+        if (!peer.readings.empty())
+        {
+            total += peer.readings.size() * 2 + peer.readings[0] * (JSON_OBJECT_SIZE(1) + strlen(peer.name) + 8);
+        }
+    }
+    capacity = total;
+}
@@ -0,0 +1,120 @@
+#ifndef ESPWEBC_PEERS_H
+#define ESPWEBC_PEERS_H
+
+#include <Arduino.h>
+#include <WiFiUdp.h>
+#include <functional>
+#include <vector>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "ESPWebCPeerProtocol.h"
+
+// Node discovery and reading exchange over UDP, see ESPWebCPeerProtocol.h.
+//
+// Every node announces itself on the multicast group. Once a node heard an
+// aggregator it sends its widget list when asked and its readings every
+// interval, unicast to that aggregator. The aggregator keeps the last
+// packets of each peer as received and decodes them when a dashboard asks.
+
+#ifndef ESPWEBC_PEER_MAX
+#define ESPWEBC_PEER_MAX 16
+#endif
+
+#ifndef ESPWEBC_PEER_ANNOUNCE_MS
+#define ESPWEBC_PEER_ANNOUNCE_MS 5000
+#endif
+
+#ifndef ESPWEBC_PEER_TIMEOUT_MS
+#define ESPWEBC_PEER_TIMEOUT_MS (3 * ESPWEBC_PEER_ANNOUNCE_MS) // peer or aggregator forgotten after this silence
+#endif
+
+class ESPWebCPeers
+{
+public:
+    // Writes the entries of a WIDGETS or READINGS packet after its header
+    typedef std::function<void(ESPWebCPeer::Writer &out)> Encoder;
+
+    struct Peer
+    {
+        char name[32];
+        IPAddress ip;
+        uint16_t port;
+        uint32_t lastSeen;
+        uint32_t widgetsVersion;  // announced
+        std::vector<uint8_t> widgets;  // WIDGETS entries, empty until received
+        uint32_t widgetsReceived; // version of the stored entries
+        std::vector<uint8_t> readings; // READINGS entries
+    };
+
+    ESPWebCPeers();
+
+    void configure(const char *nodeName, bool aggregator);
+    // Shared secret of the site, packets are signed and checked with it
+    void setKey(const char *secret) { key.assign(secret); }
+    bool signedPackets() const { return key.enabled(); }
+    bool configured() const { return name[0] != 0; }
+    bool started() const { return running; }
+    bool begin();
+    void stop();
+
+    void onEncode(Encoder widgets, Encoder readings);
+
+    // Call from the loop. widgetsVersion changes whenever the local widgets do.
+    void loop(uint32_t widgetsVersion, unsigned long readingsInterval);
+
+    bool aggregator() const { return isAggregator; }
+    const char *nodeName() const { return name; }
+
+    // Changes when a peer joins, leaves or sends new widgets
+    uint32_t version() const { return peersVersion; }
+    // Room the peers' readings need in a JSON document
+    size_t jsonCapacity() const { return capacity; }
+
+    // Runs f(const Peer &) for every peer with the table locked
+    template <typename F>
+    void visit(F f)
+    {
+        xSemaphoreTake(lock, portMAX_DELAY);
+        for (const Peer &peer : peers)
+        {
+            f(peer);
+        }
+        xSemaphoreGive(lock);
+    }
+
+    uint32_t packetsSent = 0;
+    uint32_t packetsReceived = 0;
+    uint32_t packetsDropped = 0; // malformed, unknown, unsigned or from a full table
+
+private:
+    void receive(uint32_t now);
+    void send(IPAddress ip, uint16_t port, ESPWebCPeer::Type type, const Encoder *entries);
+    void sendAnnounce(uint32_t widgetsVersion);
+    Peer *findPeer(const char *node, uint8_t len, bool create);
+    void expire(uint32_t now);
+    void updateCapacity();
+
+    WiFiUDP udp;
+    bool running = false;
+    bool isAggregator = false;
+    char name[32] = {0};
+    ESPWebCPeer::Key key;
+    Encoder widgetsEncoder;
+    Encoder readingsEncoder;
+
+    IPAddress aggregatorIp;
+    uint16_t aggregatorPort = 0;
+    uint32_t aggregatorSeen = 0;
+    bool haveAggregator = false;
+    uint32_t lastAnnounce = 0;
+    uint32_t lastReadings = 0;
+    uint32_t announcedVersion = 0;
+
+    std::vector<Peer> peers;
+    uint32_t peersVersion = 0;
+    size_t capacity = 0;
+    SemaphoreHandle_t lock;
+    uint8_t packet[ESPWebCPeer::MAX_PACKET];
+};
+
+#endif // ESPWEBC_PEERS_H
@@ -0,0 +1,197 @@
+#include "ESPWebCScheduler.h"
+
+ESPWebCScheduler::ESPWebCScheduler() : lock(xSemaphoreCreateMutex())
+{
+}
+
+uint16_t ESPWebCScheduler::every(uint32_t periodMs, Callback fn)
+{
+    return add(periodMs, periodMs ? periodMs : 1, nullptr, nullptr, fn);
+}
+
+uint16_t ESPWebCScheduler::every(uint32_t periodMs, ArgCallback fn, void *arg)
+{
+    return add(periodMs, periodMs ? periodMs : 1, fn, arg, nullptr);
+}
+
+uint16_t ESPWebCScheduler::after(uint32_t delayMs, Callback fn)
+{
+    return add(delayMs, 0, nullptr, nullptr, fn);
+}
+
+uint16_t ESPWebCScheduler::after(uint32_t delayMs, ArgCallback fn, void *arg)
+{
+    return add(delayMs, 0, fn, arg, nullptr);
+}
+
+uint16_t ESPWebCScheduler::add(uint32_t delayMs, uint32_t periodMs, ArgCallback fn, void *arg, Callback plain)
+{
+    if (fn == nullptr && plain == nullptr)
+    {
+        return 0;
+    }
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    if (count + (runningId ? 1 : 0) >= ESPWEBC_MAX_TIMERS) // the running one keeps its slot
+    {
+        xSemaphoreGive(lock);
+        return 0;
+    }
+    Timer timer;
+    timer.due = millis() + delayMs;
+    timer.period = periodMs;
+    timer.fn = fn;
+    timer.arg = arg;
+    timer.plain = plain;
+    do
+    {
+        timer.id = nextId++;
+        if (nextId == 0)
+        {
+            nextId = 1; // 0 means no timer
+        }
+    } while (inUse(timer.id)); // after a wrap, a long lived timer may still hold it
+    push(timer);
+    xSemaphoreGive(lock);
+    return timer.id;
+}
+
+bool ESPWebCScheduler::cancel(uint16_t id)
+{
+    xSemaphoreTake(lock, portMAX_DELAY);
+    bool found = false;
+    if (id != 0 && id == runningId)
+    {
+        runningCancelled = true; // not re-armed when its callback returns
+        found = true;
+    }
+    for (size_t i = 0; i < count && !found; i++)
+    {
+        if (heap[i].id == id)
+        {
+            removeAt(i);
+            found = true;
+        }
+    }
+    xSemaphoreGive(lock);
+    return found;
+}
+
+void ESPWebCScheduler::run(uint32_t now)
+{
+    // Bounded, after(0, ...) from a callback waits for the next call
+    for (size_t n = 0; n < ESPWEBC_MAX_TIMERS; n++)
+    {
+        xSemaphoreTake(lock, portMAX_DELAY);
+        if (count == 0 || (int32_t)(now - heap[0].due) < 0)
+        {
+            xSemaphoreGive(lock);
+            return;
+        }
+        Timer timer = heap[0];
+        removeAt(0);
+        runningId = timer.id;
+        runningCancelled = false;
+        xSemaphoreGive(lock);
+
+        uint32_t late = now - timer.due;
+        runs++;
+        lateMs += late;
+        if (late > maxLateMs)
+        {
+            maxLateMs = late;
+        }
+
+        if (timer.fn)
+        {
+            timer.fn(timer.arg);
+        }
+        else
+        {
+            timer.plain();
+        }
+        now = millis(); // the callback took time, the next timers are due against it
+
+        xSemaphoreTake(lock, portMAX_DELAY);
+        if (timer.period > 0 && !runningCancelled)
+        {
+            uint32_t missed = (now - timer.due) / timer.period;
+            overruns += missed;
+            timer.due += (missed + 1) * timer.period;
+            push(timer); // its slot was freed above
+        }
+        runningId = 0;
+        xSemaphoreGive(lock);
+    }
+}
+
+// Called with the lock held
+bool ESPWebCScheduler::inUse(uint16_t id) const
+{
+    if (id == runningId)
+    {
+        return true;
+    }
+    for (size_t i = 0; i < count; i++)
+    {
+        if (heap[i].id == id)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Called with the lock held
+void ESPWebCScheduler::push(const Timer &timer)
+{
+    size_t i = count++;
+    while (i > 0)
+    {
+        size_t parent = (i - 1) / 2;
+        if (!before(timer, heap[parent]))
+        {
+            break;
+        }
+        heap[i] = heap[parent];
+        i = parent;
+    }
+    heap[i] = timer;
+}
+
+// Called with the lock held
+void ESPWebCScheduler::removeAt(size_t index)
+{
+    Timer last = heap[--count];
+    if (index == count)
+    {
+        return;
+    }
+
+    // Move the last timer into the hole, up or down as needed
+    size_t i = index;
+    while (i > 0 && before(last, heap[(i - 1) / 2]))
+    {
+        heap[i] = heap[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    for (;;)
+    {
+        size_t child = 2 * i + 1;
+        if (child >= count)
+        {
+            break;
+        }
+        if (child + 1 < count && before(heap[child + 1], heap[child]))
+        {
+            child++;
+        }
+        if (!before(heap[child], last))
+        {
+            break;
+        }
+        heap[i] = heap[child];
+        i = child;
+    }
+    heap[i] = last;
+}
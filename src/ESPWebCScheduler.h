@@ -0,0 +1,71 @@
+#ifndef ESPWEBC_SCHEDULER_H
+#define ESPWEBC_SCHEDULER_H
+
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+// Timers for periodic sketch work, run from ESPWebConnect::handle().
+// A fixed min-heap ordered by due time: adding, cancelling and dispatching
+// never allocate. Callbacks are plain function pointers (a lambda without
+// captures converts to one), with an optional argument.
+//
+// Periodic timers keep their rate: the next run is due one period after the
+// previous due time, not after the run. A run that starts more than a whole
+// period late skips the missed runs and counts them as overruns.
+
+#ifndef ESPWEBC_MAX_TIMERS
+#define ESPWEBC_MAX_TIMERS 16
+#endif
+
+class ESPWebCScheduler
+{
+public:
+    typedef void (*Callback)();
+    typedef void (*ArgCallback)(void *arg);
+
+    ESPWebCScheduler();
+
+    // Returns the timer id, 0 when all ESPWEBC_MAX_TIMERS are in use
+    uint16_t every(uint32_t periodMs, Callback fn);
+    uint16_t every(uint32_t periodMs, ArgCallback fn, void *arg);
+    uint16_t after(uint32_t delayMs, Callback fn);
+    uint16_t after(uint32_t delayMs, ArgCallback fn, void *arg);
+    bool cancel(uint16_t id);
+
+    // Runs the due timers, the lock is not held while a callback runs. now is
+    // read again after each callback, a slow one makes the next ones due.
+    void run(uint32_t now);
+
+    size_t size() const { return count; }
+    uint32_t runs = 0;
+    uint32_t overruns = 0;  // periodic runs skipped because the loop was late
+    uint32_t maxLateMs = 0; // latest start after the due time
+    uint32_t lateMs = 0;    // total of the start delays, lateMs / runs is the mean
+
+private:
+    struct Timer
+    {
+        uint32_t due;
+        uint32_t period; // 0 for after()
+        ArgCallback fn;
+        void *arg;
+        Callback plain;
+        uint16_t id;
+    };
+
+    uint16_t add(uint32_t delayMs, uint32_t periodMs, ArgCallback fn, void *arg, Callback plain);
+    void push(const Timer &timer);
+    void removeAt(size_t index);
+    bool inUse(uint16_t id) const;
+    static bool before(const Timer &a, const Timer &b) { return (int32_t)(a.due - b.due) < 0; }
+
+    Timer heap[ESPWEBC_MAX_TIMERS];
+    size_t count = 0;
+    uint16_t nextId = 1;
+    uint16_t runningId = 0;
+    bool runningCancelled = false;
+    SemaphoreHandle_t lock;
+};
+
+#endif // ESPWEBC_SCHEDULER_H
@@ -0,0 +1,97 @@
+#include "ESPWebCSnapshot.h"
+
+void ESPWebCSnapshot::layout(size_t count, const std::vector<uint16_t> &textSizes)
+{
+    if (ready())
+    {
+        return;
+    }
+    values.assign(count, Value());
+    slotOffsets.assign(1, 0);
+    size_t total = 0;
+    for (uint16_t size : textSizes)
+    {
+        if (total + size > UINT16_MAX)
+        {
+            size = total < UINT16_MAX ? UINT16_MAX - total : 0;
+        }
+        total += size;
+        slotOffsets.push_back(total);
+    }
+    textPool.assign(total, 0);
+    valueCount = count;
+}
+
+void ESPWebCSnapshot::beginWrite()
+{
+    seq.store(seq.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+void ESPWebCSnapshot::setText(size_t index, size_t slot, const char *text, size_t len)
+{
+    size_t offset = slotOffsets[slot];
+    size_t size = slotOffsets[slot + 1] - offset;
+    if (size == 0)
+    {
+        // No room left in the pool, read as the empty text past its end
+        values[index].text = textPool.size();
+        values[index].textLen = 0;
+        truncated = truncated + 1;
+        return;
+    }
+    if (len > size - 1)
+    {
+        len = size - 1;
+        truncated = truncated + 1;
+    }
+    memcpy(&textPool[offset], text, len);
+    textPool[offset + len] = 0;
+    values[index].text = offset;
+    values[index].textLen = len;
+}
+
+// True when setText() would leave the value as it is, a text longer than
+// its slot compares by the part that fits
+bool ESPWebCSnapshot::sameText(size_t index, size_t slot, const char *text, size_t len) const
+{
+    size_t size = slotOffsets[slot + 1] - slotOffsets[slot];
+    if (size == 0)
+    {
+        return values[index].textLen == 0;
+    }
+    if (len > size - 1)
+    {
+        len = size - 1;
+    }
+    return values[index].textLen == len && memcmp(&textPool[values[index].text], text, len) == 0;
+}
+
+void ESPWebCSnapshot::endWrite()
+{
+    seq.store(seq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+void ESPWebCSnapshot::read(Value *outValues, char *outText) const
+{
+    uint8_t attempts = 0;
+    while (true)
+    {
+        uint32_t before = seq.load(std::memory_order_acquire);
+        if (!(before & 1))
+        {
+            memcpy(outValues, values.data(), valueCount * sizeof(Value));
+            memcpy(outText, textPool.data(), textPool.size());
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (seq.load(std::memory_order_relaxed) == before)
+            {
+                return;
+            }
+        }
+        // The writer is in the middle of a commit, let it finish.
+        if (++attempts > 4)
+        {
+            vTaskDelay(1);
+        }
+    }
+}
@@ -0,0 +1,70 @@
+#ifndef ESPWEBC_SNAPSHOT_H
+#define ESPWEBC_SNAPSHOT_H
+
+#include <Arduino.h>
+#include <atomic>
+#include <vector>
+
+// Seqlock-published copy of the dashboard values.
+//
+// The sketch is the only writer: commit() copies every value into the
+// snapshot between two sequence increments. Readers on other tasks copy the
+// snapshot out and retry when the sequence moved, so they always see one
+// consistent set of values and never take a lock. Text values are copied
+// into fixed slots so a reader never touches a String the sketch may be
+// reallocating.
+
+// Smallest text slot, a slot is sized from the longer of this and the
+// value's length at the first commit(). Longer values are cut and counted.
+#ifndef ESPWEBC_SNAPSHOT_TEXT
+#define ESPWEBC_SNAPSHOT_TEXT 64
+#endif
+
+class ESPWebCSnapshot
+{
+public:
+    struct Value
+    {
+        union
+        {
+            int32_t i;
+            float f;
+            bool b;
+        };
+        uint16_t text;
+        uint16_t textLen;
+    };
+
+    // Storage is allocated once, the layout never changes afterwards so
+    // readers can run at any time. textSizes has the size of each text slot
+    // including the NUL, the pool is limited to 64KB.
+    void layout(size_t valueCount, const std::vector<uint16_t> &textSizes);
+    bool ready() const { return valueCount > 0; }
+    size_t size() const { return valueCount; }
+    size_t textSize() const { return textPool.size(); }
+    uint32_t truncations() const { return truncated; } // texts cut to their slot
+
+    void beginWrite();
+    Value &value(size_t index) { return values[index]; }
+    void setText(size_t index, size_t slot, const char *text, size_t len);
+    void endWrite();
+
+    // For the writer, to skip a commit that would publish the same values
+    const Value &published(size_t index) const { return values[index]; }
+    bool sameText(size_t index, size_t slot, const char *text, size_t len) const;
+
+    // Copies a consistent snapshot into the caller's buffers, sized size()
+    // and textSize() + 1 with the last byte 0.
+    void read(Value *outValues, char *outText) const;
+    uint32_t version() const { return seq.load(std::memory_order_acquire) >> 1; }
+
+private:
+    std::atomic<uint32_t> seq{0};
+    size_t valueCount = 0;
+    std::vector<Value> values;
+    std::vector<char> textPool;
+    std::vector<uint16_t> slotOffsets; // slot i is [slotOffsets[i], slotOffsets[i + 1])
+    volatile uint32_t truncated = 0;
+};
+
+#endif // ESPWEBC_SNAPSHOT_H
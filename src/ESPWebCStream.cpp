@@ -0,0 +1,92 @@
+#include "ESPWebCStream.h"
+
+using namespace ESPWebCStreamProtocol;
+
+bool ESPWebCStream::begin(IPAddress collector, uint16_t port, size_t capacity, size_t packetBytes, uint32_t maxLatencyMs)
+{
+    if (task != nullptr || packetBytes < HEADER_SIZE + SAMPLE_SIZE)
+    {
+        return false;
+    }
+
+    if (packetBytes > ESPWEBC_STREAM_MAX_PACKET)
+    {
+        packetBytes = ESPWEBC_STREAM_MAX_PACKET;
+    }
+    size_t size = 2;
+    while (size < capacity)
+    {
+        size <<= 1;
+    }
+    ring = (Sample *)malloc(size * sizeof(Sample));
+    perPacket = (packetBytes - HEADER_SIZE) / SAMPLE_SIZE;
+    packet = (uint8_t *)malloc(HEADER_SIZE + perPacket * SAMPLE_SIZE);
+    if (ring == nullptr || packet == nullptr)
+    {
+        free(ring);
+        free(packet);
+        ring = nullptr;
+        packet = nullptr;
+        return false;
+    }
+
+    this->collector = collector;
+    this->port = port;
+    this->maxLatencyMs = maxLatencyMs;
+    mask = size - 1; // push() accepts samples from here on
+    xTaskCreatePinnedToCore(senderTask, "espwebc_stream", ESPWEBC_STREAM_STACK, this, ESPWEBC_STREAM_PRIORITY, &task, ARDUINO_RUNNING_CORE);
+    return task != nullptr;
+}
+
+void ESPWebCStream::senderTask(void *arg)
+{
+    static_cast<ESPWebCStream *>(arg)->run();
+}
+
+void ESPWebCStream::run()
+{
+    uint32_t lastSend = millis();
+    for (;;)
+    {
+        uint32_t available = head.load(std::memory_order_acquire) - tail.load(std::memory_order_relaxed);
+        if (available >= perPacket || (available > 0 && millis() - lastSend >= maxLatencyMs))
+        {
+            send(available < perPacket ? available : perPacket);
+            lastSend = millis();
+            continue; // more may be waiting
+        }
+        if (available == 0)
+        {
+            lastSend = millis(); // latency counts from the first waiting sample
+        }
+        vTaskDelay(pdMS_TO_TICKS(ESPWEBC_STREAM_POLL_MS));
+    }
+}
+
+void ESPWebCStream::send(uint32_t count)
+{
+    Header header;
+    header.sequence = sequence++;
+    header.overruns = overruns;
+    header.count = count;
+    encodeHeader(packet, header);
+
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        encodeSample(packet + HEADER_SIZE + i * SAMPLE_SIZE, ring[(t + i) & mask]);
+    }
+    tail.store(t + count, std::memory_order_release); // the slots are free again
+
+    udp.beginPacket(collector, port);
+    udp.write(packet, HEADER_SIZE + count * SAMPLE_SIZE);
+    if (udp.endPacket())
+    {
+        packetsSent++;
+        samplesSent += count;
+    }
+    else
+    {
+        sendErrors++;
+    }
+}
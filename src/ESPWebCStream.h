@@ -0,0 +1,100 @@
+#ifndef ESPWEBC_STREAM_H
+#define ESPWEBC_STREAM_H
+
+#include <Arduino.h>
+#include <WiFiUdp.h>
+#include <atomic>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "ESPWebCStreamProtocol.h"
+
+// High rate samples to a UDP collector, see ESPWebCStreamProtocol.h.
+//
+// push() stores a timestamped sample in a single-producer ring without
+// locking, so it can be called at 1 kHz from the sketch or a sensor task.
+// A sender task packs the ring into datagrams of packetBytes, or sends what
+// it has once the oldest waiting sample is maxLatencyMs old. When the ring
+// is full new samples are dropped and counted as overruns.
+
+#ifndef ESPWEBC_STREAM_PORT
+#define ESPWEBC_STREAM_PORT 4211
+#endif
+
+#ifndef ESPWEBC_STREAM_MAX_PACKET
+#define ESPWEBC_STREAM_MAX_PACKET 1400 // stays in one Wi-Fi frame
+#endif
+
+#ifndef ESPWEBC_STREAM_POLL_MS
+#define ESPWEBC_STREAM_POLL_MS 5 // sender task wake up period
+#endif
+
+#ifndef ESPWEBC_STREAM_STACK
+#define ESPWEBC_STREAM_STACK 3072
+#endif
+
+#ifndef ESPWEBC_STREAM_PRIORITY
+#define ESPWEBC_STREAM_PRIORITY 2
+#endif
+
+class ESPWebCStream
+{
+public:
+    typedef ESPWebCStreamProtocol::Sample Sample;
+
+    // capacity is rounded up to a power of two
+    bool begin(IPAddress collector, uint16_t port, size_t capacity, size_t packetBytes, uint32_t maxLatencyMs);
+    bool started() const { return task != nullptr; }
+
+    // Single producer: call from one task only
+    bool push(uint8_t channel, float value, uint32_t us)
+    {
+        if (mask == 0)
+        {
+            return false; // not started
+        }
+        uint32_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) > mask)
+        {
+            overruns++;
+            return false;
+        }
+        Sample &sample = ring[h & mask];
+        sample.micros = us;
+        sample.value = value;
+        sample.channel = channel;
+        head.store(h + 1, std::memory_order_release);
+        pushed++;
+        return true;
+    }
+
+    size_t queued() const { return head.load(std::memory_order_relaxed) - tail.load(std::memory_order_relaxed); }
+
+    // Written by the producer
+    volatile uint32_t pushed = 0;
+    volatile uint32_t overruns = 0;
+    // Written by the sender task
+    volatile uint32_t packetsSent = 0;
+    volatile uint32_t samplesSent = 0;
+    volatile uint32_t sendErrors = 0; // datagrams the network stack refused
+
+private:
+    static void senderTask(void *arg);
+    void run();
+    void send(uint32_t count);
+
+    Sample *ring = nullptr;
+    uint32_t mask = 0;
+    std::atomic<uint32_t> head{0};
+    std::atomic<uint32_t> tail{0};
+
+    WiFiUDP udp;
+    IPAddress collector;
+    uint16_t port = ESPWEBC_STREAM_PORT;
+    uint8_t *packet = nullptr;
+    uint32_t perPacket = 0;
+    uint32_t maxLatencyMs = 0;
+    uint32_t sequence = 0;
+    TaskHandle_t task = nullptr;
+};
+
+#endif // ESPWEBC_STREAM_H
@@ -0,0 +1,106 @@
+#ifndef ESPWEBC_STREAM_PROTOCOL_H
+#define ESPWEBC_STREAM_PROTOCOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Sample datagrams sent to a stream collector. No Arduino dependency, the
+// Linux receiver (extras/stream_recv.cpp) includes it too.
+//
+// Datagram: header, then count samples. All numbers little endian.
+//   header : 'E' 'S' version u8 | reserved u8 | sequence u32 | overruns u32 | count u16 | reserved u16
+//   sample : channel u8 | micros u32 | value f32
+// sequence counts datagrams, a gap means datagrams were lost on the way.
+// overruns is the device total of samples dropped because the ring was full.
+
+namespace ESPWebCStreamProtocol
+{
+    static const uint8_t VERSION = 1;
+    static const size_t HEADER_SIZE = 16;
+    static const size_t SAMPLE_SIZE = 9;
+
+    struct Sample
+    {
+        uint32_t micros;
+        float value;
+        uint8_t channel;
+    };
+
+    struct Header
+    {
+        uint32_t sequence;
+        uint32_t overruns;
+        uint16_t count;
+    };
+
+    inline void put16(uint8_t *p, uint16_t v)
+    {
+        p[0] = v & 0xFF;
+        p[1] = v >> 8;
+    }
+
+    inline void put32(uint8_t *p, uint32_t v)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            p[i] = (v >> (8 * i)) & 0xFF;
+        }
+    }
+
+    inline uint16_t get16(const uint8_t *p)
+    {
+        return p[0] | (uint16_t)p[1] << 8;
+    }
+
+    inline uint32_t get32(const uint8_t *p)
+    {
+        return p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+    }
+
+    inline void encodeHeader(uint8_t *p, const Header &header)
+    {
+        p[0] = 'E';
+        p[1] = 'S';
+        p[2] = VERSION;
+        p[3] = 0;
+        put32(p + 4, header.sequence);
+        put32(p + 8, header.overruns);
+        put16(p + 12, header.count);
+        put16(p + 14, 0);
+    }
+
+    inline void encodeSample(uint8_t *p, const Sample &sample)
+    {
+        uint32_t bits;
+        memcpy(&bits, &sample.value, sizeof(bits));
+        p[0] = sample.channel;
+        put32(p + 1, sample.micros);
+        put32(p + 5, bits);
+    }
+
+    // False when the datagram is not a complete stream datagram
+    inline bool decodeHeader(const uint8_t *p, size_t length, Header &header)
+    {
+        if (length < HEADER_SIZE || p[0] != 'E' || p[1] != 'S' || p[2] != VERSION)
+        {
+            return false;
+        }
+        header.sequence = get32(p + 4);
+        header.overruns = get32(p + 8);
+        header.count = get16(p + 12);
+        return length >= HEADER_SIZE + (size_t)header.count * SAMPLE_SIZE;
+    }
+
+    inline Sample decodeSample(const uint8_t *p)
+    {
+        Sample sample;
+        uint32_t bits = get32(p + 5);
+        sample.channel = p[0];
+        sample.micros = get32(p + 1);
+        memcpy(&sample.value, &bits, sizeof(bits));
+        return sample;
+    }
+}
+
+#endif // ESPWEBC_STREAM_PROTOCOL_H
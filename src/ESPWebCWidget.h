@@ -0,0 +1,164 @@
+#ifndef ESPWEBC_WIDGET_H
+#define ESPWEBC_WIDGET_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// Widget descriptor. It is a literal type, so a fixed set of widgets can be
+// declared as a constexpr table that the compiler places in flash:
+//
+//   constexpr ESPWebCWidget widgets[] = {
+//       ESPWebCWidget::sensor("temp", "Temperature", "DHT22", "fa fa-thermometer", &temperature, "C"),
+//       ESPWebCWidget::toggle("led", "LED", "On board LED", "fa fa-lightbulb", &ledState),
+//   };
+//   webConnect.addWidgets(widgets);
+//
+// The runtime add*() functions build the same descriptor on the heap.
+struct ESPWebCWidget
+{
+    enum Type
+    {
+        SENSOR_INT,
+        SENSOR_FLOAT,
+        SENSOR_STRING,
+        SWITCH,
+        BUTTON,
+        INPUT_NUM,
+        INPUT_TEXT
+    };
+
+    enum Deadband : uint8_t
+    {
+        DEADBAND_ABSOLUTE, // in the sensor's unit
+        DEADBAND_PERCENT   // of the last reported value
+    };
+
+    Type type;
+    const char *id;
+    const char *name;
+    const char *desc;
+    const char *unit;
+    const char *icon;
+    const char *color;
+
+    union
+    {
+        int *intValue;
+        float *floatValue;
+        String *stringValue;
+        bool *state;
+        void (*press)();
+    };
+
+    bool isFloat;     // INPUT_NUM backed by a float
+    int16_t callback; // index of a std::function button callback, -1 if none
+    uint32_t key;     // keyOf(id)
+
+    // Number sensors: the reported value is held until the reading moves
+    // past the deadband, floats are sent with decimals digits (-1: all)
+    int8_t decimals = -1;
+    Deadband deadbandMode = DEADBAND_ABSOLUTE;
+    float deadband = 0;
+
+    constexpr ESPWebCWidget(Type type, const char *id, const char *name, const char *desc, const char *icon, const char *unit, const char *color, int *value, float deadband = 0, Deadband mode = DEADBAND_ABSOLUTE)
+        : type(type), id(id), name(name), desc(desc), unit(unit), icon(icon), color(color), intValue(value), isFloat(false), callback(-1), key(keyOf(id)), deadbandMode(mode), deadband(deadband) {}
+
+    constexpr ESPWebCWidget(Type type, const char *id, const char *name, const char *desc, const char *icon, const char *unit, const char *color, float *value, int8_t decimals = -1, float deadband = 0, Deadband mode = DEADBAND_ABSOLUTE)
+        : type(type), id(id), name(name), desc(desc), unit(unit), icon(icon), color(color), floatValue(value), isFloat(true), callback(-1), key(keyOf(id)), decimals(decimals), deadbandMode(mode), deadband(deadband) {}
+
+    constexpr ESPWebCWidget(Type type, const char *id, const char *name, const char *desc, const char *icon, const char *unit, const char *color, String *value)
+        : type(type), id(id), name(name), desc(desc), unit(unit), icon(icon), color(color), stringValue(value), isFloat(false), callback(-1), key(keyOf(id)) {}
+
+    constexpr ESPWebCWidget(Type type, const char *id, const char *name, const char *desc, const char *icon, const char *unit, const char *color, bool *value)
+        : type(type), id(id), name(name), desc(desc), unit(unit), icon(icon), color(color), state(value), isFloat(false), callback(-1), key(keyOf(id)) {}
+
+    constexpr ESPWebCWidget(Type type, const char *id, const char *name, const char *desc, const char *icon, const char *unit, const char *color, void (*value)(), int16_t callback = -1)
+        : type(type), id(id), name(name), desc(desc), unit(unit), icon(icon), color(color), press(value), isFloat(false), callback(callback), key(keyOf(id)) {}
+
+    static constexpr ESPWebCWidget sensor(const char *id, const char *name, const char *desc, const char *icon, int *value, const char *unit, const char *color = nullptr, float deadband = 0, Deadband mode = DEADBAND_ABSOLUTE)
+    {
+        return ESPWebCWidget(SENSOR_INT, id, name, desc, icon, unit, color, value, deadband, mode);
+    }
+
+    static constexpr ESPWebCWidget sensor(const char *id, const char *name, const char *desc, const char *icon, float *value, const char *unit, const char *color = nullptr, int8_t decimals = -1, float deadband = 0, Deadband mode = DEADBAND_ABSOLUTE)
+    {
+        return ESPWebCWidget(SENSOR_FLOAT, id, name, desc, icon, unit, color, value, decimals, deadband, mode);
+    }
+
+    static constexpr ESPWebCWidget sensor(const char *id, const char *name, const char *desc, const char *icon, String *value, const char *unit, const char *color = nullptr)
+    {
+        return ESPWebCWidget(SENSOR_STRING, id, name, desc, icon, unit, color, value);
+    }
+
+    static constexpr ESPWebCWidget toggle(const char *id, const char *name, const char *desc, const char *icon, bool *state, const char *color = nullptr)
+    {
+        return ESPWebCWidget(SWITCH, id, name, desc, icon, "", color, state);
+    }
+
+    static constexpr ESPWebCWidget button(const char *id, const char *name, const char *desc, const char *icon, void (*onPress)(), const char *color = nullptr)
+    {
+        return ESPWebCWidget(BUTTON, id, name, desc, icon, "", color, onPress);
+    }
+
+    static constexpr ESPWebCWidget inputNum(const char *id, const char *name, const char *desc, const char *icon, int *value, const char *color = nullptr)
+    {
+        return ESPWebCWidget(INPUT_NUM, id, name, desc, icon, "", color, value);
+    }
+
+    static constexpr ESPWebCWidget inputNum(const char *id, const char *name, const char *desc, const char *icon, float *value, const char *color = nullptr)
+    {
+        return ESPWebCWidget(INPUT_NUM, id, name, desc, icon, "", color, value);
+    }
+
+    static constexpr ESPWebCWidget inputText(const char *id, const char *name, const char *desc, const char *icon, String *value, const char *color = nullptr)
+    {
+        return ESPWebCWidget(INPUT_TEXT, id, name, desc, icon, "", color, value);
+    }
+
+    // Case-insensitive FNV-1a of the id, used to find widgets without string compares
+    static constexpr uint32_t keyOf(const char *s, uint32_t hash = 2166136261UL)
+    {
+        return (s == nullptr || *s == 0) ? hash : keyOf(s + 1, (hash ^ (uint8_t)((*s >= 'A' && *s <= 'Z') ? *s + 32 : *s)) * 16777619UL);
+    }
+
+    // Same as keyOf() without recursion, for run time strings of any length
+    static uint32_t hash(const char *s, uint32_t hash = 2166136261UL)
+    {
+        for (; s && *s; s++)
+        {
+            hash = (hash ^ (uint8_t)((*s >= 'A' && *s <= 'Z') ? *s + 32 : *s)) * 16777619UL;
+        }
+        return hash;
+    }
+
+    static constexpr size_t length(const char *s)
+    {
+        return (s == nullptr || *s == 0) ? 0 : 1 + length(s + 1);
+    }
+
+    // ArduinoJson capacity for this widget in /allReadings: one member and the
+    // copied "<id>-val" key (text values are stored by pointer).
+    constexpr size_t readingSize() const
+    {
+        return JSON_OBJECT_SIZE(1) + length(id) + 5;
+    }
+
+    // True when value is far enough from the last reported one to be sent
+    bool pastDeadband(float reported, float value) const
+    {
+        if (deadband <= 0 || reported != reported) // no deadband, or nothing reported yet
+        {
+            return true;
+        }
+        float band = deadbandMode == DEADBAND_PERCENT ? fabsf(reported) * deadband / 100 : deadband;
+        return fabsf(value - reported) > band;
+    }
+
+    // Capacity for a whole table, usable in a constant expression
+    static constexpr size_t readingsSize(const ESPWebCWidget *table, size_t count)
+    {
+        return count == 0 ? 0 : table[0].readingSize() + readingsSize(table + 1, count - 1);
+    }
+};
+
+#endif // ESPWEBC_WIDGET_H
@@ -1,17 +1,131 @@
 #include "ESPWebConnect.h"
+#include "ESPWebCAssets.h"
+#include "ESPWebCIcons.h"
+#include <algorithm>
 //#define ENABLE_MQTT
 
+static void printJsonString(Print &out, const char *s, size_t len = (size_t)-1)
+{
+    out.print('"');
+    for (const char *end = s + (s ? len : 0); s && s != end && *s; s++)
+    {
+        if (*s == '"' || *s == '\\')
+        {
+            out.print('\\');
+            out.print(*s);
+        }
+        else if ((uint8_t)*s < 0x20)
+        {
+            out.printf("\\u%04x", *s);
+        }
+        else
+        {
+            out.print(*s);
+        }
+    }
+    out.print('"');
+}
+
+// Print into a String, for replies built with the Print based writers
+class StringPrint : public Print
+{
+public:
+    explicit StringPrint(String &out) : out(out) {}
+    size_t write(uint8_t c) override
+    {
+        out += (char)c;
+        return 1;
+    }
+
+private:
+    String &out;
+};
+
+// Capacity to parse a list of {"id","value"} updates: an array slot and two
+// members per '{', plus a copy of every string. No entry is shorter than
+// {"id":"a"}, so a body of braces cannot ask for more than a real batch.
+static size_t batchCapacity(const char *json, size_t len)
+{
+    size_t entries = std::count(json, json + len, '{');
+    entries = std::min(entries, len / 10 + 1);
+    return JSON_OBJECT_SIZE(1) + JSON_ARRAY_SIZE(entries) + entries * JSON_OBJECT_SIZE(2) + len;
+}
+
+// Same for {"sub":["id",...]}, a slot per id of at least "a"
+static size_t idListCapacity(const char *json, size_t len)
+{
+    size_t ids = std::count(json, json + len, ',') + 1;
+    ids = std::min(ids, len / 3 + 1);
+    return JSON_OBJECT_SIZE(1) + JSON_ARRAY_SIZE(ids) + len;
+}
+
+// A JSON number, or a string holding only one, as some clients send them.
+// False for anything else rather than reading it as 0.
+static bool numberValue(JsonVariant value, float &number, int &integer)
+{
+    if (value.is<const char *>())
+    {
+        const char *text = value.as<const char *>();
+        char *end;
+        number = strtof(text, &end);
+        if (end == text || *end != '\0')
+        {
+            return false;
+        }
+        long whole = strtol(text, &end, 10);
+        integer = *end == '\0' ? whole : (int)number; // "1e3" as 1000
+        return true;
+    }
+    if (!value.is<float>())
+    {
+        return false;
+    }
+    number = value.as<float>();
+    integer = value.as<int>();
+    return true;
+}
+
 ESPWebConnect::ESPWebConnect()
-    : server(80), ws("/ws"),
-      dashPath("/dashboard")
+    : server(80), ws("/ws"), events("/events"),
+      dashPath("/dashboard"), widgetHandler(this)
 {
 #ifdef ENABLE_MQTT
     mqttClient.setClient(wifiClient);
 #endif
+#ifdef ENABLE_ALARMS
+    alarms.onTransition([this](const ESPWebCAlarms::Rule &rule, float value)
+                        { onAlarm(rule, value); });
+    alarms.onRead([this](uint16_t element, float &value)
+                  { return numericValue(elementAt(element), value); });
+#endif
+#ifdef ENABLE_PEERS
+    peers.onEncode([this](ESPWebCPeer::Writer &out)
+                   { encodePeerWidgets(out); },
+                   [this](ESPWebCPeer::Writer &out)
+                   { encodePeerReadings(out); });
+#endif
 
+    wsLock = xSemaphoreCreateMutex();
     ws.onEvent([this](AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len)
                { this->onWebSocketEvent(server, client, type, arg, data, len); });
     server.addHandler(&ws);
+
+    // A new or reconnecting (Last-Event-ID) listener gets the latest readings
+    // right away, only the newest state is kept so there is nothing else to replay.
+    events.onConnect([this](AsyncEventSourceClient *client)
+                     {
+        if (!limits.allowClient(events.count()))
+        {
+            client->close();
+            return;
+        }
+        xSemaphoreTake(wsLock, portMAX_DELAY);
+        if (lastEvent.length() > 0)
+        {
+            client->send(lastEvent.c_str(), "readings", eventId, updateInterval);
+        }
+        xSemaphoreGive(wsLock); });
+    server.addHandler(&events);
 }
 
 void ESPWebConnect::begin()
@@ -57,6 +171,10 @@ void ESPWebConnect::begin()
     }
 #endif
 
+#ifdef ENABLE_HISTORY
+    history.begin("/hist", historyBudget, historySegment);
+#endif
+
     if (webSettings.Web_name.length() > 0 && MDNS.begin(webSettings.Web_name.c_str()))
     {
         #ifdef ENABLE_DEBUG_INFO
@@ -72,118 +190,144 @@ void ESPWebConnect::begin()
 #endif
     }
 
-    server.on("/espwebc", HTTP_GET, [this](AsyncWebServerRequest *request)
-              {
-    if (!checkAuth(request)) return;
-        request->send(LittleFS, "/espwebc.html", "text/html"); });
+    // Assets uploaded to LittleFS override the ones built into the firmware
+    assetOverrides = 0;
+    for (size_t i = 0; i < sizeof(ESPWEBC_ASSETS) / sizeof(ESPWEBC_ASSETS[0]); i++)
+    {
+        if (LittleFS.exists(ESPWEBC_ASSETS[i].path))
+        {
+            assetOverrides |= 1UL << i;
+        }
+    }
+    iconOverride = LittleFS.exists(ESPWEBC_ICON_SPRITE.path);
 
-    server.on("/style.css", HTTP_GET, [this](AsyncWebServerRequest *request)
-              { request->send(LittleFS, "/style.css", "text/css"); });
+    server.on("/icons.svg", HTTP_GET, instrument("/icons.svg", [this](AsyncWebServerRequest *request)
+              { sendAsset(request, ESPWEBC_ICON_SPRITE, iconOverride); }));
 
-    server.on("/dash.js", HTTP_GET, [this](AsyncWebServerRequest *request)
-              { request->send(LittleFS, "/dash.js", "text/javascript"); });
+    server.on("/espwebc", HTTP_GET, instrument("/espwebc", [this](AsyncWebServerRequest *request)
+              {
+    if (!checkAuth(request)) return;
+        serveAsset(request, "/espwebc.html"); }));
+
+    server.on("/style.css", HTTP_GET, instrument("/style.css", [this](AsyncWebServerRequest *request)
+              { serveAsset(request, "/style.css"); }));
+
+    server.on("/dash.js", HTTP_GET, instrument("/dash.js", [this](AsyncWebServerRequest *request)
+              { serveAsset(request, "/dash.js"); }));
+
+    server.on("/systeminfo", HTTP_GET, instrument("/systeminfo", [this](AsyncWebServerRequest *request) {
+        if (!admit(request, ESPWebCLimits::PAGE) || !checkAuth(request)) return;
+        ESPWebCArena::Scope scope(arena);
+        arena.print("{\"libWebC\":");
+        printJsonString(arena, ESPwebCVersion.c_str());
+        arena.print(",\"developer\":");
+        printJsonString(arena, manufacturerDeveloper.c_str());
+        arena.print(",\"device\":");
+        printJsonString(arena, manufacturerDevice.c_str());
+        arena.print(",\"description\":");
+        printJsonString(arena, manufacturerDescDevice.c_str());
+        arena.print(",\"version\":");
+        printJsonString(arena, manufacturerVersionDevice.c_str());
+        arena.print("}");
+        request->send(200, "application/json", arena.toString());
+    }));
+
+    server.on(dashPath.c_str(), HTTP_GET, instrument(dashPath.c_str(), [this](AsyncWebServerRequest *request)
+              {
+        if (!admit(request, ESPWebCLimits::PAGE) || !checkAuth(request)) return;
+        serveAsset(request, "/dashboard.html"); }));
 
-    server.on("/systeminfo", HTTP_GET, [this](AsyncWebServerRequest *request) {
-        if (!checkAuth(request)) return;
-        String jsonResponse = "{";
-        jsonResponse += "\"libWebC\":\"" + ESPwebCVersion + "\",";
-        jsonResponse += "\"developer\":\"" + manufacturerDeveloper + "\",";
-        jsonResponse += "\"device\":\"" + manufacturerDevice + "\",";
-        jsonResponse += "\"description\":\"" + manufacturerDescDevice + "\",";
-        jsonResponse += "\"version\":\"" + manufacturerVersionDevice + "\"";
-        jsonResponse += "}";
-        request->send(200, "application/json", jsonResponse);
-    });
-
-    server.on(dashPath.c_str(), HTTP_GET, [this](AsyncWebServerRequest *request)
+    server.on("/widgets.json", HTTP_GET, instrument("/widgets.json", [this](AsyncWebServerRequest *request)
               {
-        if (!checkAuth(request)) return;
-        request->send(200, "text/html", generateDashboardHTML()); });
+        if (!admit(request, ESPWebCLimits::PAGE) || !checkAuth(request)) return;
+        handleWidgetsJSON(request); }));
 
-    server.on("/allReadings", HTTP_GET, [this](AsyncWebServerRequest *request)
+    server.on("/allReadings", HTTP_GET, instrument("/allReadings", [this](AsyncWebServerRequest *request)
               {
-                  // Check for authorization
-                  if (!checkAuth(request))
-                  {
-                      request->send(401, "text/plain", "Unauthorized");
-                      return;
-                  }
-
-                  // Create a JSON document to store all readings
-                  // Dynamically allocate size based on the number of elements (128 bytes per element is estimated)
-                  DynamicJsonDocument doc(128 * dashboardElements.size());
-
-                  // Loop through all dashboard elements
-                  for (auto &element : dashboardElements)
-                  {
-                      String sensorId = String(element.id);
-                      sensorId.toLowerCase(); // Convert to lowercase for consistency
-                      sensorId += "-val";
-
-                      // Handle different types of dashboard elements
-                      if (element.type == DashboardElement::SENSOR_INT)
-                      {
-                          doc[sensorId] = *element.intValue; // Add integer sensor value
-                      }
-                      else if (element.type == DashboardElement::SENSOR_FLOAT)
-                      {
-                          doc[sensorId] = *element.floatValue; // Add float sensor value
-                      }
-                      else if (element.type == DashboardElement::SENSOR_STRING)
-                      {
-                          doc[sensorId] = String(*element.stringValue); // Add string sensor value
-                      }
-                      else if (element.type == DashboardElement::SWITCH)
-                      {
-                          doc[sensorId] = *element.state; // Add switch state (true/false)
-                      }
-                      /*
-                      else {
-                          // Add unsupported or unknown element type as null
-                          doc[sensorId] = nullptr;
-                      }
-                      */
-                  }
-
-                  // Serialize the JSON response
-                  String jsonResponse;
-                  if (serializeJson(doc, jsonResponse) == 0)
-                  {
-                      // Serialization failed
-                      request->send(500, "text/plain", "Failed to serialize JSON");
-                      return;
-                  }
-
-                  // Send the JSON response
-                  request->send(200, "application/json", jsonResponse);
-
-// For debugging purposes (optional)
+        if (!admit(request, ESPWebCLimits::RATED) || !checkAuth(request)) return;
+
+        int page = requestedPage(request);
+        if (page < -1)
+        {
+            request->send(404, "text/plain", "Page not found");
+            return;
+        }
+
+        // Pollers within the cache TTL share one serialization
+        String payload;
+        if (!withReadings([&payload](const char *data, size_t len)
+                          { payload.reserve(len);
+                            payload.concat(data, len); }, page))
+        {
+            request->send(500, "text/plain", "Failed to serialize JSON");
+            return;
+        }
+        request->send(200, "application/json", payload);
+
 #ifdef ENABLE_DEBUG
-                  Serial.println("All Readings JSON Response:");
-                  Serial.println(jsonResponse);
+        Serial.println("All Readings JSON Response:");
+        Serial.println(payload);
 #endif
-              });
+    }));
 
-    server.on("/toggleSwitch", HTTP_GET, [this](AsyncWebServerRequest *request)
+#ifdef ENABLE_HISTORY
+    server.on("/history", HTTP_GET, instrument("/history", [this](AsyncWebServerRequest *request)
               {
-        if (!checkAuth(request)) return;
-        handleToggleSwitch(request);
-        request->send(200, "text/plain", "OK"); });
+        if (!admit(request, ESPWebCLimits::PAGE) || !checkAuth(request)) return;
+        handleHistory(request); }));
+#endif
 
-    server.on("/pressButton", HTTP_GET, [this](AsyncWebServerRequest *request)
+    // Switches, buttons and inputs, see WidgetHandler
+    widgetRoute = instrument("/widget", [this](AsyncWebServerRequest *request)
               {
-        if (!checkAuth(request)) return;
-        handleButtonPress(request); });
+        if (!admit(request, ESPWebCLimits::RATED) || !checkAuth(request)) return;
+        const String &url = request->url();
+        if (url == "/toggleSwitch") {
+            handleToggleSwitch(request);
+        } else if (url == "/pressButton") {
+            handleButtonPress(request);
+        } else {
+            handleInput(request, findElement(url.c_str() + 1));
+        } });
+    server.addHandler(&widgetHandler);
 
-    server.on("/notify", HTTP_GET, [this](AsyncWebServerRequest *request)
+    server.on("/notify", HTTP_GET, instrument("/notify", [this](AsyncWebServerRequest *request)
               {
-        if (!checkAuth(request)) return;
+        if (!admit(request, ESPWebCLimits::PAGE) || !checkAuth(request)) return;
         handleNotification(request);
-        request->send(200, "text/plain", "Notification sent"); });
+        request->send(200, "text/plain", "Notification sent"); }));
+
+    // Several switch/input updates in one request
+    server.on("/batch", HTTP_POST, [](AsyncWebServerRequest *request)
+              {
+        // The body handler answers, it never runs without a body
+        if (request->contentLength() == 0) {
+            request->send(400, "text/plain", "Missing batch body");
+        } },
+              NULL, // No file upload handler
+              instrumentBody("/batch", [this](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total)
+              {
+        if (index == 0) {
+            if (!admit(request, ESPWebCLimits::RATED) || !checkAuth(request)) return;
+            if (total > ESPWEBC_BATCH_MAX_BODY) {
+                request->send(413, "text/plain", "Batch too large");
+                return;
+            }
+            request->_tempObject = new String();
+        }
+        String* body = (String*)request->_tempObject;
+        if (body == nullptr) return; // rejected above
+        body->concat((char*)data, len);
+
+        if (index + len == total) {
+            handleBatch(request, *body);
+            delete body;
+            request->_tempObject = nullptr;
+        } }));
 
     server.on("/saveWifi", HTTP_POST, [](AsyncWebServerRequest *request) {},
               NULL, // No file upload handler
-              [this](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total)
+              instrumentBody("/saveWifi", [this](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total)
               {
         if (index == 0) {
             request->_tempObject = new String();  // Initialize a String to accumulate the data
@@ -229,23 +373,23 @@ void ESPWebConnect::begin()
             // Respond to the client
             request->send(200, "text/plain", "WiFi settings saved successfully");
             delete body;  // Clean up the String object
-        } });
+        } }));
 
-    server.on("/espwebc-reboot", HTTP_GET, [this](AsyncWebServerRequest *request)
+    server.on("/espwebc-reboot", HTTP_GET, instrument("/espwebc-reboot", [this](AsyncWebServerRequest *request)
               {
         if (!checkAuth(request)) return;
         request->send(200, "text/plain", "Rebooting...");
-        handleReboot(); });
+        handleReboot(); }));
 
-    server.on("/getWifiSettings", HTTP_GET, [this](AsyncWebServerRequest *request)
+    server.on("/getWifiSettings", HTTP_GET, instrument("/getWifiSettings", [this](AsyncWebServerRequest *request)
               {
         if (!checkAuth(request)) return;
-        request->send(LittleFS, "/settings-wifi.json", "application/json"); });
+        request->send(LittleFS, "/settings-wifi.json", "application/json"); }));
 
 #ifdef ENABLE_MQTT
     server.on("/saveMQTT", HTTP_POST, [](AsyncWebServerRequest *request) {},
               NULL, // No file upload handler
-              [this](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total)
+              instrumentBody("/saveMQTT", [this](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total)
               {
         if (index == 0) {
             request->_tempObject = new String();  // Initialize a String to accumulate the data
@@ -291,16 +435,16 @@ void ESPWebConnect::begin()
             // Respond to the client
             request->send(200, "text/plain", "MQTT settings saved successfully");
             delete body;  // Clean up the String object
-        } });
-    server.on("/getMQTTSettings", HTTP_GET, [this](AsyncWebServerRequest *request)
+        } }));
+    server.on("/getMQTTSettings", HTTP_GET, instrument("/getMQTTSettings", [this](AsyncWebServerRequest *request)
               {
         if (!checkAuth(request)) return;
-        request->send(LittleFS, "/settings-mqtt.json", "application/json"); });
+        request->send(LittleFS, "/settings-mqtt.json", "application/json"); }));
 #endif
 
     server.on("/saveWeb", HTTP_POST, [](AsyncWebServerRequest *request) {},
               NULL, // No file upload handler
-              [this](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total)
+              instrumentBody("/saveWeb", [this](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total)
               {
 
     if (!checkAuth(request)) return;
@@ -357,14 +501,14 @@ void ESPWebConnect::begin()
             }
 
             delete body;  // Clean up the String object
-        } });
+        } }));
 
-    server.on("/getWebSettings", HTTP_GET, [this](AsyncWebServerRequest *request)
+    server.on("/getWebSettings", HTTP_GET, instrument("/getWebSettings", [this](AsyncWebServerRequest *request)
               {
         if (!checkAuth(request)) return;
-        request->send(LittleFS, "/settings-web.json", "application/json"); });
+        request->send(LittleFS, "/settings-web.json", "application/json"); }));
 
-    server.on("/update-firmware", HTTP_POST, [this](AsyncWebServerRequest *request)                                                    // Capture 'this'
+    server.on("/update-firmware", HTTP_POST, instrument("/update-firmware", [this](AsyncWebServerRequest *request)                                                    // Capture 'this'
               {
     if (!checkAuth(request)) return; // Ensure the user is authenticated
 
@@ -373,7 +517,7 @@ void ESPWebConnect::begin()
     } else {
         request->send(200, "text/plain", "OTA update SUCCESS. Rebooting...");
         ESP.restart();  // Restart the device after sending the response
-    } }, [this](AsyncWebServerRequest *request, const String &filename, size_t index, uint8_t *data, size_t len, bool final) // Capture 'this'
+    } }), [this](AsyncWebServerRequest *request, const String &filename, size_t index, uint8_t *data, size_t len, bool final) // Capture 'this'
               {
     if (index == 0) {
         #ifdef ENABLE_DEBUG_INFO
@@ -401,7 +545,7 @@ void ESPWebConnect::begin()
         }
     } });
 
-    server.on("/ota-url", HTTP_POST, [this](AsyncWebServerRequest *request)
+    server.on("/ota-url", HTTP_POST, instrument("/ota-url", [this](AsyncWebServerRequest *request)
               {
     if (!checkAuth(request)) return; // Ensure the user is authenticated
 
@@ -411,7 +555,14 @@ void ESPWebConnect::begin()
         performOTAUpdateFromURL(firmwareURL); // Function to handle the OTA update from the URL
     } else {
         request->send(400, "text/plain", "Missing URL parameter");
-    } });
+    } }));
+
+#ifdef ENABLE_METRICS
+    server.on("/metrics", HTTP_GET, instrument("/metrics", [this](AsyncWebServerRequest *request)
+              {
+        if (!checkAuth(request)) return;
+        handleMetrics(request); }));
+#endif
 
     server.begin();
 
@@ -439,6 +590,116 @@ void ESPWebConnect::begin()
 #endif
 }
 
+void ESPWebConnect::handle()
+{
+    if (actionLock != nullptr && actionTaskHandle == nullptr)
+    {
+        drainActions();
+    }
+
+    scheduler.run(millis());
+
+    if (wsPushDue || millis() - lastWsPush >= updateInterval)
+    {
+        lastWsPush = millis();
+        pushSubscriptions();
+    }
+
+    // SSE: at most once per interval. Once commit() is used, only when a
+    // commit changed a value or the keepalive is due, without it the
+    // readings are compared in pushEvents()
+    if (millis() - lastEventCheck >= updateInterval)
+    {
+        lastEventCheck = millis();
+        bool due = !snapshot.ready() || readingsKey() != lastEventKey || millis() - lastEventSent >= ESPWEBC_EVENTS_KEEPALIVE_MS;
+#ifdef ENABLE_PEERS
+        due = due || peers.jsonCapacity() > 0; // peer readings are not in the key
+#endif
+        if (due)
+        {
+            lastEventKey = readingsKey();
+            pushEvents();
+        }
+    }
+
+#ifdef ENABLE_PEERS
+    // The multicast membership is lost with the connection, so the peers
+    // start over once the station has an address again
+    if (peers.started() && (WiFi.status() != WL_CONNECTED || WiFi.localIP() != peersIp))
+    {
+        peers.stop();
+    }
+    if (peersEnabled && !peers.started() && !isAPMode() && WiFi.status() == WL_CONNECTED)
+    {
+        startPeers();
+    }
+    peers.loop(widgetsVersion(), updateInterval);
+#endif
+
+#ifdef ENABLE_ALARMS
+    // Only the watched elements that changed, or are due, are read
+    if (alarms.size() > 0)
+    {
+        alarmChanges.take(alarmScratch);
+        alarms.run(alarmScratch, millis());
+    }
+#ifdef ENABLE_MQTT
+    if (!alarmOutbox.empty())
+    {
+        flushAlarmMQTT();
+    }
+#endif
+#endif
+
+#ifdef ENABLE_HISTORY
+    unsigned long now = millis();
+    uint32_t ts = time(nullptr);
+    bool rollupTick = ts != lastRollupTs;
+    lastRollupTs = ts;
+
+    // A clock that was never set starts near 0 after a reboot and every
+    // sample would pile up on one timestamp, sampling waits for NTP. The
+    // tracks are only visited once a second for the rollups, or when the
+    // earliest sample is due, not on every loop().
+    bool clockSet = ts >= ESPWEBC_HISTORY_MIN_TIME;
+    bool visit = clockSet && (rollupTick || (long)(now - historyDue) >= 0);
+    if (visit)
+    {
+        historyDue = now + 1000; // the next rollup second visits them anyway
+    }
+    for (size_t i = 0; visit && i < historyTracks.size(); i++)
+    {
+        HistoryTrack &track = historyTracks[i];
+        bool logDue = now - track.lastSample >= track.interval;
+        unsigned long next = logDue ? now + track.interval : track.lastSample + track.interval;
+        if ((long)(next - historyDue) < 0)
+        {
+            historyDue = next;
+        }
+        if (!logDue && !rollupTick)
+        {
+            continue;
+        }
+
+        float value;
+        if (!numericValue(elementAt(track.element), value))
+        {
+            continue;
+        }
+        if (rollupTick)
+        {
+            historyRollups[i].add(ts, value);
+        }
+        if (logDue)
+        {
+            track.lastSample = now;
+            history.append(track.series, ts, value);
+        }
+    }
+    history.loop();
+#endif
+}
+
 bool ESPWebConnect::configureWiFi(const char *ssid, const char *password)
 {
     #ifdef ENABLE_DEBUG_INFO
@@ -518,81 +779,555 @@ void ESPWebConnect::startAP(const char *ssid, const char *password)
 
 void ESPWebConnect::onWebSocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len)
 {
-    if (type == WS_EVT_DATA)
+    if (type == WS_EVT_CONNECT)
+    {
+        if (!limits.allowClient(server->count()))
+        {
+            client->close(1013, "Try again later");
+            return;
+        }
+        xSemaphoreTake(wsLock, portMAX_DELAY);
+        wsClients.push_back({client->id(), 0, std::vector<uint32_t>(), true});
+        xSemaphoreGive(wsLock);
+    }
+    else if (type == WS_EVT_DISCONNECT)
+    {
+        xSemaphoreTake(wsLock, portMAX_DELAY);
+        uint32_t id = client->id();
+        wsClients.erase(std::remove_if(wsClients.begin(), wsClients.end(), [id](const WsClient &c)
+                                       { return c.id == id; }),
+                        wsClients.end());
+        xSemaphoreGive(wsLock);
+    }
+    else if (type == WS_EVT_DATA)
     {
-        String message = String((char *)data);
+#ifdef ENABLE_METRICS
+        metrics.wsReceived++;
+#endif
+        // Only single frame text messages are expected from the dashboard
+        AwsFrameInfo *info = (AwsFrameInfo *)arg;
+        if (info->final && info->index == 0 && info->len == len && info->opcode == WS_TEXT)
+        {
+            handleWsMessage(client, data, len);
+        }
     }
 }
 
+// {"sub":["id1","id2"]} replaces the set of widgets this client receives readings for.
+// {"batch":[{"id":...,"value":...}]} applies updates, answered with {"batch":{results}}.
+void ESPWebConnect::handleWsMessage(AsyncWebSocketClient *client, uint8_t *data, size_t len)
+{
+    // Every message costs a token before anything is parsed or allocated
+    bool isBatch = len >= 8 && memcmp(data, "{\"batch\"", 8) == 0;
+    if (len > ESPWEBC_WS_MAX_MESSAGE)
+    {
+        client->text(isBatch ? "{\"batch\":{\"error\":413}}" : "{\"sub\":{\"error\":413}}");
+        return;
+    }
+    if (!limits.allowRate(client->remoteIP()))
+    {
+        client->text(isBatch ? "{\"batch\":{\"error\":429}}" : "{\"sub\":{\"error\":429}}");
+        return;
+    }
+
+    DynamicJsonDocument doc(isBatch ? batchCapacity((const char *)data, len) : idListCapacity((const char *)data, len));
+    if (deserializeJson(doc, (const char *)data, len))
+    {
+        return;
+    }
 
-void ESPWebConnect::handleToggleSwitch(AsyncWebServerRequest *request)
+    JsonArray batch = doc["batch"];
+    if (!batch.isNull())
+    {
+        String reply;
+        StringPrint out(reply);
+        out.print("{\"batch\":");
+        applyBatch(batch, out);
+        out.print("}");
+        client->text(reply.c_str(), reply.length());
+        return;
+    }
+
+    JsonArray sub = doc["sub"];
+    if (sub.isNull())
+    {
+        return;
+    }
+    if (sub.size() > elementCount())
+    {
+        client->text("{\"sub\":{\"error\":413}}");
+        return;
+    }
+
+    std::vector<uint32_t> bits((elementCount() + 31) / 32, 0);
+    for (JsonVariant id : sub)
+    {
+        int index = findElement(id.as<const char *>());
+        if (index >= 0)
+        {
+            bits[index / 32] |= 1UL << (index % 32);
+        }
+    }
+
+    // Cheap key to group clients with the same subscription
+    uint32_t hash = 2166136261UL;
+    for (uint32_t word : bits)
+    {
+        hash = (hash ^ word) * 16777619UL;
+    }
+
+    xSemaphoreTake(wsLock, portMAX_DELAY);
+    for (auto &c : wsClients)
+    {
+        if (c.id == client->id())
+        {
+            c.subscription.swap(bits);
+            c.hash = hash;
+            c.full = true;
+            break;
+        }
+    }
+    wsPushDue = true;
+    xSemaphoreGive(wsLock);
+}
+
+// Sends every subscribed client its readings. Clients with the same
+// subscription share one serialization. Observed widgets are only sent when
+// they changed, the others every time, and a new subscription gets them all.
+void ESPWebConnect::pushSubscriptions()
 {
-    String id = request->arg("id");
-    String state = request->arg("state");
-    for (auto &element : dashboardElements)
+    // Once commit() is used only published changes count, a change still
+    // waiting for commit() would be pushed with its old value
+    std::fill(pushChanges.begin(), pushChanges.end(), 0);
+    (snapshot.ready() ? committedChanges : changes).take(pushChanges);
+    holdDeadbandChanges();
+
+    xSemaphoreTake(wsLock, portMAX_DELAY);
+    wsPushDue = false;
+    std::vector<bool> sent(wsClients.size(), false);
+    for (size_t i = 0; i < wsClients.size(); i++)
     {
-        if (element.type == DashboardElement::SWITCH)
+        if (sent[i] || wsClients[i].subscription.empty())
+        {
+            continue;
+        }
+
+        bool full = wsClients[i].full;
+        const std::vector<uint32_t> *mask = &wsClients[i].subscription;
+        bool any = true;
+        if (!full)
+        {
+            any = changedReadings(wsClients[i].subscription, pushMask);
+            mask = &pushMask;
+#ifdef ENABLE_PEERS
+            any = any || peers.jsonCapacity() > 0;
+#endif
+        }
+
+        // One frame per distinct subscription, built in the arena
+        ESPWebCArena::Scope scope(arena);
+        if (any)
         {
-            String switchId = element.id;
-            switchId.toLowerCase();
-            if (switchId == id)
+            arena.print("{\"readings\":");
+            if (subscribesAll(*mask))
             {
-                *element.state = (state == "true");
-                break;
+                withReadings([this](const char *data, size_t len)
+                             { arena.write((const uint8_t *)data, len); });
+            }
+            else
+            {
+                writeAllReadingsJSON(arena, mask);
+            }
+            arena.print("}");
+        }
+
+        for (size_t j = i; j < wsClients.size(); j++)
+        {
+            if (sent[j] || wsClients[j].hash != wsClients[i].hash || wsClients[j].full != full || wsClients[j].subscription != wsClients[i].subscription)
+            {
+                continue;
+            }
+            sent[j] = true;
+            wsClients[j].full = false;
+            AsyncWebSocketClient *client = any ? ws.client(wsClients[j].id) : nullptr;
+            if (client)
+            {
+                client->text(arena.data(), arena.length());
+#ifdef ENABLE_METRICS
+                metrics.wsSent++;
+#endif
             }
         }
     }
-    generateDashboardHTML();
+    xSemaphoreGive(wsLock);
 }
 
-void ESPWebConnect::handleNotification(AsyncWebServerRequest *request)
+// Changes of this push still inside their deadband, decided once for every
+// client before any frame moves a reported value. A value another transport
+// reported since the last push is not held, these clients have not seen it.
+void ESPWebConnect::holdDeadbandChanges()
 {
-    String id = request->arg("id");
-    String message = request->arg("message");
-    String messageColor = request->arg("messageColor");
-    String icon = request->arg("icon");
-    String iconColor = request->arg("iconColor");
-    int timeout = request->arg("timeout").toInt();
-
-    sendNotification(id, message, messageColor, icon, iconColor, timeout);
+    pushHeld.assign(pushChanges.size(), 0);
+    std::fill(pushMoved.begin(), pushMoved.end(), 0);
+    reportedMoves.take(pushMoved);
+    for (size_t w = 0; w < pushChanges.size(); w++)
+    {
+        uint32_t observed = w < observedMask.size() ? observedMask[w] : 0;
+        uint32_t moved = w < pushMoved.size() ? pushMoved[w] : 0;
+        for (uint32_t bits = pushChanges[w] & observed & ~moved; bits; bits &= bits - 1)
+        {
+            size_t index = w * 32 + __builtin_ctz(bits);
+            const DashboardElement &element = elementAt(index);
+            float value;
+            if (element.deadband > 0 && numericValue(element, value) && !element.pastDeadband(loadReported(index), value))
+            {
+                pushHeld[w] |= bits & -bits;
+            }
+        }
+    }
 }
 
-void ESPWebConnect::sendNotification(const String &id, const String &message, const String &messageColor, const String &icon, const String &iconColor, int timeout)
+// Subscribed elements that changed or are not observed, false when none
+bool ESPWebConnect::changedReadings(const std::vector<uint32_t> &subscription, std::vector<uint32_t> &mask) const
 {
-    String notificationJson = "{\"id\":\"" + id + "\",\"message\":\"" + message + "\",\"messageColor\":\"" + messageColor + "\",\"icon\":\"" + icon + "\",\"iconColor\":\"" + iconColor + "\",\"timeout\":" + String(timeout) + "}";
-    ws.textAll(notificationJson);
+    bool any = false;
+    mask.resize(subscription.size());
+    for (size_t w = 0; w < subscription.size(); w++)
+    {
+        uint32_t observed = w < observedMask.size() ? observedMask[w] : 0;
+        uint32_t changed = w < pushChanges.size() ? pushChanges[w] : 0;
+        uint32_t held = w < pushHeld.size() ? pushHeld[w] : 0;
+        mask[w] = subscription[w] & (~observed | changed) & ~held;
+        any = any || mask[w] != 0;
+    }
+    return any;
 }
 
-void ESPWebConnect::setDashPath(const String &path)
+// Sends the readings to all SSE listeners when they changed, or as a keep-alive
+// for proxies when nothing changed for ESPWEBC_EVENTS_KEEPALIVE_MS.
+void ESPWebConnect::pushEvents()
 {
-    this->dashPath = path;
-}
+    if (events.count() == 0)
+    {
+        // Nobody listening, don't hand a stale state to the next listener
+        xSemaphoreTake(wsLock, portMAX_DELAY);
+        lastEvent = "";
+        xSemaphoreGive(wsLock);
+        lastEventKey = readingsKey() + 1; // the next listener gets fresh readings
+        return;
+    }
 
-void ESPWebConnect::setDashInfo(const char *title, const char *description, const char *imageurl, const char *footer) {
-    // Use existing member values as defaults
-    dashTitle = (title != nullptr && strlen(title) > 0) ? title : dashTitle;
-    dashDescription = (description != nullptr && strlen(description) > 0) ? description : dashDescription;
-    dashImageUrl = (imageurl != nullptr && strlen(imageurl) > 0) ? imageurl : dashImageUrl;
-    dashFooter = (footer != nullptr && strlen(footer) > 0) ? footer : dashFooter;
-}
+    String payload;
+    withReadings([&payload](const char *data, size_t len)
+                 { payload.reserve(len);
+                   payload.concat(data, len); });
+    if (payload == lastEvent && millis() - lastEventSent < ESPWEBC_EVENTS_KEEPALIVE_MS)
+    {
+        return;
+    }
 
-void ESPWebConnect::setManifactureInfo(const char *developer, const char* device, const char *descDevice, const char *versionDevice) {
-    // Use existing member values as defaults
-    manufacturerDeveloper = (developer != nullptr && strlen(developer) > 0) ? developer : manufacturerDeveloper;
-    manufacturerDevice = (device != nullptr && strlen(device) > 0) ? device : manufacturerDevice;
-    manufacturerDescDevice = (descDevice != nullptr && strlen(descDevice) > 0) ? descDevice : manufacturerDescDevice;
-    manufacturerVersionDevice = (versionDevice != nullptr && strlen(versionDevice) > 0) ? versionDevice : manufacturerVersionDevice;
-}
+    xSemaphoreTake(wsLock, portMAX_DELAY);
+    lastEvent = payload;
+    eventId++;
+    xSemaphoreGive(wsLock);
 
+    lastEventSent = millis();
+    events.send(payload.c_str(), "readings", eventId);
+}
 
-void ESPWebConnect::setIconUrl(const String &url)
+ArRequestHandlerFunction ESPWebConnect::instrument(const char *route, ArRequestHandlerFunction handler)
 {
-    iconUrl = url;
+#ifdef ENABLE_METRICS
+    int index = metrics.addRoute(route);
+    return [this, index, handler](AsyncWebServerRequest *request)
+    {
+        uint32_t start = micros();
+        handler(request);
+        metrics.record(index, micros() - start);
+    };
+#else
+    return handler;
+#endif
 }
 
-void ESPWebConnect::setCSS(const String &url)
+ArBodyHandlerFunction ESPWebConnect::instrumentBody(const char *route, ArBodyHandlerFunction handler)
 {
-    cssUrl = url;
+#ifdef ENABLE_METRICS
+    int index = metrics.addRoute(route);
+    return [this, index, handler](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t offset, size_t total)
+    {
+        uint32_t start = micros();
+        handler(request, data, len, offset, total);
+        metrics.record(index, micros() - start);
+    };
+#else
+    return handler;
+#endif
+}
+
+#ifdef ENABLE_METRICS
+void ESPWebConnect::handleMetrics(AsyncWebServerRequest *request)
+{
+    AsyncResponseStream *response = request->beginResponseStream("text/plain; version=0.0.4");
+    metrics.writeRoutes(*response);
+
+    uint32_t freeHeap = ESP.getFreeHeap();
+    size_t largestBlock = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+    ESPWebCMetrics::writeGauge(*response, "espwebc_uptime_seconds", "Time since boot.", millis() / 1000.0);
+    ESPWebCMetrics::writeGauge(*response, "espwebc_heap_free_bytes", "Free heap.", freeHeap);
+    ESPWebCMetrics::writeGauge(*response, "espwebc_heap_min_free_bytes", "Lowest free heap since boot.", ESP.getMinFreeHeap());
+    ESPWebCMetrics::writeGauge(*response, "espwebc_heap_largest_free_block_bytes", "Largest allocatable block.", largestBlock);
+    ESPWebCMetrics::writeGauge(*response, "espwebc_heap_fragmentation_ratio", "1 - largest free block / free heap.", freeHeap ? 1.0 - (double)largestBlock / freeHeap : 0);
+    multi_heap_info_t heapInfo;
+    heap_caps_get_info(&heapInfo, MALLOC_CAP_8BIT);
+    ESPWebCMetrics::writeGauge(*response, "espwebc_heap_allocated_blocks", "Live heap allocations.", heapInfo.allocated_blocks);
+    ESPWebCMetrics::writeGauge(*response, "espwebc_dashboard_elements", "Registered dashboard elements.", elementCount());
+    ESPWebCMetrics::writeGauge(*response, "espwebc_arena_capacity_bytes", "Response scratch arena size.", arena.capacity());
+    ESPWebCMetrics::writeGauge(*response, "espwebc_arena_high_water_bytes", "Largest response built in the arena.", arena.highWater());
+    ESPWebCMetrics::writeCounter(*response, "espwebc_arena_overflows_total", "Responses that did not fit the arena and spilled to the heap.", arena.overflows());
+
+    size_t queued = 0;
+    xSemaphoreTake(wsLock, portMAX_DELAY);
+    for (const WsClient &c : wsClients)
+    {
+        AsyncWebSocketClient *client = ws.client(c.id);
+        if (client)
+        {
+            queued += client->queueLen();
+        }
+    }
+    xSemaphoreGive(wsLock);
+    ESPWebCMetrics::writeGauge(*response, "espwebc_ws_clients", "Connected WebSocket clients.", ws.count());
+    ESPWebCMetrics::writeGauge(*response, "espwebc_sse_clients", "Connected Server-Sent Events clients.", events.count());
+    ESPWebCMetrics::writeGauge(*response, "espwebc_ws_queue_depth", "Messages waiting in WebSocket send queues.", queued);
+    ESPWebCMetrics::writeCounter(*response, "espwebc_ws_messages_sent_total", "WebSocket messages sent.", metrics.wsSent);
+    ESPWebCMetrics::writeCounter(*response, "espwebc_ws_messages_received_total", "WebSocket messages received.", metrics.wsReceived);
+
+    if (!isAPMode())
+    {
+        ESPWebCMetrics::writeGauge(*response, "espwebc_wifi_rssi_dbm", "WiFi signal strength.", WiFi.RSSI());
+    }
+
+#ifdef ENABLE_MQTT
+    ESPWebCMetrics::writeGauge(*response, "espwebc_mqtt_connected", "1 when the MQTT client is connected.", mqttClient.connected() ? 1 : 0);
+    ESPWebCMetrics::writeCounter(*response, "espwebc_mqtt_published_total", "MQTT messages published.", metrics.mqttPublished);
+    ESPWebCMetrics::writeCounter(*response, "espwebc_mqtt_received_total", "MQTT messages received.", metrics.mqttReceived);
+    ESPWebCMetrics::writeCounter(*response, "espwebc_mqtt_reconnects_total", "MQTT connection attempts.", metrics.mqttReconnects);
+#endif
+
+    LimitStats rejected = getLimitStats();
+    ESPWebCMetrics::writeGauge(*response, "espwebc_http_in_flight", "Admitted HTTP requests not finished yet.", rejected.inFlight);
+    ESPWebCMetrics::writeCounter(*response, "espwebc_rejected_busy_total", "Requests refused with 503, too many in flight.", rejected.busy);
+    ESPWebCMetrics::writeCounter(*response, "espwebc_rejected_low_heap_total", "Requests refused with 503, free heap under the threshold.", rejected.lowHeap);
+    ESPWebCMetrics::writeCounter(*response, "espwebc_rejected_rate_total", "Requests refused with 429 by the per-IP rate limit.", rejected.rateLimited);
+    ESPWebCMetrics::writeCounter(*response, "espwebc_rejected_clients_total", "WebSocket and SSE connections closed by the client limit.", rejected.clients);
+
+    ReadingsCacheStats cache = getReadingsCacheStats();
+    ESPWebCMetrics::writeCounter(*response, "espwebc_readings_cache_hits_total", "Readings served from the shared cache.", cache.hits);
+    ESPWebCMetrics::writeCounter(*response, "espwebc_readings_cache_misses_total", "Readings serialized for the shared cache.", cache.misses);
+    ESPWebCMetrics::writeGauge(*response, "espwebc_readings_cache_bytes", "Readings cache buffer size.", cache.bytes);
+    ESPWebCMetrics::writeCounter(*response, "espwebc_snapshot_text_truncated_total", "Text values cut to their commit() snapshot slot.", snapshot.truncations());
+
+    SchedulerStats timers = getSchedulerStats();
+    ESPWebCMetrics::writeGauge(*response, "espwebc_timers", "Sketch timers scheduled.", timers.timers);
+    ESPWebCMetrics::writeCounter(*response, "espwebc_timer_runs_total", "Sketch timer callbacks run.", timers.runs);
+    ESPWebCMetrics::writeCounter(*response, "espwebc_timer_overruns_total", "Periodic timer runs skipped because handle() was late.", timers.overruns);
+    ESPWebCMetrics::writeGauge(*response, "espwebc_timer_late_max_seconds", "Latest timer start after its due time.", timers.maxLateMs / 1e3);
+    ESPWebCMetrics::writeCounter(*response, "espwebc_timer_late_seconds_total", "Total timer start delay.", timers.lateMs / 1e3);
+
+    ActionQueueStats actions = getActionQueueStats();
+    ESPWebCMetrics::writeGauge(*response, "espwebc_action_queue_depth", "Widget actions waiting for the worker.", actions.depth);
+    ESPWebCMetrics::writeGauge(*response, "espwebc_action_queue_max_depth", "Highest action queue depth seen.", actions.maxDepth);
+    ESPWebCMetrics::writeCounter(*response, "espwebc_action_dropped_total", "Widget actions rejected because the queue was full.", actions.dropped);
+    ESPWebCMetrics::writeCounter(*response, "espwebc_action_executed_total", "Widget actions executed.", actions.executed);
+    ESPWebCMetrics::writeGauge(*response, "espwebc_action_exec_max_seconds", "Slowest widget callback.", actions.maxExecUs / 1e6);
+    ESPWebCMetrics::writeCounter(*response, "espwebc_action_exec_seconds_total", "Time spent in widget callbacks.", actions.totalExecUs / 1e6);
+    if (actions.slowestId)
+    {
+        // Widget ids are free text, escaped as the exposition format wants
+        response->print("espwebc_action_slowest_info{id=");
+        ESPWebCMetrics::writeLabel(*response, actions.slowestId);
+        response->print("} 1\n");
+    }
+
+#ifdef ENABLE_PEERS
+    size_t peerCount = 0;
+    peers.visit([&peerCount](const ESPWebCPeers::Peer &)
+                { peerCount++; });
+    ESPWebCMetrics::writeGauge(*response, "espwebc_peers", "Peers known to this aggregator.", peerCount);
+    ESPWebCMetrics::writeCounter(*response, "espwebc_peer_packets_sent_total", "Peer UDP packets sent.", peers.packetsSent);
+    ESPWebCMetrics::writeCounter(*response, "espwebc_peer_packets_received_total", "Peer UDP packets received.", peers.packetsReceived);
+    ESPWebCMetrics::writeCounter(*response, "espwebc_peer_packets_dropped_total", "Peer UDP packets ignored.", peers.packetsDropped);
+#endif
+
+#ifdef ENABLE_STREAM
+    StreamStats streamed = getStreamStats();
+    ESPWebCMetrics::writeGauge(*response, "espwebc_stream_queued", "Samples waiting in the stream ring.", streamed.queued);
+    ESPWebCMetrics::writeCounter(*response, "espwebc_stream_samples_total", "Samples pushed to the stream.", streamed.pushed);
+    ESPWebCMetrics::writeCounter(*response, "espwebc_stream_overruns_total", "Samples dropped because the stream ring was full.", streamed.overruns);
+    ESPWebCMetrics::writeCounter(*response, "espwebc_stream_packets_sent_total", "Stream datagrams sent.", streamed.packetsSent);
+    ESPWebCMetrics::writeCounter(*response, "espwebc_stream_send_errors_total", "Stream datagrams the network stack refused.", streamed.sendErrors);
+#endif
+
+#ifdef ENABLE_HISTORY
+    ESPWebCMetrics::writeGauge(*response, "espwebc_history_bytes", "Flash used by the history log.", history.usedBytes());
+    ESPWebCMetrics::writeGauge(*response, "espwebc_history_segments", "History segment files.", history.segmentCount());
+#endif
+
+    request->send(response);
+}
+#endif
+
+
+void ESPWebConnect::handleToggleSwitch(AsyncWebServerRequest *request)
+{
+    int index = findElement(request->arg("id").c_str());
+    if (index < 0 || elementAt(index).type != DashboardElement::SWITCH)
+    {
+        request->send(404, "text/plain", "Switch not found");
+        return;
+    }
+    // Written like an input, then published by the sketch's next commit()
+    Action action = {Action::SET_SWITCH, (size_t)index};
+    action.intValue = request->arg("state").equalsIgnoreCase("true");
+    if (!dispatchAction(action))
+    {
+        request->send(503, "text/plain", "Action queue full");
+        return;
+    }
+    request->send(200, "text/plain", "OK");
+}
+
+void ESPWebConnect::handleInput(AsyncWebServerRequest *request, int index)
+{
+    if (index < 0)
+    {
+        request->send(404, "text/plain", "Not found");
+        return;
+    }
+    if (!request->hasParam("value", true))
+    {
+        request->send(400, "text/plain", "Invalid request: Missing 'value' parameter.");
+        return;
+    }
+
+    const DashboardElement &element = elementAt(index);
+    const String &value = request->getParam("value", true)->value();
+    Action action = {Action::SET_TEXT, (size_t)index};
+    if (element.type == DashboardElement::INPUT_NUM && element.isFloat)
+    {
+        action.kind = Action::SET_FLOAT;
+        action.floatValue = value.toFloat();
+    }
+    else if (element.type == DashboardElement::INPUT_NUM)
+    {
+        action.kind = Action::SET_INT;
+        action.intValue = value.toInt();
+    }
+    else
+    {
+        action.text = value;
+    }
+
+    if (!dispatchAction(action))
+    {
+        request->send(503, "text/plain", "Action queue full");
+        return;
+    }
+    request->send(200, "text/plain", "Value updated successfully");
+}
+
+void ESPWebConnect::WidgetHandler::handleRequest(AsyncWebServerRequest *request)
+{
+    owner->widgetRoute(request);
+}
+
+bool ESPWebConnect::WidgetHandler::match(AsyncWebServerRequest *request) const
+{
+    const String &url = request->url();
+    if (request->method() == HTTP_GET)
+    {
+        return url == "/toggleSwitch" || url == "/pressButton";
+    }
+    if (request->method() != HTTP_POST || url.length() < 2)
+    {
+        return false;
+    }
+    int index = owner->findElement(url.c_str() + 1);
+    if (index < 0)
+    {
+        return false;
+    }
+    DashboardElement::Type type = owner->elementAt(index).type;
+    return type == DashboardElement::INPUT_NUM || type == DashboardElement::INPUT_TEXT;
+}
+
+void ESPWebConnect::handleNotification(AsyncWebServerRequest *request)
+{
+    String id = request->arg("id");
+    String message = request->arg("message");
+    String messageColor = request->arg("messageColor");
+    String icon = request->arg("icon");
+    String iconColor = request->arg("iconColor");
+    int timeout = request->arg("timeout").toInt();
+
+    sendNotification(id, message, messageColor, icon, iconColor, timeout);
+}
+
+void ESPWebConnect::sendNotification(const String &id, const String &message, const String &messageColor, const String &icon, const String &iconColor, int timeout)
+{
+    ESPWebCArena::Scope scope(arena);
+    arena.print("{\"id\":");
+    printJsonString(arena, id.c_str());
+    arena.print(",\"message\":");
+    printJsonString(arena, message.c_str());
+    arena.print(",\"messageColor\":");
+    printJsonString(arena, messageColor.c_str());
+    arena.print(",\"icon\":");
+    printJsonString(arena, icon.c_str());
+    arena.print(",\"iconColor\":");
+    printJsonString(arena, iconColor.c_str());
+    arena.print(",\"timeout\":");
+    arena.print(timeout);
+    arena.print("}");
+    ws.textAll(arena.data(), arena.length());
+#ifdef ENABLE_METRICS
+    metrics.wsSent++;
+#endif
+}
+
+void ESPWebConnect::setDashPath(const String &path)
+{
+    this->dashPath = path;
+}
+
+void ESPWebConnect::setDashInfo(const char *title, const char *description, const char *imageurl, const char *footer) {
+    // Use existing member values as defaults
+    dashTitle = (title != nullptr && strlen(title) > 0) ? title : dashTitle;
+    dashDescription = (description != nullptr && strlen(description) > 0) ? description : dashDescription;
+    dashImageUrl = (imageurl != nullptr && strlen(imageurl) > 0) ? imageurl : dashImageUrl;
+    dashFooter = (footer != nullptr && strlen(footer) > 0) ? footer : dashFooter;
+    widgetsDirty = true;
+}
+
+void ESPWebConnect::setManifactureInfo(const char *developer, const char* device, const char *descDevice, const char *versionDevice) {
+    // Use existing member values as defaults
+    manufacturerDeveloper = (developer != nullptr && strlen(developer) > 0) ? developer : manufacturerDeveloper;
+    manufacturerDevice = (device != nullptr && strlen(device) > 0) ? device : manufacturerDevice;
+    manufacturerDescDevice = (descDevice != nullptr && strlen(descDevice) > 0) ? descDevice : manufacturerDescDevice;
+    manufacturerVersionDevice = (versionDevice != nullptr && strlen(versionDevice) > 0) ? versionDevice : manufacturerVersionDevice;
+}
+
+
+void ESPWebConnect::setIconUrl(const String &url)
+{
+    iconUrl = url;
+    widgetsDirty = true;
+}
+
+void ESPWebConnect::setCSS(const String &url)
+{
+    cssUrl = url;
 }
 
 void ESPWebConnect::setAutoUpdate(unsigned long interval)
@@ -601,449 +1336,1640 @@ void ESPWebConnect::setAutoUpdate(unsigned long interval)
         interval = 3000;
     }
     updateInterval = interval;
+    widgetsDirty = true;
 }
 
-void ESPWebConnect::addSensor(const char *id, const char *name, const char *desc, const char *icon, int *intValue, const char *unit)
+void ESPWebConnect::addSensor(const char *id, const char *name, const char *desc, const char *icon, int *intValue, const char *unit, float deadband, DashboardElement::Deadband mode)
 {
-    dashboardElements.emplace_back(id, name, desc, icon, intValue, unit);
+    addElement(DashboardElement::sensor(id, name, desc, icon, intValue, unit, nullptr, deadband, mode));
 }
 
-void ESPWebConnect::addSensor(const char *id, const char *name, const char *desc, const char *icon, float *floatValue, const char *unit)
+void ESPWebConnect::addSensor(const char *id, const char *name, const char *desc, const char *icon, float *floatValue, const char *unit, int8_t decimals, float deadband, DashboardElement::Deadband mode)
 {
-    dashboardElements.emplace_back(id, name, desc, icon, floatValue, unit);
+    addElement(DashboardElement::sensor(id, name, desc, icon, floatValue, unit, nullptr, decimals, deadband, mode));
 }
 
 void ESPWebConnect::addSensor(const char *id, const char *name, const char *desc, const char *icon, String *stringValue, const char *unit)
 {
-    dashboardElements.emplace_back(id, name, desc, icon, stringValue, unit);
+    addElement(DashboardElement::sensor(id, name, desc, icon, stringValue, unit));
 }
 
 void ESPWebConnect::addSwitch(const char *id, const char *name, const char *desc, const char *icon, bool *state)
 {
-    dashboardElements.emplace_back(id, name, desc, icon, state);
-
-    server.on((String("/toggleSwitch?id=") + id).c_str(), HTTP_GET, [this, state](AsyncWebServerRequest *request)
-              {
-        if (!checkAuth(request)) return;
-        if (request->hasParam("state")) {
-            *state = request->getParam("state")->value().equalsIgnoreCase("true");
-            request->send(200, "text/plain", "Switch state updated");
-        } else {
-            request->send(400, "text/plain", "Missing 'state' parameter");
-        } });
+    addElement(DashboardElement::toggle(id, name, desc, icon, state));
 }
 
+void ESPWebConnect::addSensor(const char *id, const char *name, const char *desc, const char *icon, ESPWebCObservable<int> *intValue, const char *unit, float deadband, DashboardElement::Deadband mode)
+{
+    addSensor(id, name, desc, icon, &intValue->value, unit, deadband, mode);
+    observe(intValue);
+}
 
-void ESPWebConnect::addButton(const char *id, const char *name, const char *desc, const char *icon, std::function<void()> onPress)
+void ESPWebConnect::addSensor(const char *id, const char *name, const char *desc, const char *icon, ESPWebCObservable<float> *floatValue, const char *unit, int8_t decimals, float deadband, DashboardElement::Deadband mode)
 {
-    dashboardElements.emplace_back(id, name, desc, icon, onPress);
+    addSensor(id, name, desc, icon, &floatValue->value, unit, decimals, deadband, mode);
+    observe(floatValue);
+}
 
-    server.on((String("/pressButton?id=") + id).c_str(), HTTP_GET, [this, onPress](AsyncWebServerRequest *request)
-              {
-        if (!checkAuth(request)) return;
-        onPress();
-        request->send(200, "text/plain", "Button pressed"); });
+void ESPWebConnect::addSensor(const char *id, const char *name, const char *desc, const char *icon, ESPWebCObservable<String> *stringValue, const char *unit)
+{
+    addSensor(id, name, desc, icon, &stringValue->value, unit);
+    observe(stringValue);
 }
 
-void ESPWebConnect::addInputNum(const char *id, const char *name, const char *desc, const char *icon, int *variable)
+void ESPWebConnect::addSwitch(const char *id, const char *name, const char *desc, const char *icon, ESPWebCObservable<bool> *state)
 {
-    dashboardElements.emplace_back(id, name, desc, icon, variable);
+    addSwitch(id, name, desc, icon, &state->value);
+    observe(state);
+}
 
-    server.on((String("/") + id).c_str(), HTTP_POST, [this, variable](AsyncWebServerRequest *request)
-              {
-        if (!checkAuth(request)) return;
-        if (request->hasParam("value", true)) {
-            *variable = request->getParam("value", true)->value().toInt();
-            request->send(200, "text/plain", "Value updated successfully");
-        } else {
-            request->send(400, "text/plain", "Invalid request: Missing 'value' parameter.");
-        } });
+// Binds the observable to the element just added
+void ESPWebConnect::observe(ESPWebCObservableBase *value)
+{
+    size_t index = elementCount() - 1;
+    value->dirty = &changes;
+    value->index = index;
+    observables.push_back(value);
+    observedMask[index / 32] |= 1UL << (index % 32);
+    changes.set(index);
 }
 
-void ESPWebConnect::addInputNum(const char *id, const char *name, const char *desc, const char *icon, float *variable)
+// Per element state, sized when widgets are registered. Only the elements
+// added since the last call are visited, so registering n widgets stays O(n).
+void ESPWebConnect::resizeElementState()
 {
-    dashboardElements.emplace_back(id, name, desc, icon, variable);
+    changes.resize(elementCount());
+    committedChanges.resize(elementCount());
+#ifdef ENABLE_ALARMS
+    alarmChanges.resize(elementCount());
+#endif
+    observedMask.resize((elementCount() + 31) / 32, 0);
+    reported.resize(elementCount(), NAN);
+    reportedMoves.resize(elementCount());
+
+    size_t pages = pageNames.empty() ? 1 : pageNames.size();
+    pageMasks.resize(pages);
+    readingsCache.setSlots(pageNames.empty() ? 1 : pages + 1);
+    for (std::vector<uint32_t> &mask : pageMasks)
+    {
+        mask.resize((elementCount() + 31) / 32, 0);
+    }
 
-    server.on((String("/") + id).c_str(), HTTP_POST, [this, variable](AsyncWebServerRequest *request)
-              {
-        if (!checkAuth(request)) return;
-        if (request->hasParam("value", true)) {
-            *variable = request->getParam("value", true)->value().toInt();
-            request->send(200, "text/plain", "Value updated successfully");
-        } else {
-            request->send(400, "text/plain", "Invalid request: Missing 'value' parameter.");
-        } });
+    for (size_t i = stateElements; i < elementCount(); i++)
+    {
+        const DashboardElement &element = elementAt(i);
+        if (element.type == DashboardElement::SENSOR_FLOAT && element.decimals >= 0)
+        {
+            formattedSensors++;
+        }
+        pageMasks[elementPage[i]][i / 32] |= 1UL << (i % 32);
+    }
+    stateElements = elementCount();
 }
 
-void ESPWebConnect::addInputText(const char *id, const char *name, const char *desc, const char *icon, String *variable)
+bool ESPWebConnect::setPage(const char *name)
 {
-    dashboardElements.emplace_back(id, name, desc, icon, variable);
+    if (pageNames.empty() && elementCount() > 0)
+    {
+        pageNames.push_back("Main"); // widgets added before the first page
+    }
+    for (size_t i = 0; i < pageNames.size(); i++)
+    {
+        if (strcasecmp(pageNames[i], name) == 0)
+        {
+            currentPage = i;
+            return true;
+        }
+    }
+    if (pageNames.size() >= ESPWEBC_MAX_PAGES)
+    {
+        #ifdef ENABLE_DEBUG
+        Serial.printf("setPage: more than %d pages, %s not added\n", ESPWEBC_MAX_PAGES, name);
+        #endif
+        return false;
+    }
+    pageNames.push_back(name);
+    currentPage = pageNames.size() - 1;
+    widgetsDirty = true;
+    resizeElementState();
+    return true;
+}
 
-    server.on((String("/") + id).c_str(), HTTP_POST, [this, variable](AsyncWebServerRequest *request)
-              {
-        if (!checkAuth(request)) return;
-        if (request->hasParam("value", true)) {
-            *variable = request->getParam("value", true)->value();  // Store the string value
-            request->send(200, "text/plain", "Value updated successfully");
-        } else {
-            request->send(400, "text/plain", "Invalid request: Missing 'value' parameter.");
-        } });
+// Page asked for with ?page=, -1 for every widget and -2 for no such page
+int ESPWebConnect::requestedPage(AsyncWebServerRequest *request) const
+{
+    if (pageNames.empty() || !request->hasArg("page"))
+    {
+        return -1;
+    }
+    // Digits only: toInt() reads "abc" as 0 and overflows on long numbers
+    const String &arg = request->arg("page");
+    size_t page = 0;
+    for (size_t i = 0; i < arg.length(); i++)
+    {
+        if (!isdigit((unsigned char)arg[i]) || page >= pageNames.size())
+        {
+            return -2;
+        }
+        page = page * 10 + (arg[i] - '0');
+    }
+    return arg.length() > 0 && page < pageNames.size() ? (int)page : -2;
 }
 
-void ESPWebConnect::setIconColor(const char *id, const char *color)
+// Index of the next element set in mask from from on, elementCount() when
+// none. Whole empty words are skipped, so a page costs its own size.
+size_t ESPWebConnect::nextElement(const std::vector<uint32_t> *mask, size_t from) const
 {
-    for (auto &element : dashboardElements)
+    if (mask == nullptr)
     {
-        if (strcmp(element.id, id) == 0)
+        return from;
+    }
+    for (size_t w = from / 32; w < mask->size(); w++)
+    {
+        uint32_t bits = (*mask)[w];
+        if (w == from / 32)
         {
-            element.color = color;
-            break;
+            bits &= ~0UL << (from % 32);
+        }
+        if (bits)
+        {
+            size_t index = w * 32 + __builtin_ctz(bits);
+            return index < elementCount() ? index : elementCount();
         }
     }
+    return elementCount();
 }
 
-void ESPWebConnect::performOTAUpdateFromURL(const String &firmwareURL)
+void ESPWebConnect::addButton(const char *id, const char *name, const char *desc, const char *icon, std::function<void()> onPress)
 {
-    WiFiClientSecure client;
-    client.setInsecure(); // Use insecure mode (no certificate check)
-    
-    #ifdef ENABLE_DEBUG_INFO
-    Serial.println("Connecting to " + firmwareURL);
-    #endif
+    buttonCallbacks.push_back(onPress);
+    addElement(DashboardElement(DashboardElement::BUTTON, id, name, desc, icon, "", nullptr, (void (*)())nullptr, buttonCallbacks.size() - 1));
+}
 
-    if (!client.connect(firmwareURL.c_str(), 443))
+void ESPWebConnect::addInputNum(const char *id, const char *name, const char *desc, const char *icon, int *variable)
+{
+    addElement(DashboardElement::inputNum(id, name, desc, icon, variable));
+}
+
+void ESPWebConnect::addInputNum(const char *id, const char *name, const char *desc, const char *icon, float *variable)
+{
+    addElement(DashboardElement::inputNum(id, name, desc, icon, variable));
+}
+
+void ESPWebConnect::addInputText(const char *id, const char *name, const char *desc, const char *icon, String *variable)
+{
+    addElement(DashboardElement::inputText(id, name, desc, icon, variable));
+}
+
+void ESPWebConnect::addElement(const DashboardElement &element)
+{
+    dashboardElements.push_back(element);
+    indexElement(elementCount() - 1);
+    elementPage.push_back(currentPage);
+    resizeElementState();
+    readingsCapacity += element.readingSize();
+    widgetsDirty = true;
+}
+
+// The table takes the first element indices. Observables, deadbands,
+// alarms, history and pages all keep element indices, so the table is only
+// accepted before any other widget exists.
+bool ESPWebConnect::setWidgetTable(const DashboardElement *table, size_t count)
+{
+    if (elementCount() > 0)
     {
-        #ifdef ENABLE_DEBUG_INFO
-        Serial.println("Connection to server failed!");
-        return;
+        #ifdef ENABLE_DEBUG
+        Serial.println("addWidgets: call it once, before any add*()");
         #endif
+        return false;
     }
 
-    // Make the GET request
-    client.print(String("GET ") + firmwareURL + " HTTP/1.1\r\n" +
-                 "Host: " + firmwareURL + "\r\n" +
-                 "Connection: close\r\n\r\n");
+    widgetTable = table;
+    widgetTableSize = count;
+    widgetsDirty = true;
+    readingsCapacity = DashboardElement::readingsSize(table, count);
+    for (size_t i = 0; i < count; i++)
+    {
+        indexElement(i);
+    }
+    elementPage.assign(count, currentPage);
+    resizeElementState();
+    return true;
+}
 
-    // Wait for a response and read the headers
-    while (client.connected())
+void ESPWebConnect::setActionQueue(size_t depth, bool dedicatedTask, uint32_t stackSize, UBaseType_t priority)
+{
+    if (actionLock != nullptr || depth == 0)
+    {
+        return;
+    }
+    actionSlots.resize(depth);
+    actionLock = xSemaphoreCreateMutex();
+
+    if (dedicatedTask)
+    {
+        xTaskCreatePinnedToCore(actionTask, "espwebc_actions", stackSize, this, priority, &actionTaskHandle, ARDUINO_RUNNING_CORE);
+    }
+}
+
+ESPWebConnect::ActionQueueStats ESPWebConnect::getActionQueueStats() const
+{
+    portENTER_CRITICAL(&actionStatsMux);
+    ActionQueueStats stats = actionStats;
+    stats.depth = actionCount;
+    portEXIT_CRITICAL(&actionStatsMux);
+    return stats;
+}
+
+// Runs the action right away, or queues it for the worker when
+// setActionQueue() is used. Returns false when the queue is full.
+bool ESPWebConnect::dispatchAction(Action &action)
+{
+    if (actionLock == nullptr)
+    {
+        runAction(action);
+        return true;
+    }
+
+    xSemaphoreTake(actionLock, portMAX_DELAY);
+    if (actionCount == actionSlots.size())
+    {
+        portENTER_CRITICAL(&actionStatsMux);
+        actionStats.dropped++;
+        portEXIT_CRITICAL(&actionStatsMux);
+        xSemaphoreGive(actionLock);
+        return false;
+    }
+    Action &slot = actionSlots[(actionHead + actionCount) % actionSlots.size()];
+    slot.kind = action.kind;
+    slot.element = action.element;
+    slot.intValue = action.intValue;
+    slot.floatValue = action.floatValue;
+    slot.text = std::move(action.text);
+    portENTER_CRITICAL(&actionStatsMux);
+    actionCount++;
+    if (actionCount > actionStats.maxDepth)
+    {
+        actionStats.maxDepth = actionCount;
+    }
+    portEXIT_CRITICAL(&actionStatsMux);
+    xSemaphoreGive(actionLock);
+
+    if (actionTaskHandle != nullptr)
+    {
+        xTaskNotifyGive(actionTaskHandle);
+    }
+    return true;
+}
+
+void ESPWebConnect::drainActions()
+{
+    Action action;
+    while (true)
+    {
+        xSemaphoreTake(actionLock, portMAX_DELAY);
+        if (actionCount == 0)
+        {
+            xSemaphoreGive(actionLock);
+            return;
+        }
+        Action &slot = actionSlots[actionHead];
+        action.kind = slot.kind;
+        action.element = slot.element;
+        action.intValue = slot.intValue;
+        action.floatValue = slot.floatValue;
+        action.text = std::move(slot.text);
+        actionHead = (actionHead + 1) % actionSlots.size();
+        portENTER_CRITICAL(&actionStatsMux);
+        actionCount--;
+        portEXIT_CRITICAL(&actionStatsMux);
+        xSemaphoreGive(actionLock);
+
+        runAction(action);
+    }
+}
+
+void ESPWebConnect::actionTask(void *arg)
+{
+    ESPWebConnect *self = static_cast<ESPWebConnect *>(arg);
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        self->drainActions();
+    }
+}
+
+void ESPWebConnect::runAction(const Action &action)
+{
+    const DashboardElement &element = elementAt(action.element);
+    uint32_t start = micros();
+
+    switch (action.kind)
+    {
+    case Action::PRESS:
+        if (element.callback >= 0)
+        {
+            buttonCallbacks[element.callback]();
+        }
+        else if (element.press)
+        {
+            element.press();
+        }
+        break;
+    case Action::SET_INT:
+        *element.intValue = action.intValue;
+        break;
+    case Action::SET_FLOAT:
+        *element.floatValue = action.floatValue;
+        break;
+    case Action::SET_TEXT:
+        *element.stringValue = action.text;
+        break;
+    case Action::SET_SWITCH:
+        *element.state = action.intValue != 0;
+        break;
+    }
+    readingsCache.invalidate(); // the callback may have changed values too
+    if (action.kind != Action::PRESS)
+    {
+        changes.set(action.element);
+    }
+
+    uint32_t elapsed = micros() - start;
+    portENTER_CRITICAL(&actionStatsMux);
+    actionStats.executed++;
+    actionStats.totalExecUs += elapsed;
+    if (elapsed > actionStats.maxExecUs)
+    {
+        actionStats.maxExecUs = elapsed;
+        actionStats.slowestId = element.id;
+    }
+    portEXIT_CRITICAL(&actionStatsMux);
+}
+
+bool ESPWebConnect::numericValue(const DashboardElement &element, float &value) const
+{
+    switch (element.type)
+    {
+    case DashboardElement::SENSOR_INT:
+        value = *element.intValue;
+        return true;
+    case DashboardElement::SENSOR_FLOAT:
+        value = *element.floatValue;
+        return true;
+    case DashboardElement::SWITCH:
+        value = *element.state ? 1 : 0;
+        return true;
+    default:
+        return false;
+    }
+}
+
+#ifdef ENABLE_ALARMS
+bool ESPWebConnect::addAlarm(const char *id, const char *elementId, ESPWebCAlarms::Kind kind, float threshold, float hysteresis, unsigned long holdMs, const char *message)
+{
+    int index = findElement(elementId);
+    float value;
+    if (index < 0 || !numericValue(elementAt(index), value))
+    {
+#ifdef ENABLE_DEBUG
+        Serial.printf("Alarm %s: no numeric widget %s\n", id, elementId);
+#endif
+        return false;
+    }
+    // Elements bound to an Observable report their changes, others are polled
+    changes.mirrorTo(&alarmChanges);
+    bool tracked = observedMask[index / 32] & (1UL << (index % 32));
+    return alarms.add(id, index, kind, threshold, hysteresis, holdMs, message, tracked) >= 0;
+}
+
+bool ESPWebConnect::alarmActive(const char *id) const
+{
+    int index = alarms.find(id);
+    return index >= 0 && alarms.rule(index).active;
+}
+
+// Called from handle() on every transition of a rule
+void ESPWebConnect::onAlarm(const ESPWebCAlarms::Rule &rule, float value)
+{
+    const DashboardElement &element = elementAt(rule.element);
+    const char *unit = rule.kind == ESPWebCAlarms::RATE ? "/s" : (element.unit ? element.unit : "");
+
+    String message;
+    if (rule.message)
+    {
+        message = rule.message;
+    }
+    else
+    {
+        static const char *const conditions[] = {"above", "below", "changing faster than"};
+        message = String(element.name) + " " + (rule.active ? conditions[rule.kind] : "back from") + " " + String(rule.threshold, 2) + unit;
+    }
+    message += " (" + String(value, 2) + unit + ")";
+
+    if (rule.active)
+    {
+        sendNotification(rule.id, message, "white", "fa fa-triangle-exclamation", "#c0392b", 0);
+    }
+    else
+    {
+        sendNotification(rule.id, message, "white", "fa fa-circle-check", "#27ae60", 10);
+    }
+
+#ifdef ENABLE_MQTT
+    // Queued, publishToMQTT() would try to reconnect and block handle()
+    if (alarmMQTT)
+    {
+        if (alarmOutbox.size() >= ESPWEBC_ALARM_MQTT_QUEUE)
+        {
+            alarmOutbox.erase(alarmOutbox.begin());
+        }
+        alarmOutbox.push_back(String());
+        StringPrint out(alarmOutbox.back());
+        out.print("{\"alarm\":");
+        printJsonString(out, rule.id);
+        out.print(",\"element\":");
+        printJsonString(out, element.id);
+        out.print(rule.active ? ",\"active\":true,\"value\":" : ",\"active\":false,\"value\":");
+        out.print(value, 3);
+        out.print("}");
+        flushAlarmMQTT();
+    }
+#endif
+}
+
+#ifdef ENABLE_MQTT
+// Publishes the queued alarm messages while the broker is connected. The
+// connection itself is left to begin() and checkMQTT().
+void ESPWebConnect::flushAlarmMQTT()
+{
+    size_t sent = 0;
+    while (sent < alarmOutbox.size() && mqttClient.connected() &&
+           mqttClient.publish(mqttSettings.MQTT_Send.c_str(), alarmOutbox[sent].c_str()))
+    {
+#ifdef ENABLE_METRICS
+        metrics.mqttPublished++;
+#endif
+        sent++;
+    }
+    alarmOutbox.erase(alarmOutbox.begin(), alarmOutbox.begin() + sent);
+}
+#endif
+#endif
+
+#ifdef ENABLE_PEERS
+void ESPWebConnect::setPeers(bool aggregator, const char *nodeName, const char *key)
+{
+    peersEnabled = true;
+    peersAggregator = aggregator;
+    peersName = nodeName ? nodeName : "";
+    peersKey = key ? key : "";
+}
+
+// Started from handle() once the station is connected, the name may come
+// from the settings loaded by begin()
+void ESPWebConnect::startPeers()
+{
+    String name = peersName;
+    if (name.length() == 0)
+    {
+        name = webSettings.Web_name;
+    }
+    if (name.length() == 0)
+    {
+        name = WiFi.macAddress().substring(9);
+    }
+    peers.configure(name.c_str(), peersAggregator);
+
+    // Nodes locked with the same user and password trust each other
+    String key = peersKey;
+    if (key.length() == 0 && webSettings.Web_Lock)
+    {
+        key = webSettings.Web_User + ":" + webSettings.Web_Pass;
+    }
+    peers.setKey(key.c_str());
+    peersIp = WiFi.localIP();
+    peers.begin();
+}
+
+static uint8_t peerValueType(ESPWebCWidget::Type type)
+{
+    switch (type)
+    {
+    case ESPWebCWidget::SENSOR_INT:
+        return ESPWebCPeer::INT;
+    case ESPWebCWidget::SENSOR_FLOAT:
+        return ESPWebCPeer::FLOAT;
+    case ESPWebCWidget::SENSOR_STRING:
+        return ESPWebCPeer::TEXT;
+    case ESPWebCWidget::SWITCH:
+        return ESPWebCPeer::BOOL;
+    default:
+        return 0xFF; // not shared
+    }
+}
+
+// Sensors and switches, as many as fit in one packet
+void ESPWebConnect::encodePeerWidgets(ESPWebCPeer::Writer &out)
+{
+    size_t countAt = out.length();
+    uint8_t count = 0;
+    out.u8(0);
+    for (size_t i = 0; i < elementCount() && count < 255; i++)
+    {
+        const DashboardElement &element = elementAt(i);
+        uint8_t type = peerValueType(element.type);
+        if (type == 0xFF)
+        {
+            continue;
+        }
+        size_t mark = out.length();
+        out.str(element.id);
+        out.str(element.name);
+        out.str(element.unit);
+        out.str(element.icon);
+        out.u8(type);
+        if (!out.ok())
+        {
+            out.rewind(mark);
+            break;
+        }
+        count++;
+    }
+    out.patch(countAt, count);
+}
+
+void ESPWebConnect::encodePeerReadings(ESPWebCPeer::Writer &out)
+{
+    size_t countAt = out.length();
+    uint8_t count = 0;
+    out.u8(0);
+    for (size_t i = 0; i < elementCount() && count < 255; i++)
+    {
+        const DashboardElement &element = elementAt(i);
+        uint8_t type = peerValueType(element.type);
+        if (type == 0xFF)
+        {
+            continue;
+        }
+        size_t mark = out.length();
+        out.str(element.id);
+        out.u8(type);
+        switch (type)
+        {
+        case ESPWebCPeer::INT:
+            out.i32(*element.intValue);
+            break;
+        case ESPWebCPeer::FLOAT:
+            out.f32(*element.floatValue);
+            break;
+        case ESPWebCPeer::BOOL:
+            out.u8(*element.state ? 1 : 0);
+            break;
+        default:
+            out.str(element.stringValue->c_str(), element.stringValue->length());
+            break;
+        }
+        if (!out.ok())
+        {
+            out.rewind(mark);
+            break;
+        }
+        count++;
+    }
+    out.patch(countAt, count);
+}
+
+// Adds "<node>_<id>-val" for every reading received from the peers
+void ESPWebConnect::addPeerReadings(JsonDocument &doc)
+{
+    peers.visit([&doc](const ESPWebCPeers::Peer &peer)
+                {
+        ESPWebCPeer::Reader in(peer.readings.data(), peer.readings.size());
+        uint8_t count = in.u8();
+        for (uint8_t i = 0; i < count && in.ok(); i++)
+        {
+            const char *id;
+            uint8_t idLen;
+            in.str(id, idLen);
+            String key = peer.name;
+            key += '_';
+            key.concat(id, idLen);
+            key += "-val";
+            key.toLowerCase();
+
+            uint8_t type = in.u8();
+            if (type == ESPWebCPeer::INT)
+            {
+                doc[key] = in.i32();
+            }
+            else if (type == ESPWebCPeer::FLOAT)
+            {
+                doc[key] = in.f32();
+            }
+            else if (type == ESPWebCPeer::BOOL)
+            {
+                doc[key] = in.u8() != 0;
+            }
+            else
+            {
+                const char *text;
+                uint8_t textLen;
+                in.str(text, textLen);
+                String value;
+                value.concat(text, textLen);
+                doc[key] = value;
+            }
+        } });
+}
+
+// Peer widgets are shown as read-only sensors, described by their node
+void ESPWebConnect::writePeerWidgets(Print &out, bool first)
+{
+    peers.visit([&out, &first](const ESPWebCPeers::Peer &peer)
+                {
+        ESPWebCPeer::Reader in(peer.widgets.data(), peer.widgets.size());
+        uint8_t count = in.u8();
+        for (uint8_t i = 0; i < count && in.ok(); i++)
+        {
+            const char *id, *name, *unit, *icon;
+            uint8_t idLen, nameLen, unitLen, iconLen;
+            in.str(id, idLen);
+            in.str(name, nameLen);
+            in.str(unit, unitLen);
+            in.str(icon, iconLen);
+            in.u8();
+            if (!in.ok())
+            {
+                break;
+            }
+
+            String widgetId = peer.name;
+            widgetId += '_';
+            widgetId.concat(id, idLen);
+
+            out.print(first ? "{\"id\":" : ",{\"id\":");
+            first = false;
+            printJsonString(out, widgetId.c_str());
+            out.print(",\"name\":");
+            printJsonString(out, name, nameLen);
+            out.print(",\"type\":\"sensor\",\"icon\":");
+            printJsonString(out, icon, iconLen);
+            out.print(",\"color\":\"\",\"desc\":");
+            printJsonString(out, peer.name);
+            out.print(",\"unit\":");
+            printJsonString(out, unit, unitLen);
+            out.print("}");
+        } });
+}
+#endif
+
+#ifdef ENABLE_STREAM
+bool ESPWebConnect::beginStream(const char *collector, uint16_t port, size_t capacity, size_t packetBytes, uint32_t maxLatencyMs)
+{
+    IPAddress ip;
+    if (!ip.fromString(collector) && !WiFi.hostByName(collector, ip))
+    {
+#ifdef ENABLE_DEBUG
+        Serial.printf("Stream: cannot resolve %s\n", collector);
+#endif
+        return false;
+    }
+    bool started = stream.begin(ip, port, capacity, packetBytes, maxLatencyMs);
+#ifdef ENABLE_DEBUG
+    Serial.printf("Stream: %s to %s:%u\n", started ? "sending" : "failed", ip.toString().c_str(), port);
+#endif
+    return started;
+}
+
+ESPWebConnect::StreamStats ESPWebConnect::getStreamStats() const
+{
+    StreamStats stats;
+    stats.queued = stream.queued();
+    stats.pushed = stream.pushed;
+    stats.overruns = stream.overruns;
+    stats.packetsSent = stream.packetsSent;
+    stats.samplesSent = stream.samplesSent;
+    stats.sendErrors = stream.sendErrors;
+    return stats;
+}
+#endif
+
+void ESPWebConnect::setIconColor(const char *id, const char *color)
+{
+    for (auto &element : dashboardElements)
+    {
+        if (strcmp(element.id, id) == 0)
+        {
+            element.color = color;
+            widgetsDirty = true;
+            break;
+        }
+    }
+}
+
+void ESPWebConnect::performOTAUpdateFromURL(const String &firmwareURL)
+{
+    WiFiClientSecure client;
+    client.setInsecure(); // Use insecure mode (no certificate check)
+    
+    #ifdef ENABLE_DEBUG_INFO
+    Serial.println("Connecting to " + firmwareURL);
+    #endif
+
+    if (!client.connect(firmwareURL.c_str(), 443))
+    {
+        #ifdef ENABLE_DEBUG_INFO
+        Serial.println("Connection to server failed!");
+        return;
+        #endif
+    }
+
+    // Make the GET request
+    client.print(String("GET ") + firmwareURL + " HTTP/1.1\r\n" +
+                 "Host: " + firmwareURL + "\r\n" +
+                 "Connection: close\r\n\r\n");
+
+    // Wait for a response and read the headers
+    while (client.connected())
+    {
+        String line = client.readStringUntil('\n');
+        if (line == "\r")
+        {
+            break; // Headers finished
+        }
+    }
+
+    // Start the OTA update
+    if (!Update.begin(UPDATE_SIZE_UNKNOWN))
+    {
+        #ifdef ENABLE_DEBUG_INFO
+        Serial.println("Cannot begin OTA update");
+        #endif
+        return;
+    }
+
+    // Read the payload and write it to flash
+    size_t written = 0;
+    uint8_t buffer[1024];
+    while (client.connected() && !client.available())
+        delay(1);
+
+    while (client.available())
+    {
+        size_t len = client.read(buffer, sizeof(buffer));
+        if (len <= 0)
+            break;
+
+        if (Update.write(buffer, len) != len)
+        {
+            #ifdef ENABLE_DEBUG
+            Serial.println("Failed to write during OTA update");
+            Update.printError(Serial);
+            #endif
+            return;
+        }
+        written += len;
+    }
+
+    if (Update.end())
+    {
+        if (Update.isFinished())
+        {
+            #ifdef ENABLE_DEBUG_INFO
+            Serial.printf("OTA Update via URL completed. Written: %u bytes.\n", written);
+            #endif
+            ESP.restart();
+        }
+        else
+        {
+            #ifdef ENABLE_DEBUG_INFO
+            Serial.println("Update did not finish.");
+            #endif
+        }
+    }
+    else
+    {
+        #ifdef ENABLE_DEBUG
+        Serial.println("Error Occurred: ");
+        #endif
+        Update.printError(Serial);
+    }
+}
+
+#ifdef ENABLE_MQTT
+
+void ESPWebConnect::mqttCallback(char *topic, byte *payload, unsigned int length)
+{
+    Serial.print("Message arrived [");
+    Serial.print(topic);
+    Serial.print("] ");
+#ifdef ENABLE_METRICS
+    metrics.mqttReceived++;
+#endif
+    latestMessage = "";
+    for (unsigned int i = 0; i < length; i++)
+    {
+        latestMessage += (char)payload[i];
+    }
+    Serial.println(latestMessage);
+    newMessage = true;
+}
+
+void ESPWebConnect::enableMQTT()
+{
+    if (isAPMode())
+        return;
+    mqttClient.setServer(mqttSettings.MQTT_Broker.c_str(), mqttSettings.MQTT_Port);
+    mqttClient.setCallback([this](char *topic, byte *payload, unsigned int length)
+                           { this->mqttCallback(topic, payload, length); });
+    reconnectMQTT();
+}
+
+void ESPWebConnect::reconnectMQTT()
+{
+    if (isAPMode())
+        return;
+
+    int attemptCount = 0;
+    const int maxAttempts = 3;
+
+    while (!mqttClient.connected() && (attemptCount < maxAttempts))
+    {
+        Serial.print("Attempting MQTT connection...");
+#ifdef ENABLE_METRICS
+        metrics.mqttReconnects++;
+#endif
+        if (mqttClient.connect("ESP32Client", mqttSettings.MQTT_User.c_str(), mqttSettings.MQTT_Pass.c_str()))
+        {
+            Serial.println("connected");
+            mqttClient.subscribe(mqttSettings.MQTT_Recv.c_str());
+            Serial.print("Subscribed to topic: ");
+            Serial.println(mqttSettings.MQTT_Recv.c_str());
+        }
+        else
+        {
+            Serial.print("failed, rc=");
+            Serial.print(mqttClient.state());
+            Serial.println(" try again in 5 seconds");
+            delay(5000);
+            attemptCount++;
+        }
+    }
+
+    if (attemptCount >= maxAttempts)
+    {
+        Serial.println("MQTT connection failed after 3 attempts.");
+    }
+}
+
+void ESPWebConnect::publishToMQTT(const String &payload)
+{
+    if (isAPMode())
+        return;
+    reconnectMQTT();
+    if (mqttClient.publish(mqttSettings.MQTT_Send.c_str(), payload.c_str()))
+    {
+#ifdef ENABLE_METRICS
+        metrics.mqttPublished++;
+#endif
+    }
+}
+
+void ESPWebConnect::checkMQTT()
+{
+    if (isAPMode())
+        return;
+    reconnectMQTT();
+    mqttClient.loop();
+}
+
+bool ESPWebConnect::hasNewMQTTMsg() const
+{
+    return newMessage;
+}
+
+String ESPWebConnect::getMQTTMsg()
+{
+    newMessage = false;
+    return latestMessage;
+}
+
+#endif
+
+#ifdef ENABLE_HISTORY
+
+void ESPWebConnect::addHistory(const char *id, unsigned long intervalMs, uint8_t decimals)
+{
+    for (size_t i = 0; i < elementCount(); i++)
+    {
+        float value;
+        if (strcmp(elementAt(i).id, id) != 0 || !numericValue(elementAt(i), value))
+        {
+            continue;
+        }
+
+        int series = history.addSeries(elementAt(i).id, decimals);
+        if (series < 0)
+        {
+            return;
+        }
+        if (intervalMs < 1000)
+        {
+            intervalMs = 1000;
+        }
+        historyTracks.push_back({i, (uint8_t)series, intervalMs, millis() - intervalMs});
+        historyDue = millis(); // first sample on the next handle()
+        historyRollups.emplace_back();
+        return;
+    }
+
+    #ifdef ENABLE_DEBUG
+    Serial.println("addHistory: no numeric element with this id");
+    #endif
+}
+
+void ESPWebConnect::setHistoryBudget(size_t totalBytes, size_t segmentBytes)
+{
+    historyBudget = totalBytes;
+    historySegment = segmentBytes;
+    history.setBudget(totalBytes, segmentBytes);
+}
+
+// Streams a history query as {"id":"x","points":[[ts,value],...]} in chunks,
+// one point at a time, so the response never holds more than a line in RAM.
+struct HistoryStream
+{
+    HistoryStream(ESPWebCHistory &history, uint8_t series, uint32_t from, uint32_t to)
+        : cursor(history, series, from, to), decimals(history.seriesDecimals(series)) {}
+
+    size_t fill(uint8_t *buffer, size_t maxLen)
+    {
+        size_t written = 0;
+        while (written < maxLen)
+        {
+            if (headPos < head.length())
+            {
+                size_t n = std::min(head.length() - headPos, maxLen - written);
+                memcpy(buffer + written, head.c_str() + headPos, n);
+                headPos += n;
+                written += n;
+                continue;
+            }
+            if (textPos < textLen)
+            {
+                size_t n = std::min(textLen - textPos, maxLen - written);
+                memcpy(buffer + written, text + textPos, n);
+                textPos += n;
+                written += n;
+                continue;
+            }
+            if (finished)
+            {
+                break;
+            }
+
+            uint32_t ts;
+            float value;
+            int len;
+            if (cursor.next(ts, value))
+            {
+                len = snprintf(text, sizeof(text), "%s[%u,%.*f]", first ? "" : ",", (unsigned)ts, decimals, value);
+                first = false;
+            }
+            else
+            {
+                len = snprintf(text, sizeof(text), "]}");
+                finished = true;
+            }
+            textLen = len > 0 ? std::min((size_t)len, sizeof(text) - 1) : 0;
+            textPos = 0;
+        }
+        return written;
+    }
+
+    ESPWebCHistory::Cursor cursor;
+    uint8_t decimals;
+    String head; // {"id":...,"points":[
+    size_t headPos = 0;
+    char text[96];
+    size_t textLen = 0;
+    size_t textPos = 0;
+    bool first = true;
+    bool finished = false;
+};
+
+void ESPWebConnect::handleHistory(AsyncWebServerRequest *request)
+{
+    String id = request->arg("id");
+    int series = history.findSeries(id.c_str());
+    if (series < 0)
+    {
+        request->send(404, "text/plain", "No history for this id");
+        return;
+    }
+
+    uint32_t now = time(nullptr);
+    uint32_t from = request->hasArg("from") ? strtoul(request->arg("from").c_str(), nullptr, 10) : 0;
+    uint32_t to = request->hasArg("to") ? strtoul(request->arg("to").c_str(), nullptr, 10) : UINT32_MAX;
+    if (from > to)
+    {
+        request->send(400, "text/plain", "from is after to");
+        return;
+    }
+
+    // With a point budget, serve raw samples only when they fit, otherwise
+    // the coarsest rollup tier that still gives enough points.
+    size_t points = request->hasArg("points") ? request->arg("points").toInt() : 0;
+    if (points > 0)
+    {
+        size_t track = 0;
+        while (track < historyTracks.size() && historyTracks[track].series != series)
+        {
+            track++;
+        }
+        uint32_t end = to < now ? to : now;
+        uint32_t start = from > 0 ? from : (end > 86400 ? end - 86400 : 0);
+        // A range starting after the last sample has no raw samples either
+        uint32_t rawCount = start <= end ? (end - start) / (historyTracks[track].interval / 1000) + 1 : 0;
+        if (rawCount > points)
+        {
+            int tier = ESPWebCRollup::pickTier(start, end, now, points);
+            if (tier >= 0)
+            {
+                sendRollup(request, track, tier, start, end);
+                return;
+            }
+        }
+    }
+
+    std::shared_ptr<HistoryStream> stream(new HistoryStream(history, series, from, to));
+    StringPrint head(stream->head);
+    head.print("{\"id\":");
+    printJsonString(head, history.seriesId(series));
+    head.print(",\"points\":[");
+
+    request->send(request->beginChunkedResponse("application/json", [stream](uint8_t *buffer, size_t maxLen, size_t index) -> size_t
+                                                  { return stream->fill(buffer, maxLen); }));
+}
+
+void ESPWebConnect::sendRollup(AsyncWebServerRequest *request, size_t track, size_t tier, uint32_t from, uint32_t to)
+{
+    std::vector<ESPWebCRollup::Point> points;
+    historyRollups[track].read(tier, from, to, points);
+
+    const DashboardElement &element = elementAt(historyTracks[track].element);
+    uint8_t decimals = history.seriesDecimals(historyTracks[track].series);
+
+    AsyncResponseStream *response = request->beginResponseStream("application/json");
+    response->print("{\"id\":");
+    printJsonString(*response, element.id);
+    response->printf(",\"tier\":%u,\"points\":[", (unsigned)ESPWebCRollup::tier(tier).width);
+    for (size_t i = 0; i < points.size(); i++)
+    {
+        const ESPWebCRollup::Bucket &b = points[i].bucket;
+        response->printf("%s[%u,%.*f,%.*f,%.*f,%u]", i ? "," : "", (unsigned)points[i].start,
+                         decimals, b.min, decimals, b.max, decimals, b.sum / b.count, (unsigned)b.count);
+    }
+    response->print("]}");
+    request->send(response);
+}
+
+#endif
+
+int ESPWebConnect::findElement(const char *id) const
+{
+    if (id == nullptr)
+    {
+        return -1;
+    }
+    uint32_t key = DashboardElement::hash(id);
+    auto it = std::lower_bound(elementIndex.begin(), elementIndex.end(), key, [this](uint16_t index, uint32_t key)
+                               { return elementAt(index).key < key; });
+    for (; it != elementIndex.end() && elementAt(*it).key == key; ++it)
+    {
+        if (strcasecmp(elementAt(*it).id, id) == 0)
+        {
+            return *it;
+        }
+    }
+    return -1;
+}
+
+// Keeps elementIndex sorted by key, so request dispatch is a binary search
+// however many widgets are registered.
+void ESPWebConnect::indexElement(size_t index)
+{
+    uint32_t key = elementAt(index).key;
+    auto it = std::upper_bound(elementIndex.begin(), elementIndex.end(), key, [this](uint32_t key, uint16_t other)
+                               { return key < elementAt(other).key; });
+    elementIndex.insert(it, index);
+}
+
+// Value sent for a number sensor: the last reported one until the reading
+// moves past the sensor's deadband. Two transports moving it at once both
+// send a value past the band, the last store wins.
+float ESPWebConnect::reportedValue(size_t index, float value)
+{
+    const DashboardElement &element = elementAt(index);
+    if (element.deadband <= 0 || index >= reported.size())
+    {
+        return value;
+    }
+    float last = loadReported(index);
+    if (!element.pastDeadband(last, value))
+    {
+        return last;
+    }
+    __atomic_store(&reported[index], &value, __ATOMIC_RELAXED);
+    reportedMoves.set(index);
+    return value;
+}
+
+float ESPWebConnect::loadReported(size_t index) const
+{
+    float value;
+    __atomic_load(&reported[index], &value, __ATOMIC_RELAXED);
+    return value;
+}
+
+// A free writeAllReadingsJSON() scratch, nullptr when all are in use
+ESPWebConnect::ReadScratch *ESPWebConnect::claimScratch()
+{
+    for (ReadScratch &scratch : readScratch)
+    {
+        if (!__atomic_exchange_n(&scratch.busy, 1, __ATOMIC_ACQUIRE))
+        {
+            return &scratch;
+        }
+    }
+    return nullptr;
+}
+
+// Cache key of the readings: values published by commit() and the widget set
+uint32_t ESPWebConnect::readingsKey()
+{
+    return (snapshot.version() * 16777619UL) ^ widgetsVersion();
+}
+
+bool ESPWebConnect::subscribesAll(const std::vector<uint32_t> &mask) const
+{
+    for (size_t i = 0; i < elementCount(); i++)
+    {
+        if (i / 32 >= mask.size() || !(mask[i / 32] & (1UL << (i % 32))))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Serializes all readings, or only the elements set in mask (a bitset of
+// element indices), straight into out. withPeers adds the peer readings.
+bool ESPWebConnect::writeAllReadingsJSON(Print &out, const std::vector<uint32_t> *mask, bool withPeers)
+{
+    // Sized from the widget descriptors, text values are stored by pointer
+    size_t capacity = readingsCapacity;
+    if (mask)
     {
-        String line = client.readStringUntil('\n');
-        if (line == "\r")
+        capacity = 0;
+        for (size_t i = nextElement(mask, 0); i < elementCount(); i = nextElement(mask, i + 1))
         {
-            break; // Headers finished
+            capacity += elementAt(i).readingSize();
         }
     }
+#ifdef ENABLE_PEERS
+    DynamicJsonDocument doc(capacity + JSON_OBJECT_SIZE(1) + (withPeers ? peers.jsonCapacity() : 0));
+#else
+    DynamicJsonDocument doc(capacity + JSON_OBJECT_SIZE(1));
+#endif
 
-    // Start the OTA update
-    if (!Update.begin(UPDATE_SIZE_UNKNOWN))
+    // The web server task and loop() each take a scratch of their own, no
+    // lock is held while serializing. The buffers only grow when widgets
+    // were added; a caller finding none free uses a temporary one.
+    ReadScratch spare;
+    ReadScratch *scratch = claimScratch();
+    if (scratch == nullptr)
     {
-        #ifdef ENABLE_DEBUG_INFO
-        Serial.println("Cannot begin OTA update");
-        #endif
-        return;
+        scratch = &spare;
     }
 
-    // Read the payload and write it to flash
-    size_t written = 0;
-    uint8_t buffer[1024];
-    while (client.connected() && !client.available())
-        delay(1);
-
-    while (client.available())
+    // Once the sketch publishes with commit(), read the committed snapshot so
+    // the response is one consistent set of values.
+    size_t published = snapshot.size();
+    ESPWebCSnapshot::Value *values = nullptr;
+    const char *text = nullptr;
+    if (published > 0)
     {
-        size_t len = client.read(buffer, sizeof(buffer));
-        if (len <= 0)
-            break;
-
-        if (Update.write(buffer, len) != len)
+        if (scratch->values.size() < published)
         {
-            #ifdef ENABLE_DEBUG
-            Serial.println("Failed to write during OTA update");
-            Update.printError(Serial);
-            #endif
-            return;
+            scratch->values.resize(published);
+            scratch->text.assign(snapshot.textSize() + 1, 0);
         }
-        written += len;
+        snapshot.read(scratch->values.data(), scratch->text.data());
+        values = scratch->values.data();
+        text = scratch->text.data();
     }
 
-    if (Update.end())
+    // Fixed decimals floats are formatted here and linked into the document
+    if (scratch->numbers.size() < formattedSensors * ESPWebCFormat::FIXED_SIZE)
     {
-        if (Update.isFinished())
+        scratch->numbers.resize(formattedSensors * ESPWebCFormat::FIXED_SIZE);
+    }
+    char *numbers = scratch->numbers.data();
+    size_t formatted = 0;
+
+    for (size_t i = nextElement(mask, 0); i < elementCount(); i = nextElement(mask, i + 1))
+    {
+        const DashboardElement &element = elementAt(i);
+        String sensorId = String(element.id);
+        sensorId.toLowerCase(); // Convert to lowercase for consistency
+        sensorId += "-val";
+
+        bool committed = i < published;
+        switch (element.type)
         {
-            #ifdef ENABLE_DEBUG_INFO
-            Serial.printf("OTA Update via URL completed. Written: %u bytes.\n", written);
-            #endif
-            ESP.restart();
+        case DashboardElement::SENSOR_INT:
+        {
+            int value = committed ? values[i].i : *element.intValue;
+            doc[sensorId] = element.deadband > 0 ? (int)reportedValue(i, value) : value;
+            break;
         }
-        else
+        case DashboardElement::SENSOR_FLOAT:
         {
-            #ifdef ENABLE_DEBUG_INFO
-            Serial.println("Update did not finish.");
-            #endif
+            float value = reportedValue(i, committed ? values[i].f : *element.floatValue);
+            if (element.decimals >= 0 && formatted < formattedSensors)
+            {
+                char *number = &numbers[formatted++ * ESPWebCFormat::FIXED_SIZE];
+                doc[sensorId] = serialized((const char *)number, ESPWebCFormat::fixed(number, value, element.decimals));
+            }
+            else
+            {
+                doc[sensorId] = value;
+            }
+            break;
+        }
+        case DashboardElement::SENSOR_STRING:
+            // Without commit() the String is read in place, a read racing an
+            // assignment in loop() can see a torn or freed buffer
+            doc[sensorId] = committed ? (const char *)&text[values[i].text] : element.stringValue->c_str();
+            break;
+        case DashboardElement::SWITCH:
+            doc[sensorId] = committed ? values[i].b : *element.state;
+            break;
+        default:
+            break;
         }
     }
-    else
+
+#ifdef ENABLE_PEERS
+    // Peers are not part of the subscriptions, every client gets them. With
+    // pages they are on the first one.
+    if (withPeers)
     {
-        #ifdef ENABLE_DEBUG
-        Serial.println("Error Occurred: ");
-        #endif
-        Update.printError(Serial);
+        addPeerReadings(doc);
     }
-}
-
-#ifdef ENABLE_MQTT
+#endif
 
-void ESPWebConnect::mqttCallback(char *topic, byte *payload, unsigned int length)
-{
-    Serial.print("Message arrived [");
-    Serial.print(topic);
-    Serial.print("] ");
-    latestMessage = "";
-    for (unsigned int i = 0; i < length; i++)
+    bool ok = serializeJson(doc, out) > 0;
+    if (scratch != &spare)
     {
-        latestMessage += (char)payload[i];
+        __atomic_store_n(&scratch->busy, 0, __ATOMIC_RELEASE);
     }
-    Serial.println(latestMessage);
-    newMessage = true;
+    return ok;
 }
 
-void ESPWebConnect::enableMQTT()
+void ESPWebConnect::commit()
 {
-    if (isAPMode())
-        return;
-    mqttClient.setServer(mqttSettings.MQTT_Broker.c_str(), mqttSettings.MQTT_Port);
-    mqttClient.setCallback([this](char *topic, byte *payload, unsigned int length)
-                           { this->mqttCallback(topic, payload, length); });
-    reconnectMQTT();
-}
+    // The layout is fixed by the first commit(), elements added later are
+    // read directly from their variables.
+    if (!snapshot.ready())
+    {
+        // Text slots fit the value at the first commit(), at least
+        // ESPWEBC_SNAPSHOT_TEXT, so set long texts before it
+        std::vector<uint16_t> textSizes;
+        snapshotTextSlots.assign(elementCount(), 0);
+        for (size_t i = 0; i < elementCount(); i++)
+        {
+            const DashboardElement &element = elementAt(i);
+            if (element.type == DashboardElement::SENSOR_STRING)
+            {
+                snapshotTextSlots[i] = textSizes.size();
+                size_t size = element.stringValue->length() + 1;
+                textSizes.push_back(size > ESPWEBC_SNAPSHOT_TEXT ? std::min(size, (size_t)UINT16_MAX) : ESPWEBC_SNAPSHOT_TEXT);
+            }
+        }
+        snapshot.layout(elementCount(), textSizes);
+    }
 
-void ESPWebConnect::reconnectMQTT()
-{
-    if (isAPMode())
+    // A commit() with the values already published leaves the version, and
+    // the readings cached under it, as they are
+    if (snapshot.version() > 0 && !commitChanges())
+    {
+        changes.moveTo(committedChanges);
         return;
+    }
 
-    int attemptCount = 0;
-    const int maxAttempts = 3;
-
-    while (!mqttClient.connected() && (attemptCount < maxAttempts))
+    snapshot.beginWrite();
+    for (size_t i = 0; i < snapshot.size(); i++)
     {
-        Serial.print("Attempting MQTT connection...");
-        if (mqttClient.connect("ESP32Client", mqttSettings.MQTT_User.c_str(), mqttSettings.MQTT_Pass.c_str()))
-        {
-            Serial.println("connected");
-            mqttClient.subscribe(mqttSettings.MQTT_Recv.c_str());
-            Serial.print("Subscribed to topic: ");
-            Serial.println(mqttSettings.MQTT_Recv.c_str());
-        }
-        else
+        const DashboardElement &element = elementAt(i);
+        ESPWebCSnapshot::Value &value = snapshot.value(i);
+        switch (element.type)
         {
-            Serial.print("failed, rc=");
-            Serial.print(mqttClient.state());
-            Serial.println(" try again in 5 seconds");
-            delay(5000);
-            attemptCount++;
+        case DashboardElement::SENSOR_INT:
+            value.i = *element.intValue;
+            break;
+        case DashboardElement::SENSOR_FLOAT:
+            value.f = *element.floatValue;
+            break;
+        case DashboardElement::SENSOR_STRING:
+            snapshot.setText(i, snapshotTextSlots[i], element.stringValue->c_str(), element.stringValue->length());
+            break;
+        case DashboardElement::SWITCH:
+            value.b = *element.state;
+            break;
+        default:
+            break;
         }
     }
+    snapshot.endWrite();
+    changes.moveTo(committedChanges); // now visible to readers of the snapshot
+}
 
-    if (attemptCount >= maxAttempts)
+// True when a value differs from the published snapshot. Only the sketch
+// writes the snapshot, so it reads its own values without the seqlock.
+bool ESPWebConnect::commitChanges() const
+{
+    for (size_t i = 0; i < snapshot.size(); i++)
     {
-        Serial.println("MQTT connection failed after 3 attempts.");
+        const DashboardElement &element = elementAt(i);
+        const ESPWebCSnapshot::Value &value = snapshot.published(i);
+        switch (element.type)
+        {
+        case DashboardElement::SENSOR_INT:
+            if (value.i != *element.intValue)
+            {
+                return true;
+            }
+            break;
+        case DashboardElement::SENSOR_FLOAT:
+            if (memcmp(&value.f, element.floatValue, sizeof(float)) != 0) // NaN compares too
+            {
+                return true;
+            }
+            break;
+        case DashboardElement::SENSOR_STRING:
+            if (!snapshot.sameText(i, snapshotTextSlots[i], element.stringValue->c_str(), element.stringValue->length()))
+            {
+                return true;
+            }
+            break;
+        case DashboardElement::SWITCH:
+            if (value.b != *element.state)
+            {
+                return true;
+            }
+            break;
+        default:
+            break;
+        }
     }
+    return false;
 }
 
-void ESPWebConnect::publishToMQTT(const String &payload)
+// Sends a built-in gzip asset straight from flash, or the LittleFS copy when
+// one was present at begin().
+void ESPWebConnect::serveAsset(AsyncWebServerRequest *request, const char *path)
 {
-    if (isAPMode())
-        return;
-    reconnectMQTT();
-    mqttClient.publish(mqttSettings.MQTT_Send.c_str(), payload.c_str());
+    for (size_t i = 0; i < sizeof(ESPWEBC_ASSETS) / sizeof(ESPWEBC_ASSETS[0]); i++)
+    {
+        if (strcmp(ESPWEBC_ASSETS[i].path, path) == 0)
+        {
+            sendAsset(request, ESPWEBC_ASSETS[i], assetOverrides & (1UL << i));
+            return;
+        }
+    }
+    request->send(404, "text/plain", "Not found");
 }
 
-void ESPWebConnect::checkMQTT()
+void ESPWebConnect::sendAsset(AsyncWebServerRequest *request, const ESPWebCAsset &asset, bool overridden)
 {
-    if (isAPMode())
+    if (overridden)
+    {
+        request->send(LittleFS, asset.path, asset.type);
         return;
-    reconnectMQTT();
-    mqttClient.loop();
+    }
+    if (notModified(request, asset.etag))
+    {
+        return;
+    }
+    AsyncWebServerResponse *response = request->beginResponse_P(200, asset.type, asset.data, asset.length);
+    response->addHeader("Content-Encoding", "gzip");
+    response->addHeader("ETag", asset.etag);
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
 }
 
-bool ESPWebConnect::hasNewMQTTMsg() const
+// Answers 304 when the client already has this version
+bool ESPWebConnect::notModified(AsyncWebServerRequest *request, const String &etag)
 {
-    return newMessage;
+    if (!request->hasHeader("If-None-Match") || request->getHeader("If-None-Match")->value() != etag)
+    {
+        return false;
+    }
+    AsyncWebServerResponse *response = request->beginResponse(304);
+    response->addHeader("ETag", etag);
+    request->send(response);
+    return true;
 }
 
-String ESPWebConnect::getMQTTMsg()
+// Version of the /widgets.json content, recomputed after a change
+uint32_t ESPWebConnect::widgetsVersion()
 {
-    newMessage = false;
-    return latestMessage;
+    if (widgetsDirty)
+    {
+        uint32_t hash = ESPWebCWidget::hash(dashTitle.c_str());
+        hash = ESPWebCWidget::hash(dashDescription.c_str(), hash);
+        hash = ESPWebCWidget::hash(dashImageUrl.c_str(), hash);
+        hash = ESPWebCWidget::hash(iconUrl.c_str(), hash);
+        hash = (hash ^ updateInterval) * 16777619UL;
+        for (size_t i = 0; i < elementCount(); i++)
+        {
+            const DashboardElement &element = elementAt(i);
+            hash = (hash ^ element.key ^ element.type) * 16777619UL;
+            hash = ESPWebCWidget::hash(element.name, hash);
+            hash = ESPWebCWidget::hash(element.icon, hash);
+            hash = ESPWebCWidget::hash(element.color, hash);
+            hash = ESPWebCWidget::hash(element.desc, hash);
+            hash = ESPWebCWidget::hash(element.unit, hash);
+            hash = (hash ^ elementPage[i]) * 16777619UL;
+        }
+        for (const char *page : pageNames)
+        {
+            hash = ESPWebCWidget::hash(page, hash);
+        }
+        widgetsHash = hash;
+        widgetsDirty = false;
+    }
+    return widgetsHash;
 }
 
-#endif
 
-String ESPWebConnect::generateAllReadingsJSON()
+void ESPWebConnect::handleWidgetsJSON(AsyncWebServerRequest *request)
 {
-    DynamicJsonDocument doc(1024); // Adjust size as needed for larger dashboards
-    for (auto &element : dashboardElements)
-    {
-        String sensorId = String(element.id);
-        sensorId.toLowerCase();
-        sensorId += "-val";
-        if (element.type == DashboardElement::SENSOR_INT)
-        {
-            doc[sensorId] = *element.intValue;
-        }
-        else if (element.type == DashboardElement::SENSOR_FLOAT)
-        {
-            doc[sensorId] = *element.floatValue;
-        }
-        else if (element.type == DashboardElement::SENSOR_STRING)
-        {
-            doc[sensorId] = String(*element.stringValue);
-        }
-    }
-    String output;
-    serializeJson(doc, output);
-    return output;
-}
-
-String ESPWebConnect::generateDashboardHTML()
-{
-    String html = "<!DOCTYPE html><html><head><title>" + dashTitle + "</title>";
-    html += "<meta charset='UTF-8'><meta name='viewport' content='width=device-width, initial-scale=1'>";
-
-    // Include FontAwesome for icons
-    html += "<link rel='stylesheet' href='https://cdnjs.cloudflare.com/ajax/libs/font-awesome/6.4.2/css/all.min.css'>";
-
-    html += "<script src='/dash.js'></script>";
-    // Start loading the CSS as soon as DOM is ready
-    html += "<script>";
-    html += "document.addEventListener('DOMContentLoaded', () => {";
-    html += "    if (!document.querySelector('link[href=\"/style.css\"]')) {";
-    html += "        const link = document.createElement('link');";
-    html += "        link.rel = 'stylesheet';";
-    html += "        link.href = '/style.css';";
-    html += "        document.head.appendChild(link);";
-    html += "}});";
-
-    // JS for reading update functionality
-    html += "function updateReadings() {";
-    html += "  fetch('/allReadings')"; // Fetch readings from the server
-    html += "    .then(response => {";
-    html += "      if (!response.ok) {";
-    html += "        throw new Error('Network response was not ok: ' + response.statusText);";
-    html += "      }";
-    html += "      return response.json();"; // Parse JSON response
-    html += "    })";
-    html += "    .then(data => {";
-    html += "      Object.keys(data).forEach(id => {";
-    html += "        const element = document.getElementById(id);";
-    html += "        if (element) {";
-    html += "          if (element.type === 'checkbox') {";
-    html += "            element.checked = data[id];";
-    html += "          } else if (element.tagName === 'SPAN' || element.tagName === 'DIV') {";
-    html += "            element.innerText = data[id];";
-    html += "          }";
-    html += "        }";
-    html += "      });";
-    html += "    })";
-    html += "    .finally(() => {";
-    html += "      setTimeout(updateReadings, " + String(updateInterval) + ");"; // Retry after interval
-    html += "    });";
-    html += "}";
-
-    html += "</script></head><body>";
-
-    // Banner Notification
-    html += "<div id='notificationBanner' class='notification-banner'>";
-    html += "<i id='notificationIcon' class='notification-icon'></i>";
-    html += "<span id='notificationMessage' class='notification-message'></span>";
-    html += "<div class='close-button-container'>";
-    html += "<button id='closeButton' class='close-button' onclick='closeNotification()'>X</button>";
-    html += "</div>";
-    html += "</div>";
-
-    // Navbar
-    html += "<div id='navbar'>";
-    html += "  <div style='display: flex; flex-direction: column; align-items: flex-start;'>";
-    html += "    <div style='display: flex; align-items: center;'>";
-    html += "    <img src=\"" + dashImageUrl + "\" alt='Icon' style='width: 48px; height: 48px; margin-right: 10px;'>";
-    html += "      <h1>" +  dashTitle + "</h1>";
-    html += "    </div>";
-    html += "    <h2 style='margin: 5px 0; padding-left: 42px;'>" + dashDescription + "</h2>"; // Added padding to align with title
-    html += "  </div>";
-    html += "  <div style='display: flex; align-items: center; margin-top: 10px;'>";
-
-    // Widget Dropdown
-    html += "    <div class='dropdown' style='margin-right: 20px;'>";
-    html += "      <button>Select Widget</button>";
-    html += "      <div class='dropdown-content'>";
-
-    // Dynamically generate dropdown items
-    for (auto &element : dashboardElements)
+    int page = requestedPage(request);
+    if (page < -1)
     {
-        String widgetType = getWidgetType(element.type);
+        request->send(404, "text/plain", "Page not found");
+        return;
+    }
+    const std::vector<uint32_t> *mask = page >= 0 ? &pageMasks[page] : nullptr;
 
-        html += "<button data-widget='" + String(element.id) +
-                "' data-name='" + String(element.name) +
-                "' data-type='" + widgetType + "'";
+    uint32_t version = (widgetsVersion() ^ (page + 1)) * 16777619UL;
+#ifdef ENABLE_PEERS
+    version = (version ^ peers.version()) * 16777619UL;
+#endif
+    String etag = "\"" + String(version, HEX) + "\"";
+    if (notModified(request, etag))
+    {
+        return;
+    }
 
-        if (element.icon && strlen(element.icon) > 0)
+    AsyncResponseStream *response = request->beginResponseStream("application/json");
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", "no-cache");
+
+    response->print("{\"title\":");
+    printJsonString(*response, dashTitle.c_str());
+    response->print(",\"description\":");
+    printJsonString(*response, dashDescription.c_str());
+    response->print(",\"image\":");
+    printJsonString(*response, dashImageUrl.c_str());
+    response->print(",\"iconUrl\":");
+    printJsonString(*response, iconUrl.c_str());
+    response->printf(",\"interval\":%lu", updateInterval);
+    if (!pageNames.empty())
+    {
+        response->print(",\"pages\":[");
+        for (size_t i = 0; i < pageNames.size(); i++)
         {
-            html += " data-icon='" + String(element.icon) + "'";
+            if (i)
+            {
+                response->print(",");
+            }
+            printJsonString(*response, pageNames[i]);
         }
+        response->printf("],\"page\":%d", page);
+    }
+    response->print(",\"widgets\":[");
+
+    bool first = true;
+    for (size_t i = nextElement(mask, 0); i < elementCount(); i = nextElement(mask, i + 1))
+    {
+        const DashboardElement &element = elementAt(i);
+        response->print(first ? "{\"id\":" : ",{\"id\":");
+        first = false;
+        printJsonString(*response, element.id);
+        response->print(",\"name\":");
+        printJsonString(*response, element.name);
+        response->print(",\"type\":");
+        printJsonString(*response, getWidgetType(element.type).c_str());
+        response->print(",\"icon\":");
+        printJsonString(*response, element.icon);
+        response->print(",\"color\":");
+        printJsonString(*response, element.color);
+        response->print(",\"desc\":");
+        printJsonString(*response, element.desc);
+        response->print(",\"unit\":");
+        printJsonString(*response, element.unit);
+        response->print("}");
+    }
+#ifdef ENABLE_PEERS
+    if (page <= 0) // peers are on the first page
+    {
+        writePeerWidgets(*response, first);
+    }
+#endif
+    response->print("]}");
+    request->send(response);
+}
+
+// Applies one {"id": ..., "value": ...} update of a batch, returns an HTTP status
+int ESPWebConnect::applyUpdate(JsonVariant update)
+{
+    int index = findElement(update["id"].as<const char *>());
+    if (index < 0)
+    {
+        return 404;
+    }
 
-        if (element.color && strlen(element.color) > 0)
+    const DashboardElement &element = elementAt(index);
+    JsonVariant value = update["value"];
+    Action action = {Action::PRESS, (size_t)index};
+    switch (element.type)
+    {
+    case DashboardElement::SWITCH:
+        if (value.isNull())
         {
-            html += " data-color='" + String(element.color) + "'";
+            return 400;
         }
-
-        if (element.desc && strlen(element.desc) > 0)
+        action.kind = Action::SET_SWITCH;
+        action.intValue = value.is<const char *>() ? strcasecmp(value.as<const char *>(), "true") == 0 : value.as<bool>();
+        break;
+    case DashboardElement::BUTTON:
+        break;
+    case DashboardElement::INPUT_NUM:
+        if (!numberValue(value, action.floatValue, action.intValue))
         {
-            html += " data-desc='" + String(element.desc) + "'";
+            return 400;
         }
-
-        if (element.unit && strlen(element.unit) > 0)
+        action.kind = element.isFloat ? Action::SET_FLOAT : Action::SET_INT;
+        break;
+    case DashboardElement::INPUT_TEXT:
+        if (!value.is<const char *>())
         {
-            html += " data-unit='" + String(element.unit) + "'";
+            return 400;
         }
-
-        html += ">";
-        html += String(element.name) + " [" + String(element.id) + "]";
-        html += "</button>";
+        action.kind = Action::SET_TEXT;
+        action.text = value.as<const char *>();
+        break;
+    default:
+        return 400; // sensors are read only
     }
+    return dispatchAction(action) ? 200 : 503;
+}
 
-    html += "      </div>";
-    html += "    </div>";
-
-    // Theme Selection Dropdown
-// Theme Selection Dropdown
-html += "    <div class='dropdown' style='margin-right: 20px;'>";
-html += "      <button>Theme</button>";
-html += "      <div class='dropdown-content'>";
-html += "        <button value='default' onclick='changeTheme(event)'>Keqing</button>";
-html += "        <button value='light' onclick='changeTheme(event)'>Light</button>";
-html += "        <button value='dark' onclick='changeTheme(event)'>Dark</button>";
-html += "      </div>";
-html += "    </div>";
-html += "    <div style='flex-grow: 0.9;'></div>"; // Spacer
-
-// Add Lock checkbox here
-html += "    <label style='display: flex; align-items: center; margin-right: 15px;'>";
-html += "      <input type='checkbox' id='lockDashboard' style='margin-right: 5px;'>";
-html += "      <span>Lock</span>";
-html += "    </label>";
-
-html += "    <button onclick='saveDashboard()' style='margin-right: 10px;'>Save</button>";
-html += "    <button onclick='clearDashboard()' style='margin-right: 10px;'>Clear</button>";
-html += "    <button onclick=\"window.location.href='/espwebc'\" style='margin-right: 10px;'>Go to ESP Web Config</button>";
-html += "  </div>";
-html += "</div>";
+// Applies all updates and writes {"applied":n,"results":[{"id":...,"status":...}]}
+void ESPWebConnect::applyBatch(JsonArray updates, Print &out)
+{
+    size_t applied = 0;
+    out.print("{\"results\":[");
+    bool first = true;
+    for (JsonVariant update : updates)
+    {
+        int status = applyUpdate(update);
+        applied += status == 200;
+        out.print(first ? "{\"id\":" : ",{\"id\":");
+        printJsonString(out, update["id"].as<const char *>());
+        out.printf(",\"status\":%d}", status);
+        first = false;
+    }
+    out.printf("],\"applied\":%u}", (unsigned)applied);
+}
 
-    // Dashboard container
-    html += "<div id='dashboard'></div>";
+void ESPWebConnect::handleBatch(AsyncWebServerRequest *request, const String &body)
+{
+    DynamicJsonDocument doc(batchCapacity(body.c_str(), body.length()));
+    if (deserializeJson(doc, body) || !doc.is<JsonArray>())
+    {
+        request->send(400, "text/plain", "Expected a JSON array of {\"id\", \"value\"}");
+        return;
+    }
 
-    html += "</body></html>";
-    return html;
+    AsyncResponseStream *response = request->beginResponseStream("application/json");
+    applyBatch(doc.as<JsonArray>(), *response);
+    request->send(response);
 }
 
 String ESPWebConnect::getWidgetType(DashboardElement::Type type)
@@ -1080,6 +3006,80 @@ bool ESPWebConnect::checkAuth(AsyncWebServerRequest *request)
     return true;
 }
 
+// Admission control, see ESPWebCLimits. Refused requests get a short reply
+// with Retry-After so well-behaved clients back off.
+bool ESPWebConnect::admit(AsyncWebServerRequest *request, ESPWebCLimits::Class cls)
+{
+    uint32_t retryAfter;
+    ESPWebCLimits::Verdict verdict = limits.admit(request->client()->remoteIP(), cls, retryAfter);
+    if (verdict == ESPWebCLimits::ADMIT)
+    {
+        request->onDisconnect([this]()
+                              { limits.release(); });
+        return true;
+    }
+
+    AsyncWebServerResponse *response = verdict == ESPWebCLimits::RATE
+                                           ? request->beginResponse(429, "text/plain", "Too many requests")
+                                           : request->beginResponse(503, "text/plain", "Busy");
+    response->addHeader("Retry-After", String(retryAfter));
+    request->send(response);
+#ifdef ENABLE_DEBUG
+    Serial.printf("Refused %s (%d)\n", request->url().c_str(), verdict);
+#endif
+    return false;
+}
+
+void ESPWebConnect::setLimits(uint16_t maxRequests, uint16_t maxClients, uint32_t minFreeHeap)
+{
+    limits.maxRequests = maxRequests;
+    limits.maxClients = maxClients;
+    limits.minFreeHeap = minFreeHeap;
+}
+
+void ESPWebConnect::setRateLimit(float perSecond, float burst)
+{
+    limits.ratePerSec = perSecond;
+    limits.rateBurst = burst < 1 ? 1 : burst;
+}
+
+ESPWebConnect::LimitStats ESPWebConnect::getLimitStats() const
+{
+    LimitStats stats;
+    stats.inFlight = limits.inFlight();
+    stats.busy = limits.rejectedBusy;
+    stats.lowHeap = limits.rejectedHeap;
+    stats.rateLimited = limits.rejectedRate;
+    stats.clients = limits.rejectedClients;
+    return stats;
+}
+
+ESPWebConnect::SchedulerStats ESPWebConnect::getSchedulerStats() const
+{
+    SchedulerStats stats;
+    stats.timers = scheduler.size();
+    stats.runs = scheduler.runs;
+    stats.overruns = scheduler.overruns;
+    stats.maxLateMs = scheduler.maxLateMs;
+    stats.lateMs = scheduler.lateMs;
+    return stats;
+}
+
+void ESPWebConnect::setReadingsCacheTTL(unsigned long ms)
+{
+    readingsTtl = ms;
+    readingsTtlSet = true;
+}
+
+ESPWebConnect::ReadingsCacheStats ESPWebConnect::getReadingsCacheStats() const
+{
+    ReadingsCacheStats stats;
+    stats.hits = readingsCache.hits;
+    stats.misses = readingsCache.misses;
+    stats.bytes = readingsCache.capacity();
+    return stats;
+}
+
 void ESPWebConnect::handleButtonPress(AsyncWebServerRequest *request)
 {
     if (!request->hasArg("id"))
@@ -1088,29 +3088,21 @@ void ESPWebConnect::handleButtonPress(AsyncWebServerRequest *request)
         return;
     }
 
-    String id = request->arg("id");
-
-    bool buttonFound = false;
-    for (auto &element : dashboardElements)
+    int index = findElement(request->arg("id").c_str());
+    if (index < 0 || elementAt(index).type != DashboardElement::BUTTON)
     {
-        if (strcmp(element.id, id.c_str()) == 0 && element.type == DashboardElement::BUTTON)
-        { // Use strcmp to compare const char* with String's c_str()
-            if (element.onPress)
-            {
-                element.onPress();
-            }
-            buttonFound = true;
-            break;
-        }
+        request->send(404, "text/plain", "Button not found");
+        return;
     }
 
-    if (buttonFound)
+    Action action = {Action::PRESS, (size_t)index};
+    if (dispatchAction(action))
     {
         request->send(200, "text/plain", "Button pressed");
     }
     else
     {
-        request->send(404, "text/plain", "Button not found");
+        request->send(503, "text/plain", "Action queue full");
     }
 }
 
@@ -13,21 +13,89 @@
 #include <vector>
 #include <functional>
 #include <map>
+#include <memory>
 #include "esp_task_wdt.h"
+#include "ESPWebCSnapshot.h"
+#include "ESPWebCWidget.h"
+#include "ESPWebCArena.h"
+#include "ESPWebCLimits.h"
+#include "ESPWebCCache.h"
+#include "ESPWebCScheduler.h"
+#include "ESPWebCObservable.h"
+#include "ESPWebCFormat.h"
 
 //#define ENABLE_MQTT
+// #define ENABLE_HISTORY
+// #define ENABLE_METRICS
+// #define ENABLE_ALARMS
+// #define ENABLE_PEERS
+// #define ENABLE_STREAM
 // #define ENABLE_DEBUG
 // #define ENABLE_DEBUG_INFO
 
+#ifndef ESPWEBC_BATCH_MAX_BODY
+#define ESPWEBC_BATCH_MAX_BODY 4096 // largest /batch request body
+#endif
+
+#ifndef ESPWEBC_WS_MAX_MESSAGE
+#define ESPWEBC_WS_MAX_MESSAGE 8192 // largest WebSocket message, a batch or a subscription
+#endif
+
+#ifndef ESPWEBC_READINGS_TTL_DIVISOR
+#define ESPWEBC_READINGS_TTL_DIVISOR 4 // default readings cache TTL, a fraction of the update interval
+#endif
+
+#ifndef ESPWEBC_EVENTS_KEEPALIVE_MS
+#define ESPWEBC_EVENTS_KEEPALIVE_MS 15000 // resend unchanged readings on /events after this long
+#endif
+
+#ifndef ESPWEBC_MAX_PAGES
+#define ESPWEBC_MAX_PAGES 256 // setPage() names, at most 256: the page of a widget is a uint8_t
+#endif
+#if ESPWEBC_MAX_PAGES > 256
+#error "ESPWEBC_MAX_PAGES is at most 256"
+#endif
+
+#ifndef ESPWEBC_READ_SCRATCH
+#define ESPWEBC_READ_SCRATCH 2 // readings serializations running at once without allocating, eg: web server and loop()
+#endif
+
+#ifndef ESPWEBC_ALARM_MQTT_QUEUE
+#define ESPWEBC_ALARM_MQTT_QUEUE 8 // alarm messages kept while the MQTT broker is unreachable
+#endif
+
 #ifdef ENABLE_MQTT
 #include <PubSubClient.h>
 #endif
 
+#ifdef ENABLE_HISTORY
+#include "ESPWebCHistory.h"
+#endif
+
+#ifdef ENABLE_METRICS
+#include "ESPWebCMetrics.h"
+#endif
+
+#ifdef ENABLE_ALARMS
+#include "ESPWebCAlarms.h"
+#endif
+
+#ifdef ENABLE_PEERS
+#include "ESPWebCPeers.h"
+#endif
+
+#ifdef ENABLE_STREAM
+#include "ESPWebCStream.h"
+#endif
+
+struct ESPWebCAsset; // ESPWebCAssets.h, generated
+
 class ESPWebConnect
 {
 public:
     ESPWebConnect();
     void begin();
+    void handle();
 
     struct WifiSettings
     {
@@ -44,95 +112,172 @@ public:
     void setCSS(const String &url);
     void setAutoUpdate(unsigned long interval);
 
-    void addSensor(const char *id, const char *name, const char *desc, const char *icon, int *intValue, const char *unit);
-    void addSensor(const char *id, const char *name, const char *desc, const char *icon, float *floatValue, const char *unit);
+    // Number sensors: the value sent is held until the reading moves past
+    // deadband (in the unit, or a percentage of the last value sent), floats
+    // are sent with decimals digits (-1: full precision)
+    void addSensor(const char *id, const char *name, const char *desc, const char *icon, int *intValue, const char *unit, float deadband = 0, ESPWebCWidget::Deadband mode = ESPWebCWidget::DEADBAND_ABSOLUTE);
+    void addSensor(const char *id, const char *name, const char *desc, const char *icon, float *floatValue, const char *unit, int8_t decimals = -1, float deadband = 0, ESPWebCWidget::Deadband mode = ESPWebCWidget::DEADBAND_ABSOLUTE);
     void addSensor(const char *id, const char *name, const char *desc, const char *icon, String *stringValue, const char *unit);
 
     void addSwitch(const char *id, const char *name, const char *desc, const char *icon, bool *state);
+
+    // With change tracking: the WebSocket push sends these only when they
+    // changed, see ESPWebCObservable.h
+    void addSensor(const char *id, const char *name, const char *desc, const char *icon, ESPWebCObservable<int> *intValue, const char *unit, float deadband = 0, ESPWebCWidget::Deadband mode = ESPWebCWidget::DEADBAND_ABSOLUTE);
+    void addSensor(const char *id, const char *name, const char *desc, const char *icon, ESPWebCObservable<float> *floatValue, const char *unit, int8_t decimals = -1, float deadband = 0, ESPWebCWidget::Deadband mode = ESPWebCWidget::DEADBAND_ABSOLUTE);
+    void addSensor(const char *id, const char *name, const char *desc, const char *icon, ESPWebCObservable<String> *stringValue, const char *unit);
+    void addSwitch(const char *id, const char *name, const char *desc, const char *icon, ESPWebCObservable<bool> *state);
+
     void addButton(const char *id, const char *name, const char *desc, const char *icon, std::function<void()> onPress);
     void addInputNum(const char *id, const char *name, const char *desc, const char *icon, int *variable);
     void addInputNum(const char *id, const char *name, const char *desc, const char *icon, float *variable);
     void addInputText(const char *id, const char *name, const char *desc, const char *icon, String *variable);
 
+    // Widgets known at build time, see ESPWebCWidget.h. The table is used in
+    // place, call this once before any add*(), false otherwise.
+    template <size_t N>
+    bool addWidgets(const ESPWebCWidget (&table)[N]) { return setWidgetTable(table, N); }
+
     void setIconColor(const char *id, const char *color);
 
+    // Widgets added after this go on the named page (a string literal), the
+    // dashboard then loads and polls one page at a time. Widgets added
+    // before the first setPage() are on a "Main" page. false when
+    // ESPWEBC_MAX_PAGES are set, the widgets then stay on the current page.
+    bool setPage(const char *name);
+
     void setDashPath(const String &path);
     void setDashInfo(const char *title = nullptr, const char *description = nullptr, const char *imageurl = nullptr, const char *footer = nullptr);
     void setManifactureInfo(const char *developer = nullptr, const char* device = nullptr, const char *descDevice = nullptr, const char *versionDevice = nullptr);
 
     void updateDashboard();
+    void commit();
     void sendNotification(const String &id, const String &message, const String &messageColor, const String &icon, const String &iconColor, int timeout);
     void handleButtonPress(AsyncWebServerRequest *request);
 
     void sendGraphData();
 
-    struct DashboardElement
+    struct ActionQueueStats
     {
-        enum Type
-        {
-            SENSOR_INT,
-            SENSOR_FLOAT,
-            SENSOR_STRING,
-            SWITCH,
-            BUTTON,
-            INPUT_NUM,
-            INPUT_TEXT
-        };
-        Type type;
+        size_t depth;
+        size_t maxDepth;
+        uint32_t dropped;
+        uint32_t executed;
+        uint32_t maxExecUs;
+        uint32_t totalExecUs;
+        const char *slowestId;
+    };
 
-        const char *id;
-        const char *name;
-        const char *desc;
-        const char *unit;
-        const char *icon;
-        const char *color;
+    void setActionQueue(size_t depth = 16, bool dedicatedTask = false, uint32_t stackSize = 4096, UBaseType_t priority = 1);
+    ActionQueueStats getActionQueueStats() const;
 
-        union
-        {
-            int *intValue;
-            float *floatValue;
-            String *stringValue;
-            bool *state;
-        };
-        std::function<void()> onPress;
+    struct LimitStats
+    {
+        size_t inFlight;
+        uint32_t busy;        // 503, too many requests in flight
+        uint32_t lowHeap;     // 503, free heap under the threshold
+        uint32_t rateLimited; // 429 and refused WebSocket batches
+        uint32_t clients;     // WebSocket/SSE connections closed
+    };
+
+    // 0 disables a limit, see ESPWebCLimits.h for the defaults
+    void setLimits(uint16_t maxRequests, uint16_t maxClients, uint32_t minFreeHeap);
+    void setRateLimit(float perSecond, float burst);
+    LimitStats getLimitStats() const;
 
-        // Updated constructor for Display Sensor [Int]
-        DashboardElement(const char *id, const char *name, const char *desc, const char *icon, int *intValue, const char *unit)
-            : type(SENSOR_INT), id(id), name(name), desc(desc), icon(icon), color(nullptr), intValue(intValue), unit(unit) {}
+    // Sketch timers run from handle(), see ESPWebCScheduler.h. Return the
+    // timer id for cancel(), 0 when ESPWEBC_MAX_TIMERS are already in use.
+    uint16_t every(uint32_t periodMs, ESPWebCScheduler::Callback fn) { return scheduler.every(periodMs, fn); }
+    uint16_t every(uint32_t periodMs, ESPWebCScheduler::ArgCallback fn, void *arg) { return scheduler.every(periodMs, fn, arg); }
+    uint16_t after(uint32_t delayMs, ESPWebCScheduler::Callback fn) { return scheduler.after(delayMs, fn); }
+    uint16_t after(uint32_t delayMs, ESPWebCScheduler::ArgCallback fn, void *arg) { return scheduler.after(delayMs, fn, arg); }
+    bool cancel(uint16_t timerId) { return scheduler.cancel(timerId); }
 
-        // Updated constructor for Display Sensor [Float]
-        DashboardElement(const char *id, const char *name, const char *desc, const char *icon, float *floatValue, const char *unit)
-            : type(SENSOR_FLOAT), id(id), name(name), desc(desc), icon(icon), color(nullptr), floatValue(floatValue), unit(unit) {}
+    struct SchedulerStats
+    {
+        size_t timers;
+        uint32_t runs;
+        uint32_t overruns;  // periodic runs skipped, handle() was called too late
+        uint32_t maxLateMs; // latest start after the due time
+        uint32_t lateMs;    // total start delay, lateMs / runs is the mean
+    };
 
-        // Updated constructor for Display Sensor [String]
-        DashboardElement(const char *id, const char *name, const char *desc, const char *icon, String *stringValue, const char *unit)
-            : type(SENSOR_STRING), id(id), name(name), desc(desc), icon(icon), color(nullptr), stringValue(stringValue), unit(unit) {}
+    SchedulerStats getSchedulerStats() const;
 
-        // Updated constructor for Input Number [Int]
-        DashboardElement(const char *id, const char *name, const char *desc, const char *icon, int *intValue)
-            : type(INPUT_NUM), id(id), name(name), desc(desc), unit(""), icon(icon), color(nullptr), intValue(intValue) {}
+    struct ReadingsCacheStats
+    {
+        uint32_t hits;   // readings served from the cached text
+        uint32_t misses; // readings serialized
+        size_t bytes;    // cache buffer size
+    };
 
-        // Updated constructor for Input Number [Float]
-        DashboardElement(const char *id, const char *name, const char *desc, const char *icon, float *floatValue)
-            : type(INPUT_NUM), id(id), name(name), desc(desc), unit(""), icon(icon), color(nullptr), floatValue(floatValue) {}
+    // How long pollers, SSE and WebSocket pushes may share one serialization
+    // of the readings, 0 disables it. Defaults to a quarter of setAutoUpdate().
+    void setReadingsCacheTTL(unsigned long ms);
+    ReadingsCacheStats getReadingsCacheStats() const;
 
-        // Updated constructor for Text Input [String]
-        DashboardElement(const char *id, const char *name, const char *desc, const char *icon, String *stringValue)
-            : type(INPUT_TEXT), id(id), name(name), desc(desc), unit(""), icon(icon), color(nullptr), stringValue(stringValue) {}
+#ifdef ENABLE_HISTORY
+    void addHistory(const char *id, unsigned long intervalMs = 10000, uint8_t decimals = 2);
+    void setHistoryBudget(size_t totalBytes, size_t segmentBytes = 16 * 1024);
+#endif
 
-        // Constructor for Switch [Bool]
-        DashboardElement(const char *id, const char *name, const char *desc, const char *icon, bool *state)
-            : type(SWITCH), id(id), name(name), desc(desc), unit(""), icon(icon), color(nullptr), state(state) {}
+#ifdef ENABLE_ALARMS
+    // Rule on a numeric widget, notifies the dashboards when it turns active
+    // and when it clears. id and message must stay valid (string literals).
+    bool addAlarm(const char *id, const char *elementId, ESPWebCAlarms::Kind kind, float threshold, float hysteresis = 0, unsigned long holdMs = 0, const char *message = nullptr);
+    bool alarmActive(const char *id) const;
+#ifdef ENABLE_MQTT
+    void setAlarmMQTT(bool enabled) { alarmMQTT = enabled; }
+#endif
+#endif
 
-        // Constructor for Button [Function]
-        DashboardElement(const char *id, const char *name, const char *desc, const char *icon, std::function<void()> onPress)
-            : type(BUTTON), id(id), name(name), desc(desc), unit(""), icon(icon), color(nullptr), onPress(onPress) {}
+#ifdef ENABLE_PEERS
+    // Announce this node on the local network. The aggregator also shows the
+    // sensors of every other node on its dashboard, as "<node>_<id>".
+    // nodeName defaults to the Web name, then to the end of the MAC address.
+    // Packets are signed with key, by default the Web lock user and password
+    // when the lock is on, and unsigned ones are dropped.
+    void setPeers(bool aggregator = false, const char *nodeName = nullptr, const char *key = nullptr);
+#endif
 
+#ifdef ENABLE_STREAM
+    struct StreamStats
+    {
+        size_t queued;
+        uint32_t pushed;
+        uint32_t overruns; // samples dropped, the ring was full
+        uint32_t packetsSent;
+        uint32_t samplesSent;
+        uint32_t sendErrors;
     };
 
+    // Sends pushSample() values to a UDP collector (extras/stream_recv.cpp),
+    // packed into datagrams of packetBytes or sent after maxLatencyMs.
+    // collector is an IP address or a host name.
+    bool beginStream(const char *collector, uint16_t port = ESPWEBC_STREAM_PORT, size_t capacity = 1024, size_t packetBytes = 1024, uint32_t maxLatencyMs = 50);
+    // No lock and no allocation, but call it from one task only
+    bool pushSample(uint8_t channel, float value) { return stream.push(channel, value, micros()); }
+    StreamStats getStreamStats() const;
+#endif
+
+    typedef ESPWebCWidget DashboardElement;
+
     String getWidgetType(DashboardElement::Type type);
 
-    std::vector<DashboardElement> dashboardElements;
+    std::vector<DashboardElement> dashboardElements; // runtime add*() widgets
+    const DashboardElement *widgetTable = nullptr;   // addWidgets() table in flash
+    size_t widgetTableSize = 0;
+    std::vector<std::function<void()>> buttonCallbacks; // addButton() callbacks
+    size_t readingsCapacity = 0;                        // JSON capacity of all readings
+
+    // Widget i, the flash table comes first, then the runtime widgets
+    const DashboardElement &elementAt(size_t i) const
+    {
+        return i < widgetTableSize ? widgetTable[i] : dashboardElements[i - widgetTableSize];
+    }
+    size_t elementCount() const { return widgetTableSize + dashboardElements.size(); }
+    void addElement(const DashboardElement &element);
+    bool setWidgetTable(const DashboardElement *table, size_t count);
 
     void saveWifiSettings(const WifiSettings &settings);
     void performOTAUpdateFromURL(const String &firmwareURL);
@@ -163,6 +308,7 @@ private:
     WiFiClient wifiClient;
     AsyncWebServer server;
     AsyncWebSocket ws;
+    AsyncEventSource events;
 
     struct WebSettings
     {
@@ -174,7 +320,7 @@ private:
     WebSettings webSettings;
     bool isAPMode() const;
 
-    String iconUrl;
+    String iconUrl; // no stylesheet, icons come from the sprite unless setIconUrl() is used
     String cssUrl;
 
     String dashTitle = "Dashboard Interface";
@@ -189,25 +335,228 @@ private:
 
     String dashPath;
 
+    // One handler for every widget action (GET /toggleSwitch, GET /pressButton,
+    // POST /<input id>), elements are resolved through elementIndex.
+    class WidgetHandler : public AsyncWebHandler
+    {
+    public:
+        explicit WidgetHandler(ESPWebConnect *owner) : owner(owner) {}
+        // Both signatures, AsyncWebServer forks disagree on the const
+        bool canHandle(AsyncWebServerRequest *request) { return match(request); }
+        bool canHandle(AsyncWebServerRequest *request) const { return match(request); }
+        bool isRequestHandlerTrivial() { return false; }
+        bool isRequestHandlerTrivial() const { return false; }
+        void handleRequest(AsyncWebServerRequest *request);
+
+    private:
+        bool match(AsyncWebServerRequest *request) const;
+        ESPWebConnect *owner;
+    };
+    WidgetHandler widgetHandler;
+    ArRequestHandlerFunction widgetRoute;
+    std::vector<uint16_t> elementIndex; // element indices sorted by id, case-insensitive
+    void indexElement(size_t index);
+    void handleInput(AsyncWebServerRequest *request, int index);
+
     unsigned long updateInterval = 5000;
 
-    String generateAllReadingsJSON();
+    bool writeAllReadingsJSON(Print &out, const std::vector<uint32_t> *mask = nullptr, bool withPeers = true);
+    int findElement(const char *id) const;
+    ESPWebCArena arena; // scratch buffer shared by the response producers
+    ESPWebCLimits limits;
+    ESPWebCCache readingsCache;
+    ESPWebCScheduler scheduler;
+    bool readingsTtlSet = false;
+    unsigned long readingsTtl = 0;
+    uint32_t readingsKey();
+    bool commitChanges() const;
+    bool subscribesAll(const std::vector<uint32_t> &mask) const;
+    // Calls use(data, length) with the cached readings JSON, see ESPWebCCache,
+    // or only those of a page. Slot 0 has every reading, slot page + 1 a page.
+    template <typename Use>
+    bool withReadings(Use use, int page = -1)
+    {
+        unsigned long ttl = readingsTtlSet ? readingsTtl : updateInterval / ESPWEBC_READINGS_TTL_DIVISOR;
+        const std::vector<uint32_t> *mask = page >= 0 ? &pageMasks[page] : nullptr;
+        return readingsCache.get(page + 1, readingsKey(), ttl, [this, mask, page](Print &out)
+                                 { return writeAllReadingsJSON(out, mask, page <= 0); }, use);
+    }
+
+    std::vector<const char *> pageNames;          // empty: one page with every widget
+    std::vector<uint8_t> elementPage;             // page of each element
+    std::vector<std::vector<uint32_t>> pageMasks; // bitset of element indices per page
+    uint8_t currentPage = 0;                      // page of the next add*()
+    int requestedPage(AsyncWebServerRequest *request) const;
+    size_t nextElement(const std::vector<uint32_t> *mask, size_t from) const;
+    bool admit(AsyncWebServerRequest *request, ESPWebCLimits::Class cls);
+    ESPWebCSnapshot snapshot;
+    std::vector<uint16_t> snapshotTextSlots;
+    // writeAllReadingsJSON() scratch, grown with the widget set and reused.
+    // A caller claims a free one with an atomic exchange instead of a lock.
+    struct ReadScratch
+    {
+        std::vector<ESPWebCSnapshot::Value> values;
+        std::vector<char> text;
+        std::vector<char> numbers;
+        uint32_t busy = 0;
+    };
+    ReadScratch readScratch[ESPWEBC_READ_SCRATCH];
+    ReadScratch *claimScratch();
     void handleToggleSwitch(AsyncWebServerRequest *request);
     void handleNotification(AsyncWebServerRequest *request);
     void handleFirmwareUpload(AsyncWebServerRequest *request);
+    bool numericValue(const DashboardElement &element, float &value) const;
+
+    struct Action
+    {
+        enum Kind
+        {
+            PRESS,
+            SET_INT,
+            SET_FLOAT,
+            SET_TEXT,
+            SET_SWITCH
+        };
+        Kind kind;
+        size_t element;
+        int intValue;
+        float floatValue;
+        String text;
+    };
+    bool dispatchAction(Action &action);
+    void runAction(const Action &action);
+    void drainActions();
+    static void actionTask(void *arg);
+    std::vector<Action> actionSlots;
+    size_t actionHead = 0;
+    size_t actionCount = 0;
+    SemaphoreHandle_t actionLock = nullptr;
+    TaskHandle_t actionTaskHandle = nullptr;
+    ActionQueueStats actionStats = {};
+    mutable portMUX_TYPE actionStatsMux = portMUX_INITIALIZER_UNLOCKED; // actions run without the queue too
 
     void onWebSocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len);
+    struct WsClient
+    {
+        uint32_t id;
+        uint32_t hash;
+        std::vector<uint32_t> subscription; // bitset of element indices
+        bool full;                          // next push sends every subscribed reading
+    };
+    std::vector<WsClient> wsClients;
+    SemaphoreHandle_t wsLock = nullptr;
+    unsigned long lastWsPush = 0;
+    bool wsPushDue = false;
+
+    ESPWebCDirtySet changes;          // set by observables and dashboard writes
+    ESPWebCDirtySet committedChanges; // changes published by commit()
+    std::vector<ESPWebCObservableBase *> observables;
+    std::vector<uint32_t> observedMask; // bitset of elements registered with an observable
+    std::vector<uint32_t> pushChanges;  // pushSubscriptions() scratch
+    std::vector<uint32_t> pushMoved;
+    std::vector<uint32_t> pushHeld;     // changes still inside their deadband
+    std::vector<uint32_t> pushMask;
+    void observe(ESPWebCObservableBase *value);
+    void resizeElementState();
+    // Last value sent per deadband sensor, NAN before the first. Shared by
+    // every transport, each access is a single atomic load or store.
+    std::vector<float> reported;
+    ESPWebCDirtySet reportedMoves; // reported values moved since the last push
+    size_t formattedSensors = 0;   // float sensors with fixed decimals
+    size_t stateElements = 0;      // elements resizeElementState() has seen
+    float reportedValue(size_t index, float value);
+    float loadReported(size_t index) const;
+    void holdDeadbandChanges();
+    bool changedReadings(const std::vector<uint32_t> &subscription, std::vector<uint32_t> &mask) const;
+    void handleWsMessage(AsyncWebSocketClient *client, uint8_t *data, size_t len);
+    void pushSubscriptions();
+
+    // Server-Sent Events on /events, one serialization per tick for all listeners
+    String lastEvent;
+    uint32_t eventId = 0;
+    uint32_t lastEventKey = 0;
+    unsigned long lastEventCheck = 0;
+    unsigned long lastEventSent = 0;
+    void pushEvents();
+
+    ArRequestHandlerFunction instrument(const char *route, ArRequestHandlerFunction handler);
+    ArBodyHandlerFunction instrumentBody(const char *route, ArBodyHandlerFunction handler);
+#ifdef ENABLE_METRICS
+    ESPWebCMetrics metrics;
+    void handleMetrics(AsyncWebServerRequest *request);
+#endif
 
     bool checkAuth(AsyncWebServerRequest *request);
     bool readWifiSettings(WifiSettings &settings);
     bool readWebSettings(WebSettings &settings);
 
-    String generateDashboardHTML();
+    uint32_t assetOverrides = 0; // bit per ESPWEBC_ASSETS entry found on LittleFS
+    bool iconOverride = false;
+    void serveAsset(AsyncWebServerRequest *request, const char *path);
+    void sendAsset(AsyncWebServerRequest *request, const ESPWebCAsset &asset, bool overridden);
+    bool notModified(AsyncWebServerRequest *request, const String &etag);
+    bool widgetsDirty = true;
+    uint32_t widgetsHash = 0;
+    uint32_t widgetsVersion();
+    void handleWidgetsJSON(AsyncWebServerRequest *request);
+
+    int applyUpdate(JsonVariant update);
+    void applyBatch(JsonArray updates, Print &out);
+    void handleBatch(AsyncWebServerRequest *request, const String &body);
 
     void handleReboot();
     void startAP(const char *ssid, const char *password);
     bool configureWiFi(const char *ssid, const char *password);
 
+#ifdef ENABLE_HISTORY
+    struct HistoryTrack
+    {
+        size_t element;
+        uint8_t series;
+        unsigned long interval;
+        unsigned long lastSample;
+    };
+    ESPWebCHistory history;
+    std::vector<HistoryTrack> historyTracks;
+    std::vector<ESPWebCRollup> historyRollups;
+    uint32_t lastRollupTs = 0;
+    unsigned long historyDue = 0; // millis() of the earliest sample
+    size_t historyBudget = 256 * 1024;
+    size_t historySegment = 16 * 1024;
+    void handleHistory(AsyncWebServerRequest *request);
+    void sendRollup(AsyncWebServerRequest *request, size_t track, size_t tier, uint32_t from, uint32_t to);
+#endif
+
+#ifdef ENABLE_ALARMS
+    ESPWebCAlarms alarms;
+    ESPWebCDirtySet alarmChanges;      // mirror of changes, for the alarm engine
+    std::vector<uint32_t> alarmScratch; // alarms.run() input
+    void onAlarm(const ESPWebCAlarms::Rule &rule, float value);
+#ifdef ENABLE_MQTT
+    bool alarmMQTT = false;
+    std::vector<String> alarmOutbox; // waiting for the broker, oldest first
+    void flushAlarmMQTT();
+#endif
+#endif
+
+#ifdef ENABLE_PEERS
+    ESPWebCPeers peers;
+    bool peersEnabled = false;
+    bool peersAggregator = false;
+    String peersName;
+    String peersKey;
+    IPAddress peersIp; // station address the peers were started on
+    void startPeers();
+    void encodePeerWidgets(ESPWebCPeer::Writer &out);
+    void encodePeerReadings(ESPWebCPeer::Writer &out);
+    void addPeerReadings(JsonDocument &doc);
+    void writePeerWidgets(Print &out, bool first);
+#endif
+
+#ifdef ENABLE_STREAM
+    ESPWebCStream stream;
+#endif
+
 #ifdef ENABLE_MQTT
     void handleGetMQTTSettings(AsyncWebServerRequest *request);
     bool readMQTTSettings(MQTTSettings &settings);